@@ -0,0 +1,59 @@
+/**
+ * \file bench/bench.hpp
+ *
+ * \brief Minimal timing helpers shared by the benchmark executables.
+ */
+
+#pragma once
+
+#ifndef BENCH_BENCH_HPP_
+#define BENCH_BENCH_HPP_
+
+#include <chrono>     // steady_clock
+#include <cstdio>     // printf
+#include <cstddef>    // size_t
+
+
+namespace bench {
+
+
+/**
+ * \brief Prevents the compiler from optimizing away the computation of `value`.
+ */
+template <typename _T>
+inline void do_not_optimize(const _T& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+
+/**
+ * \brief Runs `fn` `repeat` times and returns the best wall-clock time in milliseconds.
+ */
+template <typename _Fn>
+double measure_ms(_Fn&& fn, std::size_t repeat = 5) {
+    double best = 0.0;
+    for (std::size_t i = 0; i < repeat; ++i) {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        auto stop = std::chrono::steady_clock::now();
+
+        double elapsed = std::chrono::duration<double, std::milli>(stop - start).count();
+        if (i == 0 || elapsed < best)
+            best = elapsed;
+    }
+    return best;
+}
+
+
+/**
+ * \brief Prints one result line: `<name> <size> <time>`.
+ */
+inline void report(const char* name, std::size_t size, double ms) {
+    std::printf("%-48s n=%-10zu %10.3f ms\n", name, size, ms);
+}
+
+
+} // namespace bench::
+
+
+#endif // BENCH_BENCH_HPP_
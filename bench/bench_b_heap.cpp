@@ -0,0 +1,130 @@
+/**
+ * \file bench/bench_b_heap.cpp
+ *
+ * \brief Heaps far larger than the caches: `priority_queue` with the binary
+ * heap layout versus the B-heap layout, replacing the top of a heap of 10M
+ * and 100M keys. Reports the time, the page faults taken during the run, and
+ * the number of distinct 4 KiB pages one pop and push touch on average.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <random>
+#include <sys/resource.h>
+
+#include "bench.hpp"
+#include "priority_queue.hpp"
+#include "vector.hpp"
+
+
+namespace {
+
+constexpr std::size_t OPS    = 1'000'000;
+constexpr std::size_t SAMPLE = 10'000;   // operations traced for the page count
+constexpr std::uint64_t LIMIT = std::uint64_t(1) << 63;
+
+
+/**
+ * \brief Records the pages of the elements a comparison reads, when tracing.
+ */
+struct page_trace {
+    mystl::vector<std::uintptr_t> pages;
+    bool                          on = false;
+
+    void touch(const void* p) {
+        if (on)
+            pages.push_back(reinterpret_cast<std::uintptr_t>(p) >> 12);
+    }
+
+    // distinct pages since the last call
+    std::size_t flush() {
+        std::size_t distinct = 0;
+        for (std::size_t i = 0; i < pages.size(); ++i) {
+            bool seen = false;
+            for (std::size_t j = 0; j < i && !seen; ++j)
+                seen = pages[j] == pages[i];
+            distinct += !seen;
+        }
+        pages.clear();
+        return distinct;
+    }
+};
+
+
+/**
+ * \brief A min-heap comparator that can report the pages it reads.
+ */
+struct traced_greater {
+    page_trace* trace;
+
+    bool operator()(const std::uint64_t& a, const std::uint64_t& b) const {
+        trace->touch(&a);
+        trace->touch(&b);
+        return a > b;
+    }
+};
+
+
+/**
+ * \brief Page faults taken by the process so far.
+ */
+std::size_t page_faults() {
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return static_cast<std::size_t>(usage.ru_minflt + usage.ru_majflt);
+}
+
+
+template <typename _Layout>
+void run(const char* name, std::size_t n) {
+    using queue_type = mystl::priority_queue<std::uint64_t, mystl::vector<std::uint64_t>, traced_greater, _Layout>;
+
+    //
+    page_trace trace;
+    std::mt19937_64 rng(42);
+    mystl::vector<std::uint64_t> keys;
+    keys.reserve(n);
+    for (std::size_t i = 0; i < n; ++i)
+        keys.push_back(rng() >> 1);
+    queue_type queue(traced_greater{&trace}, std::move(keys));
+
+    // the hold model: the top is replaced by a key drawn above it, uniform
+    // over the remaining key range like the keys already queued
+    std::size_t faults = page_faults();
+    double ms = bench::measure_ms([&] {
+        for (std::size_t i = 0; i < OPS; ++i) {
+            std::uint64_t next = queue.top() + rng() % (LIMIT - queue.top());
+            queue.pop();
+            queue.push(next);
+        }
+        bench::do_not_optimize(queue.top());
+    }, 3);
+    faults = page_faults() - faults;
+
+    //
+    trace.on = true;
+    std::size_t pages = 0;
+    for (std::size_t i = 0; i < SAMPLE; ++i) {
+        std::uint64_t next = queue.top() + rng() % (LIMIT - queue.top());
+        queue.pop();
+        queue.push(next);
+        pages += trace.flush();
+    }
+
+    //
+    bench::report(name, n, ms);
+    std::printf("    page faults %zu, pages touched per pop+push %.1f\n", faults, double(pages) / SAMPLE);
+}
+
+}
+
+
+int main() {
+    for (std::size_t n : {std::size_t(10'000'000), std::size_t(100'000'000)}) {
+        run<mystl::binary_heap_layout>("priority_queue, binary heap", n);
+        run<mystl::b_heap_layout<>>("priority_queue, B-heap (4 KiB pages)", n);
+    }
+    return 0;
+}
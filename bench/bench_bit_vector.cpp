@@ -0,0 +1,85 @@
+/**
+ * \file bench/bench_bit_vector.cpp
+ *
+ * \brief Boolean mask throughput: packed `bit_vector` versus a byte per flag.
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+#include "bench.hpp"
+#include "bit_vector.hpp"
+#include "vector.hpp"
+
+
+namespace {
+
+constexpr std::size_t N = 1 << 24;
+
+}
+
+
+int main() {
+    // sparse mask: roughly one flag in 37 is set
+    mystl::bit_vector bitsA(N), bitsB(N);
+    mystl::vector<unsigned char> bytesA(N, 0), bytesB(N, 0);
+    for (std::size_t i = 0; i < N; i += 37) {
+        bitsA[i] = true;
+        bytesA[i] = 1;
+    }
+    for (std::size_t i = 0; i < N; i += 11) {
+        bitsB[i] = true;
+        bytesB[i] = 1;
+    }
+
+    std::printf("memory: bit_vector %zu bytes, byte vector %zu bytes\n",
+                bitsA.word_count() * sizeof(std::uint64_t), bytesA.size());
+
+    std::size_t result = 0;
+
+    /* count */
+    double ms = bench::measure_ms([&] {
+        std::size_t c = 0;
+        for (std::size_t i = 0; i < N; ++i)
+            c += bytesA[i];
+        result = c;
+        bench::do_not_optimize(result);
+    });
+    bench::report("count: byte vector", N, ms);
+
+    ms = bench::measure_ms([&] { result = bitsA.count(); bench::do_not_optimize(result); });
+    bench::report("count: bit_vector", N, ms);
+
+    /* and */
+    ms = bench::measure_ms([&] {
+        for (std::size_t i = 0; i < N; ++i)
+            bytesA[i] &= bytesB[i] | 1;
+        bench::do_not_optimize(bytesA.data());
+    });
+    bench::report("and: byte vector", N, ms);
+
+    ms = bench::measure_ms([&] { bitsA &= bitsB; bitsA |= bitsB; bench::do_not_optimize(bitsA.data()); });
+    bench::report("and+or: bit_vector", N, ms);
+
+    /* iterate set positions */
+    ms = bench::measure_ms([&] {
+        std::size_t sum = 0;
+        for (std::size_t i = 0; i < N; ++i)
+            if (bytesB[i])
+                sum += i;
+        result = sum;
+        bench::do_not_optimize(result);
+    });
+    bench::report("scan set positions: byte vector", N, ms);
+
+    ms = bench::measure_ms([&] {
+        std::size_t sum = 0;
+        for (std::size_t i = bitsB.find_first(); i < N; i = bitsB.find_next(i))
+            sum += i;
+        result = sum;
+        bench::do_not_optimize(result);
+    });
+    bench::report("scan set positions: bit_vector find_next", N, ms);
+
+    return 0;
+}
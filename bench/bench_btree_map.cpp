@@ -0,0 +1,118 @@
+/**
+ * \file bench/bench_btree_map.cpp
+ *
+ * \brief Random insert, lookup, range scan and bulk load: `btree_map` (at two
+ * node sizes) versus `std::map`.
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <random>
+#include <utility>
+
+#include "bench.hpp"
+#include "btree_map.hpp"
+#include "vector.hpp"
+
+
+namespace {
+
+constexpr std::size_t N = 1'000'000;
+
+
+template <typename _Map>
+void run(const char* name, const mystl::vector<std::int64_t>& keys) {
+    char label[96];
+    _Map map;
+
+    double ms = bench::measure_ms([&] {
+        map.clear();
+        for (std::size_t i = 0; i < keys.size(); ++i)
+            map[keys[i]] = std::int64_t(i);
+        bench::do_not_optimize(map.size());
+    }, 3);
+    std::snprintf(label, sizeof(label), "%s insert", name);
+    bench::report(label, N, ms);
+
+    ms = bench::measure_ms([&] {
+        std::int64_t sum = 0;
+        for (std::size_t i = 0; i < keys.size(); ++i)
+            sum += map.find(keys[i])->second;
+        bench::do_not_optimize(sum);
+    }, 3);
+    std::snprintf(label, sizeof(label), "%s find", name);
+    bench::report(label, N, ms);
+
+    // range scans of 100 elements from random starting keys
+    ms = bench::measure_ms([&] {
+        std::int64_t sum = 0;
+        for (std::size_t i = 0; i < keys.size(); i += 100) {
+            auto it = map.lower_bound(keys[i]);
+            for (int k = 0; k < 100 && it != map.end(); ++k, ++it)
+                sum += it->second;
+        }
+        bench::do_not_optimize(sum);
+    }, 3);
+    std::snprintf(label, sizeof(label), "%s lower_bound + 100", name);
+    bench::report(label, N / 100, ms);
+
+    ms = bench::measure_ms([&] {
+        for (std::size_t i = 0; i < keys.size(); i += 2)
+            map.erase(keys[i]);
+        bench::do_not_optimize(map.size());
+    }, 1);
+    std::snprintf(label, sizeof(label), "%s erase half", name);
+    bench::report(label, N / 2, ms);
+}
+
+
+/**
+ * \brief Building from sorted input: bulk load versus one insertion per key.
+ */
+void bench_bulk_load(const mystl::vector<std::int64_t>& keys) {
+    mystl::vector<std::pair<const std::int64_t, std::int64_t>> sorted;
+    sorted.reserve(N);
+    mystl::vector<std::int64_t> order(keys);
+    std::sort(order.begin(), order.end());
+    for (std::size_t i = 0; i < order.size(); ++i)
+        if (i == 0 || order[i] != order[i - 1])
+            sorted.push_back({order[i], std::int64_t(i)});
+
+    double ms = bench::measure_ms([&] {
+        std::map<std::int64_t, std::int64_t> map(sorted.cbegin(), sorted.cend());
+        bench::do_not_optimize(map.size());
+    }, 3);
+    bench::report("std::map sorted range constructor", sorted.size(), ms);
+
+    ms = bench::measure_ms([&] {
+        mystl::btree_map<std::int64_t, std::int64_t> map(sorted.cbegin(), sorted.cend());
+        bench::do_not_optimize(map.size());
+    }, 3);
+    bench::report("mystl::btree_map range constructor", sorted.size(), ms);
+
+    ms = bench::measure_ms([&] {
+        mystl::btree_map<std::int64_t, std::int64_t> map(mystl::sorted_unique, sorted);
+        bench::do_not_optimize(map.size());
+    }, 3);
+    bench::report("mystl::btree_map sorted_unique bulk load", sorted.size(), ms);
+}
+
+}
+
+
+int main() {
+    std::mt19937_64 rng(11);
+    mystl::vector<std::int64_t> keys;
+    keys.reserve(N);
+    for (std::size_t i = 0; i < N; ++i)
+        keys.push_back(std::int64_t(rng() >> 1));
+
+    run<std::map<std::int64_t, std::int64_t>>("std::map", keys);
+    run<mystl::btree_map<std::int64_t, std::int64_t, std::less<std::int64_t>, 256>>("mystl::btree_map 256B nodes", keys);
+    run<mystl::btree_map<std::int64_t, std::int64_t, std::less<std::int64_t>, 512>>("mystl::btree_map 512B nodes", keys);
+    bench_bulk_load(keys);
+    return 0;
+}
@@ -0,0 +1,67 @@
+/**
+ * \file bench/bench_inplace_vector.cpp
+ *
+ * \brief Fill-and-sum of small buffers: `inplace_vector` versus a reserved `vector`.
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+#include "bench.hpp"
+#include "inplace_vector.hpp"
+#include "vector.hpp"
+
+
+namespace {
+
+constexpr std::size_t ROUNDS = 200'000;
+
+
+template <std::size_t _N>
+void run() {
+    std::int64_t result = 0;
+
+    // a fresh container per round, as a function-local buffer on a hot path
+    double ms = bench::measure_ms([&] {
+        for (std::size_t r = 0; r < ROUNDS; ++r) {
+            mystl::vector<int> vec;
+            vec.reserve(_N);
+            for (std::size_t i = 0; i < _N; ++i)
+                vec.push_back(int(i + r));
+            result += vec[_N / 2];
+        }
+        bench::do_not_optimize(result);
+    });
+    bench::report("vector reserve+push_back", _N, ms);
+
+    ms = bench::measure_ms([&] {
+        for (std::size_t r = 0; r < ROUNDS; ++r) {
+            mystl::inplace_vector<int, _N> vec;
+            for (std::size_t i = 0; i < _N; ++i)
+                vec.push_back(int(i + r));
+            result += vec[_N / 2];
+        }
+        bench::do_not_optimize(result);
+    });
+    bench::report("inplace_vector push_back", _N, ms);
+
+    ms = bench::measure_ms([&] {
+        for (std::size_t r = 0; r < ROUNDS; ++r) {
+            mystl::inplace_vector<int, _N> vec;
+            while (vec.try_push_back(int(vec.size() + r)) != nullptr) {}
+            result += vec[_N / 2];
+        }
+        bench::do_not_optimize(result);
+    });
+    bench::report("inplace_vector try_push_back", _N, ms);
+}
+
+}
+
+
+int main() {
+    run<8>();
+    run<64>();
+    run<512>();
+    return 0;
+}
@@ -0,0 +1,180 @@
+/**
+ * \file bench/bench_list.cpp
+ */
+
+#include <cstddef>
+#include <iterator>
+#include <list>
+#include <string>
+#include <utility>
+
+#include "bench.hpp"
+#include "forward_list.hpp"
+#include "list.hpp"
+#include "vector.hpp"
+
+
+namespace {
+
+constexpr std::size_t N = 1'000'000;
+
+
+/**
+ * \brief Range/copy construction and bulk insertion.
+ */
+void bench_construction(const mystl::vector<int>& src) {
+    double ms = bench::measure_ms([&] {
+        mystl::list<int> lst(src.cbegin(), src.cend());
+        bench::do_not_optimize(lst.size());
+    });
+    bench::report("mystl::list range constructor", N, ms);
+
+    ms = bench::measure_ms([&] {
+        std::list<int> lst(src.cbegin(), src.cend());
+        bench::do_not_optimize(lst.size());
+    });
+    bench::report("std::list range constructor", N, ms);
+
+    ms = bench::measure_ms([&] {
+        mystl::list<int> lst;
+        for (auto it = src.cbegin(); it != src.cend(); ++it)
+            lst.push_back(*it);
+        bench::do_not_optimize(lst.size());
+    });
+    bench::report("mystl::list push_back loop", N, ms);
+
+    mystl::list<int> source(src.cbegin(), src.cend());
+    ms = bench::measure_ms([&] {
+        mystl::list<int> copy(source);
+        bench::do_not_optimize(copy.size());
+    });
+    bench::report("mystl::list copy constructor", N, ms);
+
+    ms = bench::measure_ms([&] {
+        mystl::list<int> lst = {1, 2};
+        lst.insert(++lst.cbegin(), N, 7);
+        bench::do_not_optimize(lst.size());
+    });
+    bench::report("mystl::list insert(pos, count, value)", N, ms);
+
+    ms = bench::measure_ms([&] {
+        mystl::list<int> lst;
+        lst.resize(N, 3);
+        bench::do_not_optimize(lst.size());
+    });
+    bench::report("mystl::list resize", N, ms);
+}
+
+
+/**
+ * \brief Moves all elements back and forth between two forward_lists.
+ */
+template <typename _List>
+void bench_ping_pong(const mystl::vector<int>& src, const char* name) {
+    _List a(src.cbegin(), src.cend());
+    _List b;
+    double ms = bench::measure_ms([&] {
+        for (std::size_t r = 0; r < 50; ++r) {
+            b.splice_after(b.cbefore_begin(), a);
+            a.splice_after(a.cbefore_begin(), b);
+        }
+        bench::do_not_optimize(a.size());
+    });
+    bench::report(name, N, ms);
+}
+
+
+/**
+ * \brief Moving blocks between lists: list range splice, and whole-list
+ * forward_list splices with and without a cached tail.
+ */
+void bench_splice(const mystl::vector<int>& src) {
+    constexpr std::size_t ROUNDS = 1000;
+
+    // rotate the two halves; same-list splices relink without counting
+    mystl::list<int> lst(src.cbegin(), src.cend());
+    auto first_half = lst.cbegin();
+    auto second_half = std::next(lst.cbegin(), N / 2);
+    double ms = bench::measure_ms([&] {
+        for (std::size_t r = 0; r < ROUNDS; ++r) {
+            lst.splice(std::prev(lst.cend()), lst, lst.cbegin(), second_half);
+            std::swap(first_half, second_half);
+        }
+        bench::do_not_optimize(lst.size());
+    });
+    bench::report("mystl::list splice half (same list) x1000", N / 2, ms);
+
+    std::list<int> std_lst(src.cbegin(), src.cend());
+    auto std_second = std::next(std_lst.cbegin(), N / 2);
+    ms = bench::measure_ms([&] {
+        for (std::size_t r = 0; r < ROUNDS; ++r) {
+            auto next = std_lst.cbegin();
+            std_lst.splice(std_lst.cend(), std_lst, std_lst.cbegin(), std_second);
+            std_second = next;
+        }
+        bench::do_not_optimize(std_lst.size());
+    });
+    bench::report("std::list splice half (same list) x1000", N / 2, ms);
+
+    // whole-list splice_after walks `other` to its last node unless the tail is cached
+    bench_ping_pong<mystl::forward_list<int>>(src, "mystl::forward_list splice_after whole list x100");
+    bench_ping_pong<mystl::forward_list<int, true>>(src, "mystl::forward_list<_, true> splice_after whole list x100");
+}
+
+
+/**
+ * \brief Migrating elements between two lists, one at a time: erase plus
+ * push_back (free, allocate, copy) versus extract plus insert of the node.
+ */
+void bench_migration() {
+    constexpr std::size_t COUNT = 1000;
+    constexpr std::size_t MOVES = 200'000;
+
+    const std::string payload(64, 'x');   // beyond the small-string buffer
+    mystl::list<std::string> from(COUNT, payload);
+    mystl::list<std::string> to;
+    double ms = bench::measure_ms([&] {
+        for (std::size_t i = 0; i < MOVES; ++i) {
+            to.push_back(from.front());
+            from.erase(from.cbegin());
+            from.swap(to);
+        }
+        bench::do_not_optimize(from.size());
+    });
+    bench::report("mystl::list erase + push_back", MOVES, ms);
+
+    ms = bench::measure_ms([&] {
+        for (std::size_t i = 0; i < MOVES; ++i) {
+            to.insert(to.cend(), from.extract(from.cbegin()));
+            from.swap(to);
+        }
+        bench::do_not_optimize(from.size());
+    });
+    bench::report("mystl::list extract + insert", MOVES, ms);
+
+    mystl::forward_list<std::string> fl_from(COUNT, payload);
+    mystl::forward_list<std::string> fl_to;
+    ms = bench::measure_ms([&] {
+        for (std::size_t i = 0; i < MOVES; ++i) {
+            fl_to.insert_after(fl_to.cbefore_begin(), fl_from.extract_after(fl_from.cbefore_begin()));
+            fl_from.swap(fl_to);
+        }
+        bench::do_not_optimize(fl_from.size());
+    });
+    bench::report("mystl::forward_list extract_after + insert_after", MOVES, ms);
+}
+
+}
+
+
+int main() {
+    mystl::vector<int> src;
+    src.reserve(N);
+    for (std::size_t i = 0; i < N; ++i)
+        src.push_back(int(i));
+
+    bench_construction(src);
+    bench_splice(src);
+    bench_migration();
+    return 0;
+}
@@ -0,0 +1,145 @@
+/**
+ * \file bench/bench_lru_cache.cpp
+ *
+ * \brief Hit-path latency and a skewed hit/miss mix: `lru_cache`,
+ * `clock_cache` and their sharded wrappers versus the textbook
+ * `std::list` + `std::unordered_map` LRU.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <list>
+#include <random>
+#include <unordered_map>
+#include <utility>
+
+#include "bench.hpp"
+#include "clock_cache.hpp"
+#include "lru_cache.hpp"
+#include "sharded_cache.hpp"
+#include "vector.hpp"
+
+
+namespace {
+
+constexpr std::size_t CAPACITY = 1 << 16;
+constexpr std::size_t N        = 1'000'000;
+
+
+/**
+ * \brief The usual LRU: a list in recency order plus a map to its nodes.
+ */
+class naive_lru {
+public:
+    explicit naive_lru(std::size_t capacity) : m_capacity(capacity) {}
+
+    int* get(int key) {
+        auto found = m_map.find(key);
+        if (found == m_map.end())
+            return nullptr;
+        m_order.splice(m_order.begin(), m_order, found->second);
+        return &found->second->second;
+    }
+
+    void put(int key, int value) {
+        auto found = m_map.find(key);
+        if (found != m_map.end()) {
+            found->second->second = value;
+            m_order.splice(m_order.begin(), m_order, found->second);
+            return;
+        }
+        if (m_order.size() == m_capacity) {
+            m_map.erase(m_order.back().first);
+            m_order.pop_back();
+        }
+        m_order.emplace_front(key, value);
+        m_map[key] = m_order.begin();
+    }
+
+private:
+    std::size_t m_capacity;
+    std::list<std::pair<int, int>> m_order;
+    std::unordered_map<int, std::list<std::pair<int, int>>::iterator> m_map;
+};
+
+
+template <typename _Cache>
+bool lookup(_Cache& cache, int key, std::int64_t& sum) {
+    if constexpr (requires { cache.get(key).has_value(); }) {
+        auto value = cache.get(key);
+        if (value)
+            sum += *value;
+        return value.has_value();
+    } else {
+        int* value = cache.get(key);
+        if (value)
+            sum += *value;
+        return value != nullptr;
+    }
+}
+
+
+template <typename _Cache>
+void run(const char* name, _Cache& cache, const mystl::vector<int>& hot, const mystl::vector<int>& skewed) {
+    char label[96];
+
+    for (std::size_t i = 0; i < CAPACITY; ++i)
+        cache.put(int(i), int(i));
+
+    // every lookup hits: measures the index probe plus the recency update
+    double ms = bench::measure_ms([&] {
+        std::int64_t sum = 0;
+        for (std::size_t i = 0; i < hot.size(); ++i)
+            lookup(cache, hot[i], sum);
+        bench::do_not_optimize(sum);
+    });
+    std::snprintf(label, sizeof(label), "%s get (all hits)", name);
+    bench::report(label, N, ms);
+
+    // skewed keys over twice the capacity, filling on a miss
+    ms = bench::measure_ms([&] {
+        std::int64_t sum = 0;
+        for (std::size_t i = 0; i < skewed.size(); ++i)
+            if (!lookup(cache, skewed[i], sum))
+                cache.put(skewed[i], skewed[i]);
+        bench::do_not_optimize(sum);
+    });
+    std::snprintf(label, sizeof(label), "%s get or put (skewed)", name);
+    bench::report(label, N, ms);
+}
+
+}
+
+
+int main() {
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> uniform(0, int(CAPACITY) - 1);
+    // squaring a uniform draw favors low keys, about 70% of the draws fall in the cache's size
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+
+    mystl::vector<int> hot, skewed;
+    hot.reserve(N);
+    skewed.reserve(N);
+    for (std::size_t i = 0; i < N; ++i) {
+        hot.push_back(uniform(rng));
+        double u = unit(rng);
+        skewed.push_back(int(u * u * double(2 * CAPACITY)));
+    }
+
+    naive_lru naive(CAPACITY);
+    run("std::list + std::unordered_map", naive, hot, skewed);
+
+    mystl::lru_cache<int, int> lru(CAPACITY);
+    run("mystl::lru_cache", lru, hot, skewed);
+
+    mystl::clock_cache<int, int> clock(CAPACITY);
+    run("mystl::clock_cache", clock, hot, skewed);
+
+    mystl::sharded_cache<mystl::lru_cache<int, int>> sharded_lru(CAPACITY);
+    run("mystl::sharded_cache<lru_cache>", sharded_lru, hot, skewed);
+
+    mystl::sharded_cache<mystl::clock_cache<int, int>> sharded_clock(CAPACITY);
+    run("mystl::sharded_cache<clock_cache>", sharded_clock, hot, skewed);
+    return 0;
+}
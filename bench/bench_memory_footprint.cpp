@@ -0,0 +1,90 @@
+/**
+ * \file bench/bench_memory_footprint.cpp
+ *
+ * \brief Prints the memory footprint per element of the containers for
+ * several element types and sizes, as reported by `memory_footprint()`:
+ * capacity slack, node links and sentinel nodes included. Not included are
+ * the allocator's per-block header and rounding (16 bytes per block with
+ * glibc) and memory the elements allocate themselves, like the characters
+ * of a long `std::string`.
+ */
+
+#include <cstddef>
+#include <cstdio>
+#include <string>
+
+#include "array.hpp"
+#include "forward_list.hpp"
+#include "list.hpp"
+#include "priority_queue.hpp"
+#include "queue.hpp"
+#include "stack.hpp"
+#include "vector.hpp"
+
+
+namespace {
+
+struct payload64 {
+    char bytes[64] = {};
+};
+
+
+/**
+ * \brief Builds a container of `n` elements with `build` and prints its
+ * footprint per element.
+ */
+template <typename _Container, typename _Build>
+void report(const char* name, const char* type, std::size_t n, _Build build) {
+    _Container c;
+    build(c, n);
+    std::printf("%-28s %-12s n=%-8zu %10.2f B/elem  overhead %10.2f B/elem\n",
+                name, type, n, double(c.memory_footprint()) / n, double(c.overhead_bytes()) / n);
+}
+
+
+template <typename _T>
+void report_type(const char* type, const _T& value) {
+    auto push = [&](auto& c, std::size_t n) {
+        for (std::size_t i = 0; i < n; ++i)
+            c.push(value);
+    };
+    auto push_back = [&](auto& c, std::size_t n) {
+        for (std::size_t i = 0; i < n; ++i)
+            c.push_back(value);
+    };
+
+    //
+    for (std::size_t n : {std::size_t(1), std::size_t(10), std::size_t(1000), std::size_t(100'000)}) {
+        report<mystl::vector<_T>>("vector (push_back)", type, n, push_back);
+        report<mystl::vector<_T>>("vector (shrink_to_fit)", type, n, [&](auto& c, std::size_t n) {
+            push_back(c, n);
+            c.shrink_to_fit();
+        });
+        report<mystl::list<_T>>("list", type, n, push_back);
+        report<mystl::forward_list<_T>>("forward_list", type, n, [&](auto& c, std::size_t n) {
+            for (std::size_t i = 0; i < n; ++i)
+                c.push_front(value);
+        });
+        report<mystl::stack<_T>>("stack<vector>", type, n, push);
+        report<mystl::queue<_T>>("queue<list>", type, n, push);
+        if constexpr (requires (const _T& a) { a < a; })
+            report<mystl::priority_queue<_T>>("priority_queue<vector>", type, n, push);
+        std::printf("\n");
+    }
+}
+
+}
+
+
+int main() {
+    report<mystl::array<int, 100>>("array<int, 100>", "int", 100, [](auto&, std::size_t) {});
+    std::printf("\n");
+
+    //
+    report_type("char", char('x'));
+    report_type("int", 42);
+    report_type("double", 4.2);
+    report_type("std::string", std::string(32, 'x'));
+    report_type("payload64", payload64());
+    return 0;
+}
@@ -0,0 +1,128 @@
+/**
+ * \file bench/bench_minmax_heap.cpp
+ *
+ * \brief Keeping both the smallest and the largest outstanding jobs:
+ * `double_ended_priority_queue` versus a min and a max `priority_queue`
+ * holding every job twice, with lazy deletion of jobs popped from the other
+ * side.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <random>
+#include <utility>
+
+#include "bench.hpp"
+#include "double_ended_priority_queue.hpp"
+#include "priority_queue.hpp"
+#include "vector.hpp"
+
+
+namespace {
+
+constexpr std::size_t N   = 1'000'000;   // jobs outstanding at the start
+constexpr std::size_t OPS = 2'000'000;
+
+using job = std::pair<std::uint32_t, std::uint32_t>;   // priority, id
+
+
+/**
+ * \brief The two-heap workaround.
+ */
+class two_heaps {
+public:
+    two_heaps() : m_done(N + OPS, 0) {}
+
+    void push(job j) {
+        m_min.push(j);
+        m_max.push(j);
+        ++m_size;
+    }
+
+    job pop_min() { return pop(m_min); }
+    job pop_max() { return pop(m_max); }
+
+    std::size_t size() const { return m_size; }
+
+private:
+    template <typename _Heap>
+    job pop(_Heap& heap) {
+        while (m_done[heap.top().second])
+            heap.pop();
+        job j = heap.top();
+        heap.pop();
+        m_done[j.second] = 1;
+        --m_size;
+        return j;
+    }
+
+    mystl::priority_queue<job, mystl::vector<job>, std::greater<job>> m_min;
+    mystl::priority_queue<job, mystl::vector<job>, std::less<job>>    m_max;
+    mystl::vector<char> m_done;
+    std::size_t m_size = 0;
+};
+
+
+/**
+ * \brief The min-max heap, with the same interface.
+ */
+class minmax_heap {
+public:
+    void push(job j) { m_queue.push(j); }
+
+    job pop_min() { job j = m_queue.min(); m_queue.pop_min(); return j; }
+    job pop_max() { job j = m_queue.max(); m_queue.pop_max(); return j; }
+
+    std::size_t size() const { return m_queue.size(); }
+
+private:
+    mystl::double_ended_priority_queue<job> m_queue;
+};
+
+
+template <typename _Queue>
+void run(const char* name, const mystl::vector<std::uint32_t>& priorities, const mystl::vector<std::uint8_t>& ops) {
+    double ms = bench::measure_ms([&] {
+        _Queue queue;
+        std::uint32_t id = 0;
+        for (; id < N; ++id)
+            queue.push({priorities[id], id});
+
+        // pushes, pops of the most urgent and drops of the least urgent jobs
+        std::uint64_t sum = 0;
+        for (std::size_t i = 0; i < OPS; ++i) {
+            if (ops[i] < 2) {
+                queue.push({priorities[id % priorities.size()], id});
+                ++id;
+            } else if (ops[i] == 2) {
+                sum += queue.pop_min().first;
+            } else {
+                sum += queue.pop_max().first;
+            }
+        }
+        bench::do_not_optimize(sum);
+        bench::do_not_optimize(queue.size());
+    }, 3);
+    bench::report(name, N + OPS, ms);
+}
+
+}
+
+
+int main() {
+    std::mt19937 rng(7);
+    mystl::vector<std::uint32_t> priorities;
+    mystl::vector<std::uint8_t> ops;
+    priorities.reserve(N + OPS);
+    ops.reserve(OPS);
+    for (std::size_t i = 0; i < N + OPS; ++i)
+        priorities.push_back(std::uint32_t(rng()));
+    for (std::size_t i = 0; i < OPS; ++i)
+        ops.push_back(std::uint8_t(rng() % 4));
+
+    run<two_heaps>("two mystl::priority_queue (lazy deletion)", priorities, ops);
+    run<minmax_heap>("mystl::double_ended_priority_queue", priorities, ops);
+    return 0;
+}
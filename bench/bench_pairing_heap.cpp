@@ -0,0 +1,209 @@
+/**
+ * \file bench/bench_pairing_heap.cpp
+ *
+ * \brief `pairing_heap` versus the vector-backed binary heap on two
+ * workloads: repeatedly melding many small heaps, and Dijkstra's algorithm
+ * with decrease-key instead of lazily deleted duplicates.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <limits>
+#include <random>
+#include <utility>
+
+#include "algorithm/make_heap.hpp"
+#include "algorithm/pop_heap.hpp"
+#include "bench.hpp"
+#include "pairing_heap.hpp"
+#include "priority_queue.hpp"
+#include "vector.hpp"
+
+
+namespace {
+
+constexpr std::size_t HEAPS     = 4096;
+constexpr std::size_t HEAP_SIZE = 128;
+
+constexpr std::uint32_t VERTICES = 200'000;
+constexpr std::uint32_t DEGREE   = 16;
+
+
+/* Meld */
+
+/**
+ * \brief Melds the heaps pairwise until one is left, popping a few elements
+ * from every merged heap along the way.
+ */
+void meld_pairing(const mystl::vector<int>& values) {
+    double ms = bench::measure_ms([&] {
+        mystl::vector<mystl::pairing_heap<int>> heaps;
+        heaps.reserve(HEAPS);
+        for (std::size_t h = 0; h < HEAPS; ++h) {
+            heaps.emplace_back();
+            for (std::size_t i = 0; i < HEAP_SIZE; ++i)
+                heaps[h].push(values[h * HEAP_SIZE + i]);
+        }
+
+        //
+        std::int64_t sum = 0;
+        for (std::size_t width = HEAPS; width > 1; width /= 2) {
+            for (std::size_t h = 0; h < width / 2; ++h) {
+                heaps[h].meld(heaps[h + width / 2]);
+                for (int k = 0; k < 4; ++k) {
+                    sum += heaps[h].top();
+                    heaps[h].pop();
+                }
+            }
+        }
+        bench::do_not_optimize(sum);
+    });
+    bench::report("mystl::pairing_heap meld", HEAPS * HEAP_SIZE, ms);
+}
+
+
+/**
+ * \brief The same with vectors kept as binary heaps; melding appends one to
+ * the other and re-heapifies.
+ */
+void meld_binary(const mystl::vector<int>& values) {
+    double ms = bench::measure_ms([&] {
+        mystl::vector<mystl::vector<int>> heaps(HEAPS);
+        for (std::size_t h = 0; h < HEAPS; ++h) {
+            for (std::size_t i = 0; i < HEAP_SIZE; ++i)
+                heaps[h].push_back(values[h * HEAP_SIZE + i]);
+            mystl::make_heap(heaps[h].begin(), heaps[h].end());
+        }
+
+        //
+        std::int64_t sum = 0;
+        for (std::size_t width = HEAPS; width > 1; width /= 2) {
+            for (std::size_t h = 0; h < width / 2; ++h) {
+                mystl::vector<int>& heap = heaps[h];
+                mystl::vector<int>& other = heaps[h + width / 2];
+                for (std::size_t i = 0; i < other.size(); ++i)
+                    heap.push_back(other[i]);
+                other.clear();
+                mystl::make_heap(heap.begin(), heap.end());
+                for (int k = 0; k < 4; ++k) {
+                    sum += heap.front();
+                    mystl::pop_heap(heap.begin(), heap.end());
+                    heap.pop_back();
+                }
+            }
+        }
+        bench::do_not_optimize(sum);
+    });
+    bench::report("mystl::vector + make_heap meld", HEAPS * HEAP_SIZE, ms);
+}
+
+
+/* Decrease key */
+
+struct graph {
+    mystl::vector<std::uint32_t> offsets;
+    mystl::vector<std::uint32_t> targets;
+    mystl::vector<std::uint32_t> weights;
+};
+
+constexpr std::uint64_t INF = std::numeric_limits<std::uint64_t>::max();
+using entry = std::pair<std::uint64_t, std::uint32_t>;
+
+
+void dijkstra_pairing(const graph& g) {
+    std::uint64_t updates = 0;
+    double ms = bench::measure_ms([&] {
+        using heap_type = mystl::pairing_heap<entry, std::greater<entry>>;
+        mystl::vector<std::uint64_t> dist(VERTICES, INF);
+        mystl::vector<heap_type::handle> handles(VERTICES);
+        mystl::vector<char> queued(VERTICES, 0);
+
+        //
+        heap_type heap;
+        updates = 0;
+        dist[0] = 0;
+        handles[0] = heap.push({0, 0});
+        queued[0] = 1;
+        while (!heap.empty()) {
+            auto [d, v] = heap.top();
+            heap.pop();
+            queued[v] = 0;
+            for (std::uint32_t e = g.offsets[v]; e < g.offsets[v + 1]; ++e) {
+                std::uint32_t t = g.targets[e];
+                std::uint64_t nd = d + g.weights[e];
+                if (nd >= dist[t])
+                    continue;
+                ++updates;
+                if (queued[t]) {
+                    heap.decrease_key(handles[t], {nd, t});
+                } else {
+                    handles[t] = heap.push({nd, t});
+                    queued[t] = 1;
+                }
+                dist[t] = nd;
+            }
+        }
+        bench::do_not_optimize(dist[VERTICES - 1]);
+    });
+    bench::report("mystl::pairing_heap dijkstra (decrease_key)", updates, ms);
+}
+
+
+void dijkstra_binary(const graph& g) {
+    std::uint64_t updates = 0;
+    double ms = bench::measure_ms([&] {
+        mystl::vector<std::uint64_t> dist(VERTICES, INF);
+        mystl::priority_queue<entry, mystl::vector<entry>, std::greater<entry>> heap;
+
+        //
+        updates = 0;
+        dist[0] = 0;
+        heap.push({0, 0});
+        while (!heap.empty()) {
+            auto [d, v] = heap.top();
+            heap.pop();
+            if (d != dist[v])
+                continue;
+            for (std::uint32_t e = g.offsets[v]; e < g.offsets[v + 1]; ++e) {
+                std::uint32_t t = g.targets[e];
+                std::uint64_t nd = d + g.weights[e];
+                if (nd >= dist[t])
+                    continue;
+                ++updates;
+                heap.push({nd, t});
+                dist[t] = nd;
+            }
+        }
+        bench::do_not_optimize(dist[VERTICES - 1]);
+    });
+    bench::report("mystl::priority_queue dijkstra (lazy deletion)", updates, ms);
+}
+
+}
+
+
+int main() {
+    std::mt19937 rng(7);
+
+    mystl::vector<int> values;
+    values.reserve(HEAPS * HEAP_SIZE);
+    for (std::size_t i = 0; i < HEAPS * HEAP_SIZE; ++i)
+        values.push_back(int(rng()));
+    meld_binary(values);
+    meld_pairing(values);
+
+    graph g;
+    for (std::uint32_t v = 0; v < VERTICES; ++v) {
+        g.offsets.push_back(v * DEGREE);
+        for (std::uint32_t k = 0; k < DEGREE; ++k) {
+            g.targets.push_back(std::uint32_t(rng() % VERTICES));
+            g.weights.push_back(std::uint32_t(1 + rng() % 1000));
+        }
+    }
+    g.offsets.push_back(VERTICES * DEGREE);
+    dijkstra_binary(g);
+    dijkstra_pairing(g);
+    return 0;
+}
@@ -0,0 +1,95 @@
+/**
+ * \file bench/bench_perf.cpp
+ *
+ * \brief Hardware event counts per operation (see `perf.hpp`) of traversing
+ * `list` and `vector` and of popping `priority_queue`, mystl versus std::.
+ * The lists are sorted first, so that their nodes are visited in an order
+ * unrelated to their addresses, as in a long-lived list.
+ */
+
+#include <cstddef>
+#include <cstdio>
+#include <list>
+#include <queue>
+#include <random>
+#include <vector>
+
+#include "bench.hpp"
+#include "perf.hpp"
+#include "list.hpp"
+#include "priority_queue.hpp"
+#include "vector.hpp"
+
+
+namespace {
+
+constexpr std::size_t N      = 1'000'000;
+constexpr std::size_t REPEAT = 5;
+
+
+/**
+ * \brief Sums a container from begin to end.
+ */
+template <typename _Container>
+void bench_traversal(bench::perf_counters& counters, const char* name, _Container& c) {
+    bench::measure_perf(counters, [&] {
+        long sum = 0;
+        for (auto it = c.begin(); it != c.end(); ++it)
+            sum += *it;
+        bench::do_not_optimize(sum);
+    }, REPEAT);
+    bench::report_perf(name, counters, N * REPEAT);
+}
+
+
+/**
+ * \brief Pops a heap built from `keys` empty; only the pops are counted.
+ */
+template <typename _Queue>
+void bench_pop(bench::perf_counters& counters, const char* name, const mystl::vector<int>& keys) {
+    counters.reset();
+    for (std::size_t r = 0; r < REPEAT; ++r) {
+        _Queue queue(keys.data(), keys.data() + keys.size());
+        counters.start();
+        while (!queue.empty()) {
+            bench::do_not_optimize(queue.top());
+            queue.pop();
+        }
+        counters.stop();
+    }
+    bench::report_perf(name, counters, N * REPEAT);
+}
+
+}
+
+
+int main() {
+    bench::perf_counters counters;
+    if (!counters.any_available())
+        std::printf("perf_event_open is not available here, every count is n/a\n");
+
+    //
+    std::mt19937 rng(42);
+    mystl::vector<int> keys;
+    for (std::size_t i = 0; i < N; ++i)
+        keys.push_back(static_cast<int>(rng()));
+
+    // per element visited
+    {
+        mystl::vector<int> vec(keys);
+        std::vector<int> std_vec(keys.cbegin(), keys.cend());
+        mystl::list<int> lst(keys.cbegin(), keys.cend());
+        std::list<int> std_lst(keys.cbegin(), keys.cend());
+        lst.sort();
+        std_lst.sort();
+        bench_traversal(counters, "mystl::vector traversal", vec);
+        bench_traversal(counters, "std::vector traversal", std_vec);
+        bench_traversal(counters, "mystl::list traversal (sorted)", lst);
+        bench_traversal(counters, "std::list traversal (sorted)", std_lst);
+    }
+
+    // per pop
+    bench_pop<mystl::priority_queue<int>>(counters, "mystl::priority_queue pop", keys);
+    bench_pop<std::priority_queue<int>>(counters, "std::priority_queue pop", keys);
+    return 0;
+}
@@ -0,0 +1,90 @@
+/**
+ * \file bench/bench_pop_n.cpp
+ *
+ * \brief A scheduler tick dequeuing the best `n` jobs and enqueuing `n` new
+ * ones: `n` calls of `top()` and `pop()` versus one `pop_n`, across `n` and
+ * queue sizes. Reports the time and the comparisons per dequeued job.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+
+#include "bench.hpp"
+#include "priority_queue.hpp"
+#include "vector.hpp"
+
+
+namespace {
+
+constexpr std::size_t JOBS = 2'000'000;   // dequeued per measurement
+
+
+/**
+ * \brief `std::less` that counts its calls.
+ */
+struct counting_less {
+    std::size_t* count;
+
+    bool operator()(std::uint64_t a, std::uint64_t b) const {
+        ++*count;
+        return a < b;
+    }
+};
+
+using queue_type = mystl::priority_queue<std::uint64_t, mystl::vector<std::uint64_t>, counting_less>;
+
+
+template <bool _Batch>
+void run(const char* name, std::size_t size, std::size_t n) {
+    //
+    std::size_t count = 0;
+    std::mt19937_64 rng(9);
+    queue_type queue(counting_less{&count});
+    queue.reserve(size);
+    for (std::size_t i = 0; i < size; ++i)
+        queue.push(rng());
+    mystl::vector<std::uint64_t> batch(n, 0);
+
+    //
+    std::size_t ticks = JOBS / n;
+    count = 0;
+    double ms = bench::measure_ms([&] {
+        std::uint64_t sum = 0;
+        for (std::size_t t = 0; t < ticks; ++t) {
+            if constexpr (_Batch) {
+                queue.pop_n(n, batch.begin());
+            } else {
+                for (std::size_t i = 0; i < n; ++i) {
+                    batch[i] = queue.top();
+                    queue.pop();
+                }
+            }
+            for (std::size_t i = 0; i < n; ++i) {
+                sum += batch[i];
+                queue.push(rng());
+            }
+        }
+        bench::do_not_optimize(sum);
+    }, 3);
+
+    // the pushes are the same for both, so the difference is the pops'
+    bench::report(name, size, ms);
+    std::printf("    n=%zu, comparisons per job %.1f\n", n, double(count) / (3 * ticks * n));
+}
+
+}
+
+
+int main() {
+    for (std::size_t size : {std::size_t(1'000), std::size_t(100'000), std::size_t(1'000'000)}) {
+        for (std::size_t n : {std::size_t(8), std::size_t(64), std::size_t(512)}) {
+            if (n > size)
+                continue;
+            run<false>("priority_queue, top() + pop() x n", size, n);
+            run<true>("priority_queue, pop_n(n)", size, n);
+        }
+    }
+    return 0;
+}
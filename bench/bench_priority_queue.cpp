@@ -0,0 +1,135 @@
+/**
+ * \file bench/bench_priority_queue.cpp
+ *
+ * \brief Draining a `priority_queue` of heavy payloads by copying `top()`
+ * versus `pop_value()`, and refilling a queue each round by copying a
+ * container in versus recycling its storage with `extract_container()` /
+ * `replace_container()`.
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+
+#include "bench.hpp"
+#include "priority_queue.hpp"
+#include "vector.hpp"
+
+
+namespace {
+
+constexpr std::size_t N      = 200'000;
+constexpr std::size_t ROUNDS = 8;
+
+
+template <typename _T>
+std::size_t weight(const _T& value) { return value.size(); }
+
+
+/**
+ * \brief Orders any sequence lexicographically, since `mystl::vector` has no `operator<`.
+ */
+struct lexicographic {
+    template <typename _T>
+    bool operator()(const _T& lhs, const _T& rhs) const {
+        return std::lexicographical_compare(lhs.cbegin(), lhs.cend(), rhs.cbegin(), rhs.cend());
+    }
+};
+
+
+template <typename _T>
+void run(const char* name, const mystl::vector<_T>& values) {
+    using queue_type = mystl::priority_queue<_T, mystl::vector<_T>, lexicographic>;
+    char label[96];
+
+    // drain: copy the top, then pop
+    double ms = bench::measure_ms([&] {
+        queue_type queue(values.cbegin(), values.cend());
+        std::size_t sum = 0;
+        while (!queue.empty()) {
+            _T top = queue.top();
+            queue.pop();
+            sum += weight(top);
+        }
+        bench::do_not_optimize(sum);
+    });
+    std::snprintf(label, sizeof(label), "%s top() + pop()", name);
+    bench::report(label, N, ms);
+
+    // drain: move the top out
+    ms = bench::measure_ms([&] {
+        queue_type queue(values.cbegin(), values.cend());
+        std::size_t sum = 0;
+        while (!queue.empty()) {
+            _T top = queue.pop_value();
+            sum += weight(top);
+        }
+        bench::do_not_optimize(sum);
+    });
+    std::snprintf(label, sizeof(label), "%s pop_value()", name);
+    bench::report(label, N, ms);
+
+    // refill rounds: a fresh container is copied into the queue each round
+    ms = bench::measure_ms([&] {
+        queue_type queue;
+        std::size_t sum = 0;
+        for (std::size_t round = 0; round < ROUNDS; ++round) {
+            mystl::vector<_T> batch;
+            for (std::size_t i = 0; i < values.size(); ++i)
+                batch.push_back(values[i]);
+            queue = queue_type(lexicographic(), batch);
+            sum += weight(queue.top());
+        }
+        bench::do_not_optimize(sum);
+    }, 3);
+    std::snprintf(label, sizeof(label), "%s refill by copy", name);
+    bench::report(label, N * ROUNDS, ms);
+
+    // refill rounds: the same storage goes back and forth
+    ms = bench::measure_ms([&] {
+        queue_type queue;
+        queue.reserve(values.size());
+        std::size_t sum = 0;
+        for (std::size_t round = 0; round < ROUNDS; ++round) {
+            mystl::vector<_T> batch = queue.extract_container();
+            batch.clear();
+            for (std::size_t i = 0; i < values.size(); ++i)
+                batch.push_back(values[i]);
+            queue.replace_container(std::move(batch));
+            sum += weight(queue.top());
+        }
+        bench::do_not_optimize(sum);
+    }, 3);
+    std::snprintf(label, sizeof(label), "%s refill by extract/replace", name);
+    bench::report(label, N * ROUNDS, ms);
+}
+
+}
+
+
+int main() {
+    std::mt19937 rng(7);
+
+    mystl::vector<std::string> strings;
+    mystl::vector<mystl::vector<int>> vectors;
+    strings.reserve(N);
+    vectors.reserve(N);
+    for (std::size_t i = 0; i < N; ++i) {
+        std::string s(64, 'a');
+        for (char& c : s)
+            c = char('a' + rng() % 26);
+        strings.push_back(s);
+
+        mystl::vector<int> v(32);
+        for (std::size_t k = 0; k < v.size(); ++k)
+            v[k] = int(rng());
+        vectors.push_back(v);
+    }
+
+    run("std::string(64)", strings);
+    run("mystl::vector<int>(32)", vectors);
+    return 0;
+}
@@ -0,0 +1,109 @@
+/**
+ * \file bench/bench_radix_heap.cpp
+ *
+ * \brief Dijkstra's shortest paths on a random sparse graph: `radix_heap`
+ * versus a min `priority_queue` of (distance, vertex) pairs, both with lazy
+ * deletion of outdated entries.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <limits>
+#include <random>
+#include <utility>
+
+#include "bench.hpp"
+#include "priority_queue.hpp"
+#include "radix_heap.hpp"
+#include "vector.hpp"
+
+
+namespace {
+
+constexpr std::uint32_t VERTICES = 500'000;
+constexpr std::uint32_t DEGREE   = 8;
+
+
+struct graph {
+    mystl::vector<std::uint32_t> offsets;   // edges of v are [offsets[v], offsets[v + 1])
+    mystl::vector<std::uint32_t> targets;
+    mystl::vector<std::uint32_t> weights;
+};
+
+
+template <typename _Queue>
+std::uint64_t dijkstra(const graph& g, mystl::vector<std::uint64_t>& dist) {
+    constexpr std::uint64_t INF = std::numeric_limits<std::uint64_t>::max();
+    for (std::size_t v = 0; v < dist.size(); ++v)
+        dist[v] = INF;
+
+    //
+    _Queue queue;
+    dist[0] = 0;
+    queue.push({0, 0});
+    std::uint64_t settled = 0;
+    while (!queue.empty()) {
+        auto [d, v] = queue.top();
+        queue.pop();
+        if (d != dist[v])
+            continue;
+        ++settled;
+        for (std::uint32_t e = g.offsets[v]; e < g.offsets[v + 1]; ++e) {
+            std::uint64_t nd = d + g.weights[e];
+            if (nd < dist[g.targets[e]]) {
+                dist[g.targets[e]] = nd;
+                queue.push({nd, g.targets[e]});
+            }
+        }
+    }
+    return settled;
+}
+
+
+template <typename _Queue>
+void run(const char* name, const graph& g, std::uint32_t max_weight) {
+    char label[96];
+    mystl::vector<std::uint64_t> dist(VERTICES);
+    std::uint64_t settled = 0;
+
+    double ms = bench::measure_ms([&] {
+        settled = dijkstra<_Queue>(g, dist);
+        bench::do_not_optimize(settled);
+    });
+    std::snprintf(label, sizeof(label), "%s weights<=%u", name, max_weight);
+    bench::report(label, settled, ms);
+}
+
+
+graph random_graph(std::uint32_t max_weight) {
+    std::mt19937 rng(7);
+    graph g;
+    g.offsets.reserve(VERTICES + 1);
+    for (std::uint32_t v = 0; v < VERTICES; ++v) {
+        g.offsets.push_back(v * DEGREE);
+        for (std::uint32_t k = 0; k < DEGREE; ++k) {
+            g.targets.push_back(std::uint32_t(rng() % VERTICES));
+            g.weights.push_back(std::uint32_t(1 + rng() % max_weight));
+        }
+    }
+    g.offsets.push_back(VERTICES * DEGREE);
+    return g;
+}
+
+}
+
+
+int main() {
+    using entry = std::pair<std::uint64_t, std::uint32_t>;
+    using binary_heap = mystl::priority_queue<entry, mystl::vector<entry>, std::greater<entry>>;
+    using radix_heap = mystl::radix_heap<std::uint64_t, std::uint32_t>;
+
+    for (std::uint32_t max_weight : {100u, 1'000'000u}) {
+        graph g = random_graph(max_weight);
+        run<binary_heap>("mystl::priority_queue", g, max_weight);
+        run<radix_heap>("mystl::radix_heap", g, max_weight);
+    }
+    return 0;
+}
@@ -0,0 +1,94 @@
+/**
+ * \file bench/bench_skiplist_map.cpp
+ *
+ * \brief Random insert, lookup, in-order scan and range scan: `skiplist_map`
+ * (at two level probabilities) versus `std::map`.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <random>
+
+#include "bench.hpp"
+#include "skiplist_map.hpp"
+#include "vector.hpp"
+
+
+namespace {
+
+constexpr std::size_t N = 200'000;
+
+
+template <typename _Map>
+void run(const char* name, const mystl::vector<int>& keys, _Map map) {
+    char label[96];
+
+    double ms = bench::measure_ms([&] {
+        map.clear();
+        for (std::size_t i = 0; i < keys.size(); ++i)
+            map[keys[i]] = int(i);
+        bench::do_not_optimize(map.size());
+    });
+    std::snprintf(label, sizeof(label), "%s insert", name);
+    bench::report(label, N, ms);
+
+    ms = bench::measure_ms([&] {
+        std::int64_t sum = 0;
+        for (std::size_t i = 0; i < keys.size(); ++i)
+            sum += map.find(keys[i])->second;
+        bench::do_not_optimize(sum);
+    });
+    std::snprintf(label, sizeof(label), "%s find", name);
+    bench::report(label, N, ms);
+
+    ms = bench::measure_ms([&] {
+        std::int64_t sum = 0;
+        for (const auto& kv : map)
+            sum += kv.second;
+        bench::do_not_optimize(sum);
+    });
+    std::snprintf(label, sizeof(label), "%s in-order scan", name);
+    bench::report(label, N, ms);
+
+    // short range scans starting at random keys
+    ms = bench::measure_ms([&] {
+        std::int64_t sum = 0;
+        for (std::size_t i = 0; i < keys.size(); i += 16) {
+            auto it = map.lower_bound(keys[i]);
+            for (int k = 0; k < 16 && it != map.end(); ++k, ++it)
+                sum += it->second;
+        }
+        bench::do_not_optimize(sum);
+    });
+    std::snprintf(label, sizeof(label), "%s lower_bound + 16", name);
+    bench::report(label, N / 16, ms);
+
+    // erase half, then refill: the skip list reuses its pooled nodes
+    ms = bench::measure_ms([&] {
+        for (std::size_t i = 0; i < keys.size(); i += 2)
+            map.erase(keys[i]);
+        for (std::size_t i = 0; i < keys.size(); i += 2)
+            map[keys[i]] = int(i);
+        bench::do_not_optimize(map.size());
+    });
+    std::snprintf(label, sizeof(label), "%s erase + reinsert half", name);
+    bench::report(label, N, ms);
+}
+
+}
+
+
+int main() {
+    std::mt19937 rng(7);
+    mystl::vector<int> keys;
+    keys.reserve(N);
+    for (std::size_t i = 0; i < N; ++i)
+        keys.push_back(int(rng()));
+
+    run("std::map", keys, std::map<int, int>());
+    run("mystl::skiplist_map p=1/4", keys, mystl::skiplist_map<int, int>(0.25));
+    run("mystl::skiplist_map p=1/2", keys, mystl::skiplist_map<int, int>(0.5));
+    return 0;
+}
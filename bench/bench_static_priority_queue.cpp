@@ -0,0 +1,97 @@
+/**
+ * \file bench/bench_static_priority_queue.cpp
+ *
+ * \brief Small bounded queues on a hot path, such as the k best candidates of
+ * a search step: `static_priority_queue` versus the `vector`-backed
+ * `priority_queue`, created per round or kept across rounds.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+
+#include "bench.hpp"
+#include "priority_queue.hpp"
+#include "static_priority_queue.hpp"
+#include "vector.hpp"
+
+
+namespace {
+
+constexpr std::size_t ROUNDS = 200'000;
+
+
+// keeps the `_N` smallest of `2 * _N` values, then drains them
+template <typename _Queue, std::size_t _N>
+std::int64_t round(_Queue& queue, const std::uint32_t* values) {
+    for (std::size_t i = 0; i < 2 * _N; ++i) {
+        if (queue.size() < _N) {
+            queue.push(values[i]);
+        } else if (values[i] < queue.top()) {
+            queue.pop();
+            queue.push(values[i]);
+        }
+    }
+    std::int64_t sum = 0;
+    while (!queue.empty()) {
+        sum += queue.top();
+        queue.pop();
+    }
+    return sum;
+}
+
+
+template <std::size_t _N>
+void run(const mystl::vector<std::uint32_t>& values) {
+    using dynamic_queue = mystl::priority_queue<std::uint32_t>;
+    using static_queue  = mystl::static_priority_queue<std::uint32_t, _N>;
+    std::size_t span = values.size() - 2 * _N;
+
+    // a fresh queue per round, as a function-local buffer
+    double ms = bench::measure_ms([&] {
+        std::int64_t sum = 0;
+        for (std::size_t r = 0; r < ROUNDS; ++r) {
+            dynamic_queue queue;
+            queue.reserve(_N);
+            sum += round<dynamic_queue, _N>(queue, values.data() + r % span);
+        }
+        bench::do_not_optimize(sum);
+    });
+    bench::report("priority_queue, fresh per round", _N, ms);
+
+    ms = bench::measure_ms([&] {
+        std::int64_t sum = 0;
+        dynamic_queue queue;
+        queue.reserve(_N);
+        for (std::size_t r = 0; r < ROUNDS; ++r)
+            sum += round<dynamic_queue, _N>(queue, values.data() + r % span);
+        bench::do_not_optimize(sum);
+    });
+    bench::report("priority_queue, kept across rounds", _N, ms);
+
+    ms = bench::measure_ms([&] {
+        std::int64_t sum = 0;
+        for (std::size_t r = 0; r < ROUNDS; ++r) {
+            static_queue queue;
+            sum += round<static_queue, _N>(queue, values.data() + r % span);
+        }
+        bench::do_not_optimize(sum);
+    });
+    bench::report("static_priority_queue, fresh per round", _N, ms);
+}
+
+}
+
+
+int main() {
+    std::mt19937 rng(3);
+    mystl::vector<std::uint32_t> values;
+    values.reserve(1 << 16);
+    for (std::size_t i = 0; i < (1 << 16); ++i)
+        values.push_back(rng());
+
+    run<8>(values);
+    run<32>(values);
+    run<128>(values);
+    return 0;
+}
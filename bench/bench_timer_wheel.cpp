@@ -0,0 +1,149 @@
+/**
+ * \file bench/bench_timer_wheel.cpp
+ *
+ * \brief Connection-timeout churn: `timer_wheel` versus a `priority_queue`
+ * of expiries with lazy cancellation. Every tick, a batch of connections sees
+ * activity and has its timeout pushed back (cancel + schedule), and the
+ * connections that went idle expire and are re-armed.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <random>
+
+#include "bench.hpp"
+#include "priority_queue.hpp"
+#include "timer_wheel.hpp"
+#include "vector.hpp"
+
+
+namespace {
+
+constexpr std::size_t   CONNECTIONS = 1'000'000;
+constexpr std::size_t   TICKS       = 2'000;
+constexpr std::size_t   RESETS      = 5'000;    // connections with activity per tick
+constexpr std::uint64_t TIMEOUT     = 3'000;    // ticks
+
+
+/**
+ * \brief The usual heap-based timer manager: cancelling bumps a per-connection
+ * generation and the stale heap entry is discarded when it surfaces.
+ */
+class heap_timers {
+    struct entry {
+        std::uint64_t expiry;
+        std::uint32_t id;
+        std::uint32_t generation;
+
+        bool operator>(const entry& other) const { return expiry > other.expiry; }
+    };
+
+public:
+    explicit heap_timers(std::size_t connections) : m_generation(connections, 0) {}
+
+    void schedule(std::uint64_t expiry, std::uint32_t id) {
+        m_heap.push(entry{expiry, id, m_generation[id]});
+    }
+
+    void reset(std::uint64_t expiry, std::uint32_t id) {
+        ++m_generation[id];
+        schedule(expiry, id);
+    }
+
+    template <typename _Fn>
+    std::size_t advance(std::uint64_t now, _Fn&& fn) {
+        std::size_t fired = 0;
+        while (!m_heap.empty() && m_heap.top().expiry <= now) {
+            entry e = m_heap.top();
+            m_heap.pop();
+            if (e.generation == m_generation[e.id]) {
+                fn(e.id);
+                ++fired;
+            }
+        }
+        return fired;
+    }
+
+    std::size_t size() const { return m_heap.size(); }
+
+private:
+    mystl::priority_queue<entry, mystl::vector<entry>, std::greater<entry>> m_heap;
+    mystl::vector<std::uint32_t> m_generation;
+};
+
+
+/**
+ * \brief The same interface over the wheel, keeping one handle per connection.
+ */
+class wheel_timers {
+public:
+    explicit wheel_timers(std::size_t connections) : m_handles(connections) {}
+
+    void schedule(std::uint64_t expiry, std::uint32_t id) {
+        m_handles[id] = m_wheel.schedule(expiry, id);
+    }
+
+    void reset(std::uint64_t expiry, std::uint32_t id) {
+        m_wheel.cancel(m_handles[id]);
+        schedule(expiry, id);
+    }
+
+    template <typename _Fn>
+    std::size_t advance(std::uint64_t now, _Fn&& fn) {
+        return m_wheel.advance(now, [&](std::uint32_t id) { fn(id); });
+    }
+
+    std::size_t size() const { return m_wheel.size(); }
+
+private:
+    mystl::timer_wheel<std::uint32_t> m_wheel;
+    mystl::vector<mystl::timer_wheel<std::uint32_t>::handle> m_handles;
+};
+
+
+template <typename _Timers>
+void run(const char* name, const mystl::vector<std::uint32_t>& activity, const mystl::vector<std::uint32_t>& timeouts) {
+    char label[96];
+    std::size_t fired = 0;
+
+    double ms = bench::measure_ms([&] {
+        _Timers timers(CONNECTIONS);
+        for (std::uint32_t id = 0; id < CONNECTIONS; ++id)
+            timers.schedule(1 + id % TIMEOUT, id);
+
+        //
+        fired = 0;
+        std::size_t next = 0;
+        for (std::uint64_t now = 1; now <= TICKS; ++now) {
+            for (std::size_t i = 0; i < RESETS; ++i)
+                timers.reset(now + timeouts[next], activity[next]), ++next;
+            fired += timers.advance(now, [&](std::uint32_t id) { timers.schedule(now + timeouts[id], id); });
+        }
+        bench::do_not_optimize(timers.size());
+    }, 3);
+    std::snprintf(label, sizeof(label), "%s %s", name, timeouts[0] == timeouts[1] ? "fixed timeout" : "random timeout");
+    bench::report(label, TICKS * RESETS + fired, ms);
+}
+
+}
+
+
+int main() {
+    std::mt19937 rng(7);
+    mystl::vector<std::uint32_t> activity, fixed, random;
+    activity.reserve(TICKS * RESETS);
+    for (std::size_t i = 0; i < TICKS * RESETS; ++i) {
+        activity.push_back(std::uint32_t(rng() % CONNECTIONS));
+        fixed.push_back(TIMEOUT);
+        random.push_back(std::uint32_t(1 + rng() % (2 * TIMEOUT)));
+    }
+
+    // a fixed timeout makes every push land at the heap's bottom, its best case
+    run<heap_timers>("mystl::priority_queue (lazy cancel)", activity, fixed);
+    run<wheel_timers>("mystl::timer_wheel", activity, fixed);
+    run<heap_timers>("mystl::priority_queue (lazy cancel)", activity, random);
+    run<wheel_timers>("mystl::timer_wheel", activity, random);
+    return 0;
+}
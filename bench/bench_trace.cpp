@@ -0,0 +1,80 @@
+/**
+ * \file bench/bench_trace.cpp
+ *
+ * \brief Traces `vector` growth, `list::sort` and `make_heap` and writes the
+ * timeline as Chrome trace JSON (to the path given as first argument, or
+ * `trace.json`); open it in chrome://tracing or ui.perfetto.dev. Also reports
+ * the cost of one traced scope.
+ */
+
+#define MYSTL_TRACE 1
+
+#include <cstddef>
+#include <cstdio>
+#include <random>
+
+#include "bench.hpp"
+#include "trace.hpp"
+#include "vector.hpp"
+#include "list.hpp"
+#include "algorithm/make_heap.hpp"
+
+
+namespace {
+
+constexpr std::size_t N = 1'000'000;
+
+
+/**
+ * \brief Best time of a begin/end pair, in nanoseconds.
+ */
+double scope_ns() {
+    constexpr std::size_t SCOPES = mystl::trace::buffer_events / 2 - 1;
+    double ms = bench::measure_ms([] {
+        mystl::trace::clear();
+        for (std::size_t i = 0; i < SCOPES; ++i)
+            mystl::trace::scope span("empty", i);
+    }, 20);
+    mystl::trace::clear();
+    return ms * 1e6 / SCOPES;
+}
+
+}
+
+
+int main(int argc, char** argv) {
+    const char* path = argc > 1 ? argv[1] : "trace.json";
+    mystl::trace::start();
+    std::printf("one traced scope: %.1f ns\n", scope_ns());
+
+    //
+    std::mt19937 rng(42);
+    mystl::vector<int> vec;
+    double ms = bench::measure_ms([&] {
+        vec = mystl::vector<int>();
+        for (std::size_t i = 0; i < N; ++i)
+            vec.push_back(static_cast<int>(rng()));
+    }, 1);
+    bench::report("vector::push_back, traced", N, ms);
+
+    //
+    ms = bench::measure_ms([&] {
+        mystl::make_heap(vec.begin(), vec.end());
+    }, 1);
+    bench::report("make_heap, traced", N, ms);
+
+    //
+    mystl::list<int> list(vec.cbegin(), vec.cend());
+    ms = bench::measure_ms([&] {
+        list.sort();
+    }, 1);
+    bench::report("list::sort, traced", N, ms);
+
+    //
+    if (!mystl::trace::write_chrome_json(path)) {
+        std::printf("cannot write %s\n", path);
+        return 1;
+    }
+    std::printf("trace written to %s\n", path);
+    return 0;
+}
@@ -0,0 +1,145 @@
+/**
+ * \file bench/bench_vector.cpp
+ */
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+
+#include "bench.hpp"
+#include "vector.hpp"
+
+
+namespace {
+
+
+/**
+ * \brief Stand-in for `read(fd, dst, n)`: copies up to `n` bytes of a large
+ * in-memory "file", so the benchmark measures buffer handling, not the kernel.
+ */
+struct fake_file {
+    mystl::vector<char> content;
+    std::size_t         offset = 0;
+
+    std::size_t read(char* dst, std::size_t n) {
+        std::size_t left = content.size() - offset;
+        std::size_t count = n < left ? n : left;
+        std::memcpy(dst, content.data() + offset, count);
+        offset += count;
+        return count;
+    }
+};
+
+
+constexpr std::size_t FILE_SIZE = 256 << 20;
+constexpr std::size_t CHUNK     = 1 << 20;
+
+
+/**
+ * \brief Reads the whole file by growing the buffer one chunk at a time.
+ */
+void bench_read_loop(fake_file& file) {
+    std::size_t total = 0;
+
+    //
+    double ms = bench::measure_ms([&] {
+        file.offset = 0;
+        mystl::vector<char> buf;
+        buf.reserve(FILE_SIZE);
+        while (true) {
+            std::size_t old = buf.size();
+            buf.resize(old + CHUNK);                      // zero-fills the chunk first
+            std::size_t got = file.read(buf.data() + old, CHUNK);
+            buf.resize(old + got);
+            if (got == 0)
+                break;
+        }
+        total = buf.size();
+        bench::do_not_optimize(buf.data());
+    });
+    bench::report("read loop: resize", total, ms);
+
+    //
+    ms = bench::measure_ms([&] {
+        file.offset = 0;
+        mystl::vector<char> buf;
+        buf.reserve(FILE_SIZE);
+        while (true) {
+            std::size_t old = buf.size();
+            buf.resize_for_overwrite(old + CHUNK);
+            std::size_t got = file.read(buf.data() + old, CHUNK);
+            buf.resize_for_overwrite(old + got);
+            if (got == 0)
+                break;
+        }
+        total = buf.size();
+        bench::do_not_optimize(buf.data());
+    });
+    bench::report("read loop: resize_for_overwrite", total, ms);
+
+    //
+    ms = bench::measure_ms([&] {
+        file.offset = 0;
+        mystl::vector<char> buf;
+        buf.reserve(FILE_SIZE);
+        std::size_t got = 0;
+        do {
+            std::size_t old = buf.size();
+            buf.resize_and_overwrite(old + CHUNK, [&](char* p, std::size_t) {
+                got = file.read(p + old, CHUNK);
+                return old + got;
+            });
+        } while (got != 0);
+        total = buf.size();
+        bench::do_not_optimize(buf.data());
+    });
+    bench::report("read loop: resize_and_overwrite", total, ms);
+}
+
+
+
+/**
+ * \brief Copy construction and copy assignment of full and mostly-empty vectors.
+ */
+template <typename _T>
+void bench_copy(const char* name, const _T& value, std::size_t size, std::size_t capacity) {
+    mystl::vector<_T> src;
+    src.reserve(capacity);
+    for (std::size_t i = 0; i < size; ++i)
+        src.push_back(value);
+
+    std::size_t copiedCapacity = 0;
+    double ms = bench::measure_ms([&] {
+        for (int r = 0; r < 100; ++r) {
+            mystl::vector<_T> copy(src);
+            copiedCapacity = copy.capacity();
+            bench::do_not_optimize(copy.data());
+        }
+    });
+    bench::report((std::string(name) + " copy-construct x100").c_str(), size, ms);
+
+    mystl::vector<_T> dst;
+    ms = bench::measure_ms([&] {
+        for (int r = 0; r < 100; ++r) {
+            dst = src;
+            bench::do_not_optimize(dst.data());
+        }
+    });
+    bench::report((std::string(name) + " copy-assign x100").c_str(), size, ms);
+    std::printf("    source capacity %zu, copy capacity %zu\n", src.capacity(), copiedCapacity);
+}
+
+}
+
+
+int main() {
+    fake_file file;
+    file.content.resize(FILE_SIZE, 'x');
+
+    bench_read_loop(file);
+
+    bench_copy<int>("vector<int> full", 42, 1 << 20, 1 << 20);
+    bench_copy<int>("vector<int> mostly empty", 42, 16, 1 << 20);
+    bench_copy<std::string>("vector<string> full", std::string("payload"), 1 << 16, 1 << 16);
+    return 0;
+}
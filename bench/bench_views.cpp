@@ -0,0 +1,83 @@
+/**
+ * \file bench/bench_views.cpp
+ *
+ * \brief Lazy view pipelines versus materializing every intermediate stage.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "bench.hpp"
+#include "views.hpp"
+#include "vector.hpp"
+#include "list.hpp"
+
+
+namespace {
+
+constexpr std::size_t N = 1'000'000;
+
+bool is_even(int x) { return x % 2 == 0; }
+std::int64_t triple(int x) { return std::int64_t(x) * 3; }
+
+
+/**
+ * \brief filter -> transform -> sum, building a container at each stage.
+ */
+template <typename _Container>
+std::int64_t materialized(const _Container& src) {
+    mystl::vector<int> filtered;
+    for (auto it = src.cbegin(); it != src.cend(); ++it)
+        if (is_even(*it))
+            filtered.push_back(*it);
+
+    mystl::vector<std::int64_t> mapped;
+    for (auto it = filtered.cbegin(); it != filtered.cend(); ++it)
+        mapped.push_back(triple(*it));
+
+    std::int64_t sum = 0;
+    for (auto it = mapped.cbegin(); it != mapped.cend(); ++it)
+        sum += *it;
+    return sum;
+}
+
+
+/**
+ * \brief filter -> transform -> sum through views.
+ */
+template <typename _Container>
+std::int64_t lazy(const _Container& src) {
+    std::int64_t sum = 0;
+    for (std::int64_t x : src | mystl::views::filter(is_even) | mystl::views::transform(triple))
+        sum += x;
+    return sum;
+}
+
+
+template <typename _Container>
+void run(const char* name, const _Container& src) {
+    std::int64_t result = 0;
+
+    double ms = bench::measure_ms([&] { result = materialized(src); bench::do_not_optimize(result); });
+    bench::report((std::string(name) + " materialized").c_str(), N, ms);
+
+    ms = bench::measure_ms([&] { result = lazy(src); bench::do_not_optimize(result); });
+    bench::report((std::string(name) + " views").c_str(), N, ms);
+}
+
+}
+
+
+int main() {
+    mystl::vector<int> vec;
+    mystl::list<int> lst;
+    for (std::size_t i = 0; i < N; ++i) {
+        vec.push_back(int(i));
+        lst.push_back(int(i));
+    }
+
+    run("vector filter|transform|sum", vec);
+    run("list filter|transform|sum", lst);
+    return 0;
+}
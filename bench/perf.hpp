@@ -0,0 +1,274 @@
+/**
+ * \file bench/perf.hpp
+ *
+ * \brief Hardware event counts for the benchmark executables, read with
+ * Linux `perf_event_open`.
+ *
+ * Every event is opened on its own, so a machine or VM that lacks some of
+ * them (or all: containers, `perf_event_paranoid` > 2, other systems) still
+ * counts the rest, and reports the missing ones as `n/a`. Only the calling
+ * thread is counted, in user space.
+ */
+
+#pragma once
+
+#ifndef BENCH_PERF_HPP_
+#define BENCH_PERF_HPP_
+
+#include <cstddef>    // size_t
+#include <cstdint>    // uint64_t
+#include <cstdio>     // printf
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+
+namespace bench {
+
+
+/**
+ * \brief The counted events, in report order.
+ */
+enum class perf_event : std::size_t {
+    cycles,
+    instructions,
+    l1d_misses,
+    llc_misses,
+    branch_misses,
+    dtlb_misses,
+    task_clock_ns,   // a software event, available wherever perf_event_open is
+    count
+};
+
+
+/**
+ * \class perf_counters
+ *
+ * \brief Counts the events of `perf_event` between `start()` and `stop()`;
+ * the counts accumulate until `reset()`.
+ */
+class perf_counters {
+public:
+    static constexpr std::size_t COUNT = static_cast<std::size_t>(perf_event::count);
+
+    /**
+     * \brief Opens the counters, disabled.
+     */
+    perf_counters() {
+        for (std::size_t i = 0; i < COUNT; ++i)
+            m_fd[i] = open(static_cast<perf_event>(i));
+    }
+
+    ~perf_counters() {
+#if defined(__linux__)
+        for (int fd : m_fd) {
+            if (fd >= 0)
+                close(fd);
+        }
+#endif
+    }
+
+    perf_counters(const perf_counters&) = delete;
+    perf_counters& operator=(const perf_counters&) = delete;
+
+
+    /**
+     * \brief Whether the event could be opened.
+     */
+    bool available(perf_event e) const noexcept { return m_fd[static_cast<std::size_t>(e)] >= 0; }
+
+
+    /**
+     * \brief Whether any event could be opened.
+     */
+    bool any_available() const noexcept {
+        for (int fd : m_fd) {
+            if (fd >= 0)
+                return true;
+        }
+        return false;
+    }
+
+
+    /**
+     */
+    void reset() {
+        for (std::size_t i = 0; i < COUNT; ++i) {
+            m_value[i] = 0;
+            m_scaled[i] = false;
+        }
+    }
+
+
+    /**
+     * \brief Starts counting.
+     */
+    void start() {
+#if defined(__linux__)
+        for (std::size_t i = 0; i < COUNT; ++i) {
+            if (m_fd[i] >= 0) {
+                ioctl(m_fd[i], PERF_EVENT_IOC_RESET, 0);
+                ioctl(m_fd[i], PERF_EVENT_IOC_ENABLE, 0);
+            }
+        }
+#endif
+    }
+
+
+    /**
+     * \brief Stops counting and adds the counts since `start()`.
+     *
+     * When the kernel had to multiplex the hardware counters, the counts are
+     * scaled up from the time each event was actually counted.
+     */
+    void stop() {
+#if defined(__linux__)
+        for (std::size_t i = 0; i < COUNT; ++i) {
+            if (m_fd[i] >= 0)
+                ioctl(m_fd[i], PERF_EVENT_IOC_DISABLE, 0);
+        }
+        for (std::size_t i = 0; i < COUNT; ++i) {
+            std::uint64_t data[3];   // value, time enabled, time running
+            if (m_fd[i] < 0 || read(m_fd[i], data, sizeof(data)) != sizeof(data))
+                continue;
+            if (data[2] != 0 && data[2] < data[1]) {
+                data[0] = static_cast<std::uint64_t>(double(data[0]) * double(data[1]) / double(data[2]));
+                m_scaled[i] = true;
+            }
+            m_value[i] += data[0];
+        }
+#endif
+    }
+
+
+    /**
+     * \brief The accumulated count of `e`; 0 if it is not available.
+     */
+    std::uint64_t value(perf_event e) const noexcept { return m_value[static_cast<std::size_t>(e)]; }
+
+
+    /**
+     * \brief Whether a count of `e` was estimated from multiplexing.
+     */
+    bool scaled(perf_event e) const noexcept { return m_scaled[static_cast<std::size_t>(e)]; }
+
+
+    /**
+     * \brief Short name of `e` for the reports.
+     */
+    static const char* name(perf_event e) noexcept {
+        static constexpr const char* names[COUNT] = {
+            "cycles", "instr", "L1d-miss", "LLC-miss", "br-miss", "dTLB-miss", "ns"
+        };
+        return names[static_cast<std::size_t>(e)];
+    }
+
+
+/**/
+private:
+    /**
+     * \brief Opens one event for the calling thread; returns -1 if it is unavailable.
+     */
+    static int open([[maybe_unused]] perf_event e) {
+#if defined(__linux__)
+        perf_event_attr attr{};
+        attr.size = sizeof(attr);
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+        //
+        auto cache = [](std::uint64_t cache_id, std::uint64_t op) {
+            return cache_id | (op << 8) | (std::uint64_t(PERF_COUNT_HW_CACHE_RESULT_MISS) << 16);
+        };
+        switch (e) {
+        case perf_event::cycles:
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = PERF_COUNT_HW_CPU_CYCLES;
+            break;
+        case perf_event::instructions:
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+            break;
+        case perf_event::l1d_misses:
+            attr.type = PERF_TYPE_HW_CACHE;
+            attr.config = cache(PERF_COUNT_HW_CACHE_L1D, PERF_COUNT_HW_CACHE_OP_READ);
+            break;
+        case perf_event::llc_misses:
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = PERF_COUNT_HW_CACHE_MISSES;
+            break;
+        case perf_event::branch_misses:
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+            break;
+        case perf_event::dtlb_misses:
+            attr.type = PERF_TYPE_HW_CACHE;
+            attr.config = cache(PERF_COUNT_HW_CACHE_DTLB, PERF_COUNT_HW_CACHE_OP_READ);
+            break;
+        case perf_event::task_clock_ns:
+            attr.type = PERF_TYPE_SOFTWARE;
+            attr.config = PERF_COUNT_SW_TASK_CLOCK;
+            break;
+        default:
+            return -1;
+        }
+        long fd = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+        return fd < 0 ? -1 : static_cast<int>(fd);
+#else
+        return -1;
+#endif
+    }
+
+
+/**/
+private:
+    int           m_fd[COUNT];
+    std::uint64_t m_value[COUNT] = {};
+    bool          m_scaled[COUNT] = {};
+};
+
+
+/**
+ * \brief Runs `fn` `repeat` times under `counters`, which are reset first, so
+ * they hold the totals of all runs afterwards.
+ */
+template <typename _Fn>
+void measure_perf(perf_counters& counters, _Fn&& fn, std::size_t repeat = 5) {
+    counters.reset();
+    for (std::size_t i = 0; i < repeat; ++i) {
+        counters.start();
+        fn();
+        counters.stop();
+    }
+}
+
+
+/**
+ * \brief Prints one result line: `<name>` and every event per operation,
+ * where `ops` is the number of operations of all runs together. Estimated
+ * counts are marked with `~`, unavailable ones shown as `n/a`.
+ */
+inline void report_perf(const char* name, const perf_counters& counters, std::size_t ops) {
+    std::printf("%-40s", name);
+    for (std::size_t i = 0; i < perf_counters::COUNT; ++i) {
+        perf_event e = static_cast<perf_event>(i);
+        if (counters.available(e))
+            std::printf(" %9s %s%-8.2f", perf_counters::name(e), counters.scaled(e) ? "~" : "",
+                        double(counters.value(e)) / double(ops));
+        else
+            std::printf(" %9s %-8s", perf_counters::name(e), "n/a");
+    }
+    std::printf("\n");
+}
+
+
+} // namespace bench::
+
+
+#endif // BENCH_PERF_HPP_
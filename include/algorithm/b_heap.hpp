@@ -0,0 +1,269 @@
+/**
+ * \file algorithm/b_heap.hpp
+ *
+ * \reference:
+ * - P.-H. Kamp: You're Doing It Wrong (ACM Queue, 2010)
+ */
+
+#pragma once
+
+#ifndef ALGORITHM_B_HEAP_HPP_
+#define ALGORITHM_B_HEAP_HPP_
+
+#include <bit>         // bit_width
+#include <cstddef>     // size_t
+#include <functional>  // less
+#include <iterator>
+#include <algorithm>   // for iter_swap   TODO: implement my own iter_swap someday for avoid cyclic dependencies.
+
+#include "instrument.hpp"   // instrument::add
+
+namespace mystl {
+
+
+/**
+ * A B-heap is a binary heap whose nodes are stored page by page instead of
+ * level by level. Each page holds a complete subtree of `H` levels, that is
+ * `S = 2^H - 1` nodes, and the children of the subtree's bottom nodes are the
+ * roots of further pages. A root-to-leaf path thus crosses one page every `H`
+ * levels instead of one page per level below the first few, which is what
+ * keeps `pop` of a heap far larger than the caches (or than RAM) from touching
+ * log2(n) distinct pages.
+ *
+ * Pages are filled in breadth-first order, so the nodes of a heap of `n`
+ * elements are exactly the positions [0, n) and the root is at position 0,
+ * as for the plain binary heap.
+ */
+
+
+/**
+ * \brief Shape of the pages of a B-heap whose elements are `_ElemBytes` large
+ * and whose pages are `_PageBytes` large.
+ */
+template <std::size_t _ElemBytes, std::size_t _PageBytes>
+struct __b_heap_page {
+    static_assert(_ElemBytes > 0 && _PageBytes > 0, "b_heap: empty elements or pages");
+
+    // levels of the subtree in a page, at least one so that a page holds one node
+    static constexpr std::size_t HEIGHT = _PageBytes / _ElemBytes >= 1
+                                        ? std::bit_width(_PageBytes / _ElemBytes + 1) - 1 : 1;
+    // nodes in a page
+    static constexpr std::size_t SIZE   = (std::size_t(1) << HEIGHT) - 1;
+    // position of the first bottom node in a page
+    static constexpr std::size_t BOTTOM = (std::size_t(1) << (HEIGHT - 1)) - 1;
+    // child pages of a page, two per bottom node
+    static constexpr std::size_t FANOUT = std::size_t(1) << HEIGHT;
+
+
+    /**
+     * \brief Returns the position of the parent of `pos`, which must not be 0.
+     */
+    template <typename _Diff>
+    static constexpr _Diff parent(_Diff pos) noexcept {
+        _Diff page = pos / _Diff(SIZE);
+        _Diff slot = pos % _Diff(SIZE);
+        if (slot != 0)
+            return page * _Diff(SIZE) + (slot - 1) / 2;
+
+        // the root of a page hangs off a bottom node of the parent page
+        _Diff rank = page - 1;
+        return (rank / _Diff(FANOUT)) * _Diff(SIZE) + _Diff(BOTTOM) + (rank % _Diff(FANOUT)) / 2;
+    }
+
+
+    /**
+     * \brief Returns the position of the first child of `pos` and sets
+     * `stride` to the distance to the second child.
+     */
+    template <typename _Diff>
+    static constexpr _Diff first_child(_Diff pos, _Diff& stride) noexcept {
+        _Diff page = pos / _Diff(SIZE);
+        _Diff slot = pos - page * _Diff(SIZE);
+        if (slot < _Diff(BOTTOM)) {
+            stride = 1;
+            return pos + slot + 1;
+        }
+        stride = _Diff(SIZE);
+        return (page * _Diff(FANOUT) + 1 + 2 * (slot - _Diff(BOTTOM))) * _Diff(SIZE);
+    }
+};
+
+
+/**
+ * \brief The page shape used for the elements of `_RandomAccessIter`.
+ */
+template <typename _RandomAccessIter, std::size_t _PageBytes>
+using __b_heap_page_for = __b_heap_page<sizeof(typename std::iterator_traits<_RandomAccessIter>::value_type), _PageBytes>;
+
+
+/**
+ * \brief Moves the element at `pos` down until the B-heap property holds in
+ * its subtree.
+ */
+template <std::size_t _PageBytes, typename _RandomAccessIter, typename _Compare>
+void __b_heap_sift_down(_RandomAccessIter first, _Compare comp,
+        typename std::iterator_traits<_RandomAccessIter>::difference_type len,
+        typename std::iterator_traits<_RandomAccessIter>::difference_type pos)
+{
+    //
+    using difference_type = typename std::iterator_traits<_RandomAccessIter>::difference_type;
+    using page = __b_heap_page_for<_RandomAccessIter, _PageBytes>;
+
+    while (true) {
+        difference_type stride;
+        difference_type left = page::first_child(pos, stride);
+        if (left >= len)
+            return;
+
+        //
+        difference_type largest = left;
+        difference_type right = left + stride;
+        if (right < len && comp(*(first + left), *(first + right)))
+            largest = right;
+
+        //
+        if (!comp(*(first + pos), *(first + largest)))
+            return;
+        std::iter_swap(first + pos, first + largest);
+        instrument::add(instrument::event::heap_sift_levels);
+        pos = largest;
+    }
+}
+
+
+/**
+ * \brief Integrates the element at `last - 1` into the B-heap [first, last - 1).
+ *
+ * \tparam _PageBytes: Size of a page in bytes; must be the same for every
+ *         operation on one heap.
+ * \tparam _RandomAccessIter: Type of the iterator used, must support random
+ *         access to elements (e.g., iterators of std::vector).
+ * \tparam _Compare: Type of the comparison functor that determines the heap
+ *         order.
+ *
+ * \param first: Iterator to the beginning of the range of the heap.
+ * \param last: Iterator past the newly added element.
+ * \param comp: Comparison functor that defines the heap order.
+ */
+template <std::size_t _PageBytes = 4096, typename _RandomAccessIter, typename _Compare>
+void push_b_heap(_RandomAccessIter first, _RandomAccessIter last, _Compare comp) {
+    //
+    using difference_type = typename std::iterator_traits<_RandomAccessIter>::difference_type;
+    using page = __b_heap_page_for<_RandomAccessIter, _PageBytes>;
+
+    //
+    difference_type child = (last - first) - 1;
+    while (child > 0) {
+        difference_type parent = page::parent(child);
+        if (!comp(*(first + parent), *(first + child)))
+            return;
+        std::iter_swap(first + parent, first + child);
+        instrument::add(instrument::event::heap_sift_levels);
+        child = parent;
+    }
+}
+
+
+/**
+ * \brief Overload function of `push_b_heap` to use max heap by default.
+ */
+template <std::size_t _PageBytes = 4096, typename _RandomAccessIter>
+void push_b_heap(_RandomAccessIter first, _RandomAccessIter last) {
+    using value_type = typename std::iterator_traits<_RandomAccessIter>::value_type;
+    return mystl::push_b_heap<_PageBytes>(first, last, std::less<value_type>());
+}
+
+
+/**
+ * \brief Moves the top element of the B-heap [first, last) to `last - 1` and
+ * makes [first, last - 1) a B-heap.
+ *
+ * \param first: Iterator to the beginning of the range of the heap.
+ * \param last: Iterator of the end of the range of the heap.
+ * \param comp: Comparison functor that defines the heap order.
+ */
+template <std::size_t _PageBytes = 4096, typename _RandomAccessIter, typename _Compare>
+void pop_b_heap(_RandomAccessIter first, _RandomAccessIter last, _Compare comp) {
+    //
+    if (last - first <= 1)
+        return;
+
+    //
+    std::iter_swap(first, --last);
+    __b_heap_sift_down<_PageBytes>(first, comp, last - first, 0);
+}
+
+
+/**
+ * \brief Overload function of `pop_b_heap` to use max heap by default.
+ */
+template <std::size_t _PageBytes = 4096, typename _RandomAccessIter>
+void pop_b_heap(_RandomAccessIter first, _RandomAccessIter last) {
+    using value_type = typename std::iterator_traits<_RandomAccessIter>::value_type;
+    return mystl::pop_b_heap<_PageBytes>(first, last, std::less<value_type>());
+}
+
+
+/**
+ * \brief Rearranges [first, last) into a B-heap in O(n).
+ *
+ * \param first: Iterator pointing to the start of the range to be heapified.
+ * \param last: Iterator pointing past the end of the range to be heapified.
+ * \param comp: Comparison functor that defines the heap order.
+ */
+template <std::size_t _PageBytes = 4096, typename _RandomAccessIter, typename _Compare>
+void make_b_heap(_RandomAccessIter first, _RandomAccessIter last, _Compare comp) {
+    //
+    using difference_type = typename std::iterator_traits<_RandomAccessIter>::difference_type;
+    difference_type len = last - first;
+
+    // children always sit after their parent, but the inner nodes are not a
+    // prefix of the range as in a binary heap, so every position is visited
+    for (difference_type pos = len - 1; pos >= 0; --pos) {
+        __b_heap_sift_down<_PageBytes>(first, comp, len, pos);
+    }
+}
+
+
+/**
+ * \brief Overload function of `make_b_heap` to use max heap by default.
+ */
+template <std::size_t _PageBytes = 4096, typename _RandomAccessIter>
+void make_b_heap(_RandomAccessIter first, _RandomAccessIter last) {
+    using value_type = typename std::iterator_traits<_RandomAccessIter>::value_type;
+    return mystl::make_b_heap<_PageBytes>(first, last, std::less<value_type>());
+}
+
+
+/**
+ * \brief Checks whether [first, last) is a B-heap.
+ */
+template <std::size_t _PageBytes = 4096, typename _RandomAccessIter, typename _Compare>
+bool is_b_heap(_RandomAccessIter first, _RandomAccessIter last, _Compare comp) {
+    //
+    using difference_type = typename std::iterator_traits<_RandomAccessIter>::difference_type;
+    using page = __b_heap_page_for<_RandomAccessIter, _PageBytes>;
+
+    //
+    difference_type len = last - first;
+    for (difference_type pos = 1; pos < len; ++pos) {
+        if (comp(*(first + page::parent(pos)), *(first + pos)))
+            return false;
+    }
+    return true;
+}
+
+
+/**
+ * \brief Overload function of `is_b_heap` to use max heap by default.
+ */
+template <std::size_t _PageBytes = 4096, typename _RandomAccessIter>
+bool is_b_heap(_RandomAccessIter first, _RandomAccessIter last) {
+    using value_type = typename std::iterator_traits<_RandomAccessIter>::value_type;
+    return mystl::is_b_heap<_PageBytes>(first, last, std::less<value_type>());
+}
+
+
+} // namespace mystl::
+
+#endif // ALGORITHM_B_HEAP_HPP_
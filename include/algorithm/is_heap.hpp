@@ -34,7 +34,7 @@ namespace mystl {
  *         by 'comp'; otherwise, returns `false`.
  */
 template <typename _RandomAccessIter, typename _Compare>
-bool is_heap(_RandomAccessIter first, _RandomAccessIter last, _Compare comp) {
+constexpr bool is_heap(_RandomAccessIter first, _RandomAccessIter last, _Compare comp) {
     //
     using difference_type = typename std::iterator_traits<_RandomAccessIter>::difference_type;
 
@@ -67,7 +67,7 @@ bool is_heap(_RandomAccessIter first, _RandomAccessIter last, _Compare comp) {
  *         otherwise, returns `false`.
  */
 template <typename _RandomAccessIter>
-bool is_heap(_RandomAccessIter first, _RandomAccessIter last) {
+constexpr bool is_heap(_RandomAccessIter first, _RandomAccessIter last) {
     using value_type = typename std::iterator_traits<_RandomAccessIter>::value_type;
     return mystl::is_heap(first, last, std::less<value_type>());
 }
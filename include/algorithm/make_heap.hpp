@@ -9,6 +9,7 @@
 
 #include <iterator>
 #include "algorithm/pop_heap.hpp"   // for __heapify()
+#include "trace.hpp"                // trace::scope
 
 namespace mystl {
 
@@ -28,7 +29,7 @@ namespace mystl {
  * \param last: Iterator pointing past the end of the range to be heapified.
  */
 template <typename _RandomAccessIter, typename _Compare>
-void make_heap(_RandomAccessIter first, _RandomAccessIter last, _Compare comp) {
+constexpr void make_heap(_RandomAccessIter first, _RandomAccessIter last, _Compare comp) {
     // 
     using difference_type = typename std::iterator_traits<_RandomAccessIter>::difference_type;
     difference_type len = last - first;
@@ -38,6 +39,7 @@ void make_heap(_RandomAccessIter first, _RandomAccessIter last, _Compare comp) {
         return;
 
     // 
+    trace::scope span("make_heap", static_cast<std::uint64_t>(len));
     for (difference_type start = len / 2 - 1; start >= 0; --start) {
         __heapify(first, comp, len, first + start);
     }
@@ -51,7 +53,7 @@ void make_heap(_RandomAccessIter first, _RandomAccessIter last, _Compare comp) {
  *         access to elements (e.g., iterators of std::vector).
  */
 template <typename _RandomAccessIter>
-void make_heap(_RandomAccessIter first, _RandomAccessIter last) {
+constexpr void make_heap(_RandomAccessIter first, _RandomAccessIter last) {
     using value_type = typename std::iterator_traits<_RandomAccessIter>::value_type;
     return mystl::make_heap(first, last, std::less<value_type>());
 }
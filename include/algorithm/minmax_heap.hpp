@@ -0,0 +1,332 @@
+/**
+ * \file algorithm/minmax_heap.hpp
+ *
+ * \reference:
+ * - M. D. Atkinson, J.-R. Sack, N. Santoro, T. Strothotte: Min-Max Heaps and
+ *   Generalized Priority Queues
+ */
+
+#pragma once
+
+#ifndef ALGORITHM_MINMAX_HEAP_HPP_
+#define ALGORITHM_MINMAX_HEAP_HPP_
+
+#include <bit>         // bit_width
+#include <functional>  // less
+#include <iterator>
+#include <algorithm>   // for iter_swap   TODO: implement my own iter_swap someday for avoid cyclic dependencies.
+
+#include "instrument.hpp"   // instrument::add
+
+namespace mystl {
+
+
+/**
+ * A min-max heap is a complete binary tree laid out like a binary heap, whose
+ * levels alternate between min levels (even depth, starting with the root)
+ * and max levels. Every element on a min level is not greater than all of its
+ * descendants, every element on a max level not less. The smallest element
+ * is therefore the root, and the largest one of the root's two children.
+ */
+
+
+/**
+ * \brief Checks whether index `idx` lies on a min level.
+ */
+template <typename _Diff>
+constexpr bool __minmax_is_min_level(_Diff idx) noexcept {
+    return (std::bit_width(static_cast<unsigned long long>(idx) + 1) & 1) == 1;
+}
+
+
+/**
+ * \brief Moves the element at `idx` down until the min-max heap property
+ * holds in its subtree; `before` orders as `comp` on min levels and reversed
+ * on max levels.
+ */
+template <typename _RandomAccessIter, typename _Before>
+void __minmax_trickle_down(_RandomAccessIter first,
+        typename std::iterator_traits<_RandomAccessIter>::difference_type len,
+        typename std::iterator_traits<_RandomAccessIter>::difference_type idx, _Before before)
+{
+    //
+    using difference_type = typename std::iterator_traits<_RandomAccessIter>::difference_type;
+
+    while (2 * idx + 1 < len) {
+        // the first among the children and grandchildren
+        difference_type best = 2 * idx + 1;
+        if (best + 1 < len && before(*(first + best + 1), *(first + best)))
+            best = best + 1;
+        for (difference_type g = 4 * idx + 3; g < 4 * idx + 7 && g < len; ++g) {
+            if (before(*(first + g), *(first + best)))
+                best = g;
+        }
+
+        //
+        if (!before(*(first + best), *(first + idx)))
+            return;
+        std::iter_swap(first + best, first + idx);
+        if (best <= 2 * idx + 2) {
+            instrument::add(instrument::event::heap_sift_levels);
+            return;
+        }
+        instrument::add(instrument::event::heap_sift_levels, 2);
+
+        // a grandchild moved up; the element that went down may belong on the level between
+        difference_type parent = (best - 1) / 2;
+        if (before(*(first + parent), *(first + best)))
+            std::iter_swap(first + parent, first + best);
+        idx = best;
+    }
+}
+
+
+/**
+ * \brief Moves the element at `idx` up along the levels of its own kind;
+ * `before` orders as in `__minmax_trickle_down`.
+ */
+template <typename _RandomAccessIter, typename _Before>
+void __minmax_bubble_up_grandparents(_RandomAccessIter first,
+        typename std::iterator_traits<_RandomAccessIter>::difference_type idx, _Before before)
+{
+    //
+    using difference_type = typename std::iterator_traits<_RandomAccessIter>::difference_type;
+
+    while (idx > 2) {
+        difference_type grandparent = ((idx - 1) / 2 - 1) / 2;
+        if (!before(*(first + idx), *(first + grandparent)))
+            return;
+        std::iter_swap(first + idx, first + grandparent);
+        instrument::add(instrument::event::heap_sift_levels, 2);
+        idx = grandparent;
+    }
+}
+
+
+/**
+ * \brief Restores the min-max heap property for the element at `idx`, whose
+ * value may have changed arbitrarily.
+ */
+template <typename _RandomAccessIter, typename _Compare>
+void __minmax_sift(_RandomAccessIter first,
+        typename std::iterator_traits<_RandomAccessIter>::difference_type len,
+        typename std::iterator_traits<_RandomAccessIter>::difference_type idx, _Compare comp)
+{
+    auto less_first = [&comp](const auto& a, const auto& b) { return comp(a, b); };
+    auto greater_first = [&comp](const auto& a, const auto& b) { return comp(b, a); };
+    if (__minmax_is_min_level(idx))
+        __minmax_trickle_down(first, len, idx, less_first);
+    else
+        __minmax_trickle_down(first, len, idx, greater_first);
+}
+
+
+/**
+ * \brief Integrates the element at `last - 1` into the min-max heap
+ * [first, last - 1).
+ *
+ * \tparam _RandomAccessIter: Type of the iterator used, must support random
+ *         access to elements (e.g., iterators of std::vector).
+ * \tparam _Compare: Type of the comparison functor that orders the elements.
+ *
+ * \param first: Iterator to the beginning of the range of the heap.
+ * \param last: Iterator past the newly added element.
+ * \param comp: Comparison functor that orders the elements.
+ */
+template <typename _RandomAccessIter, typename _Compare>
+void push_minmax_heap(_RandomAccessIter first, _RandomAccessIter last, _Compare comp) {
+    //
+    using difference_type = typename std::iterator_traits<_RandomAccessIter>::difference_type;
+
+    //
+    difference_type idx = (last - first) - 1;
+    if (idx <= 0)
+        return;
+
+    //
+    auto less_first = [&comp](const auto& a, const auto& b) { return comp(a, b); };
+    auto greater_first = [&comp](const auto& a, const auto& b) { return comp(b, a); };
+    difference_type parent = (idx - 1) / 2;
+    if (__minmax_is_min_level(idx)) {
+        if (comp(*(first + parent), *(first + idx))) {
+            std::iter_swap(first + parent, first + idx);
+            __minmax_bubble_up_grandparents(first, parent, greater_first);
+        } else {
+            __minmax_bubble_up_grandparents(first, idx, less_first);
+        }
+    } else {
+        if (comp(*(first + idx), *(first + parent))) {
+            std::iter_swap(first + parent, first + idx);
+            __minmax_bubble_up_grandparents(first, parent, less_first);
+        } else {
+            __minmax_bubble_up_grandparents(first, idx, greater_first);
+        }
+    }
+}
+
+
+/**
+ * \brief Overload function of `push_minmax_heap` ordering by `std::less`.
+ */
+template <typename _RandomAccessIter>
+void push_minmax_heap(_RandomAccessIter first, _RandomAccessIter last) {
+    using value_type = typename std::iterator_traits<_RandomAccessIter>::value_type;
+    return mystl::push_minmax_heap(first, last, std::less<value_type>());
+}
+
+
+/**
+ * \brief Returns an iterator to the largest element of the min-max heap
+ * [first, last), or `first` for a heap of at most one element.
+ */
+template <typename _RandomAccessIter, typename _Compare>
+_RandomAccessIter minmax_heap_max(_RandomAccessIter first, _RandomAccessIter last, _Compare comp) {
+    //
+    auto len = last - first;
+    if (len <= 1)
+        return first;
+    if (len == 2 || !comp(*(first + 1), *(first + 2)))
+        return first + 1;
+    return first + 2;
+}
+
+
+/**
+ * \brief Overload function of `minmax_heap_max` ordering by `std::less`.
+ */
+template <typename _RandomAccessIter>
+_RandomAccessIter minmax_heap_max(_RandomAccessIter first, _RandomAccessIter last) {
+    using value_type = typename std::iterator_traits<_RandomAccessIter>::value_type;
+    return mystl::minmax_heap_max(first, last, std::less<value_type>());
+}
+
+
+/**
+ * \brief Moves the smallest element of the min-max heap [first, last) to
+ * `last - 1` and makes [first, last - 1) a min-max heap.
+ *
+ * \param first: Iterator to the beginning of the range of the heap.
+ * \param last: Iterator of the end of the range of the heap.
+ * \param comp: Comparison functor that orders the elements.
+ */
+template <typename _RandomAccessIter, typename _Compare>
+void pop_min(_RandomAccessIter first, _RandomAccessIter last, _Compare comp) {
+    //
+    if (last - first <= 1)
+        return;
+
+    //
+    std::iter_swap(first, --last);
+    __minmax_sift(first, last - first, 0, comp);
+}
+
+
+/**
+ * \brief Overload function of `pop_min` ordering by `std::less`.
+ */
+template <typename _RandomAccessIter>
+void pop_min(_RandomAccessIter first, _RandomAccessIter last) {
+    using value_type = typename std::iterator_traits<_RandomAccessIter>::value_type;
+    return mystl::pop_min(first, last, std::less<value_type>());
+}
+
+
+/**
+ * \brief Moves the largest element of the min-max heap [first, last) to
+ * `last - 1` and makes [first, last - 1) a min-max heap.
+ *
+ * \param first: Iterator to the beginning of the range of the heap.
+ * \param last: Iterator of the end of the range of the heap.
+ * \param comp: Comparison functor that orders the elements.
+ */
+template <typename _RandomAccessIter, typename _Compare>
+void pop_max(_RandomAccessIter first, _RandomAccessIter last, _Compare comp) {
+    //
+    _RandomAccessIter max = mystl::minmax_heap_max(first, last, comp);
+    if (last - first <= 1 || max == last - 1)
+        return;
+
+    //
+    std::iter_swap(max, --last);
+    __minmax_sift(first, last - first, max - first, comp);
+}
+
+
+/**
+ * \brief Overload function of `pop_max` ordering by `std::less`.
+ */
+template <typename _RandomAccessIter>
+void pop_max(_RandomAccessIter first, _RandomAccessIter last) {
+    using value_type = typename std::iterator_traits<_RandomAccessIter>::value_type;
+    return mystl::pop_max(first, last, std::less<value_type>());
+}
+
+
+/**
+ * \brief Rearranges [first, last) into a min-max heap in O(n).
+ *
+ * \param first: Iterator pointing to the start of the range.
+ * \param last: Iterator pointing past the end of the range.
+ * \param comp: Comparison functor that orders the elements.
+ */
+template <typename _RandomAccessIter, typename _Compare>
+void make_minmax_heap(_RandomAccessIter first, _RandomAccessIter last, _Compare comp) {
+    //
+    using difference_type = typename std::iterator_traits<_RandomAccessIter>::difference_type;
+    difference_type len = last - first;
+
+    //
+    for (difference_type start = len / 2 - 1; start >= 0; --start) {
+        __minmax_sift(first, len, start, comp);
+    }
+}
+
+
+/**
+ * \brief Overload function of `make_minmax_heap` ordering by `std::less`.
+ */
+template <typename _RandomAccessIter>
+void make_minmax_heap(_RandomAccessIter first, _RandomAccessIter last) {
+    using value_type = typename std::iterator_traits<_RandomAccessIter>::value_type;
+    return mystl::make_minmax_heap(first, last, std::less<value_type>());
+}
+
+
+/**
+ * \brief Checks whether [first, last) is a min-max heap.
+ */
+template <typename _RandomAccessIter, typename _Compare>
+bool is_minmax_heap(_RandomAccessIter first, _RandomAccessIter last, _Compare comp) {
+    //
+    using difference_type = typename std::iterator_traits<_RandomAccessIter>::difference_type;
+    difference_type len = last - first;
+
+    // each element against its parent and grandparent covers all descendants by transitivity
+    for (difference_type idx = 1; idx < len; ++idx) {
+        difference_type parent = (idx - 1) / 2;
+        bool min_level = __minmax_is_min_level(idx);
+        if (min_level ? comp(*(first + parent), *(first + idx)) : comp(*(first + idx), *(first + parent)))
+            return false;
+        if (idx > 2) {
+            difference_type grandparent = (parent - 1) / 2;
+            if (min_level ? comp(*(first + idx), *(first + grandparent)) : comp(*(first + grandparent), *(first + idx)))
+                return false;
+        }
+    }
+    return true;
+}
+
+
+/**
+ * \brief Overload function of `is_minmax_heap` ordering by `std::less`.
+ */
+template <typename _RandomAccessIter>
+bool is_minmax_heap(_RandomAccessIter first, _RandomAccessIter last) {
+    using value_type = typename std::iterator_traits<_RandomAccessIter>::value_type;
+    return mystl::is_minmax_heap(first, last, std::less<value_type>());
+}
+
+
+} // namespace mystl::
+
+#endif // ALGORITHM_MINMAX_HEAP_HPP_
@@ -10,6 +10,8 @@
 #include <iterator>
 #include <algorithm>   // for iter_swap   TODO: implement my own iter_swap someday for avoid cyclic dependencies.
 
+#include "instrument.hpp"   // instrument::add
+
 namespace mystl {
 
 
@@ -27,7 +29,7 @@ namespace mystl {
  * \param start: Iterator pointing to the starting node where the heapify process begins.
  */
 template <typename _RandomAccessIter, typename _Compare>
-void __heapify(_RandomAccessIter first, _Compare comp,
+constexpr void __heapify(_RandomAccessIter first, _Compare comp,
         typename std::iterator_traits<_RandomAccessIter>::difference_type len, _RandomAccessIter start)
 {
     // 
@@ -56,6 +58,7 @@ void __heapify(_RandomAccessIter first, _Compare comp,
         // 
         if (largestIdx != parentIdx) {
             std::iter_swap((first + parentIdx), (first + largestIdx));
+            instrument::add(instrument::event::heap_sift_levels);
             parentIdx = largestIdx;
         } else {
             break;
@@ -80,7 +83,7 @@ void __heapify(_RandomAccessIter first, _Compare comp,
  * \param comp: Comparison functor that defines the heap order. 
  */
 template <typename _RandomAccessIter, typename _Compare>
-void pop_heap(_RandomAccessIter first, _RandomAccessIter last, _Compare comp) {
+constexpr void pop_heap(_RandomAccessIter first, _RandomAccessIter last, _Compare comp) {
     // 
     using difference_type = typename std::iterator_traits<_RandomAccessIter>::difference_type;
 
@@ -104,7 +107,7 @@ void pop_heap(_RandomAccessIter first, _RandomAccessIter last, _Compare comp) {
  *         access to elements (e.g., iterators of std::vector).
  */
 template <typename _RandomAccessIter>
-void pop_heap(_RandomAccessIter first, _RandomAccessIter last) {
+constexpr void pop_heap(_RandomAccessIter first, _RandomAccessIter last) {
     using value_type = typename std::iterator_traits<_RandomAccessIter>::value_type;
     return mystl::pop_heap(first, last, std::less<value_type>());
 }
@@ -0,0 +1,120 @@
+/**
+ * \file algorithm/pop_heap_n.hpp
+ *
+ * \reference:
+ * - R. W. Floyd: Algorithm 245: Treesort 3
+ * - I. Wegener: Bottom-Up-Heapsort, a New Variant of Heapsort Beating, on an
+ *   Average, Quicksort (if n is Not Very Small)
+ */
+
+#pragma once
+
+#ifndef ALGORITHM_POP_HEAP_N_HPP_
+#define ALGORITHM_POP_HEAP_N_HPP_
+
+#include <functional>  // less
+#include <iterator>
+#include <utility>     // move
+
+#include "instrument.hpp"   // instrument::add
+
+namespace mystl {
+
+
+/**
+ * \brief Moves the top of the heap [first, last) to `last - 1` bottom-up.
+ *
+ * The hole left by the top is first walked down to a leaf along the larger
+ * children, one comparison per level, and the former last element is then
+ * moved up from there. Since that element came from the bottom it rarely
+ * rises more than a level or two, so this takes about log2(n) comparisons
+ * instead of the 2 log2(n) of sifting it down from the root, and moves
+ * instead of swaps.
+ */
+template <typename _RandomAccessIter, typename _Compare>
+constexpr void __pop_heap_bottom_up(_RandomAccessIter first, _RandomAccessIter last, _Compare& comp) {
+    //
+    using difference_type = typename std::iterator_traits<_RandomAccessIter>::difference_type;
+    using value_type = typename std::iterator_traits<_RandomAccessIter>::value_type;
+
+    //
+    difference_type len = (last - first) - 1;
+    if (len <= 0)
+        return;
+    value_type top = std::move(*first);
+
+    // walk the hole down to a leaf
+    difference_type hole = 0;
+    difference_type child = 1;
+    while (child + 1 < len) {
+        child += comp(*(first + child), *(first + child + 1));   // no branch to mispredict
+        *(first + hole) = std::move(*(first + child));
+        instrument::add(instrument::event::heap_sift_levels);
+        hole = child;
+        child = 2 * hole + 1;
+    }
+    if (child + 1 == len) {
+        *(first + hole) = std::move(*(first + child));
+        instrument::add(instrument::event::heap_sift_levels);
+        hole = child;
+    }
+
+    // and fill it with the last element, moved up to its place
+    value_type value = std::move(*(first + len));
+    while (hole > 0) {
+        difference_type parent = (hole - 1) / 2;
+        if (!comp(*(first + parent), value))
+            break;
+        *(first + hole) = std::move(*(first + parent));
+        instrument::add(instrument::event::heap_sift_levels);
+        hole = parent;
+    }
+    *(first + hole) = std::move(value);
+    *(first + len) = std::move(top);
+}
+
+
+/**
+ * \brief Moves the `n` top elements of the heap [first, last) to its end and
+ * makes [first, last - n) a heap.
+ *
+ * Same result as `n` calls of `pop_heap` with `last` decreasing: the top
+ * element ends at `last - 1`, the second at `last - 2`, and so on, so that
+ * [last - n, last) is sorted ascending with respect to `comp`. Each step pops
+ * bottom-up, with about half the comparisons of `pop_heap`.
+ *
+ * \tparam _RandomAccessIter: Type of the iterator used, must support random
+ *         access to elements (e.g., iterators of std::vector).
+ * \tparam _Compare: Type of the comparison functor that determines the heap
+ *         order.
+ *
+ * \param first: Iterator to the beginning of the range of the heap.
+ * \param last: Iterator of the end of the range of the heap.
+ * \param n: Number of elements to pop, at most `last - first`.
+ * \param comp: Comparison functor that defines the heap order.
+ */
+template <typename _RandomAccessIter, typename _Compare>
+constexpr void pop_heap_n(_RandomAccessIter first, _RandomAccessIter last,
+        typename std::iterator_traits<_RandomAccessIter>::difference_type n, _Compare comp)
+{
+    for (; n > 0; --n, --last)
+        __pop_heap_bottom_up(first, last, comp);
+}
+
+
+/**
+ * \brief Overload function of `pop_heap_n` to use max heap by default.
+ */
+template <typename _RandomAccessIter>
+constexpr void pop_heap_n(_RandomAccessIter first, _RandomAccessIter last,
+        typename std::iterator_traits<_RandomAccessIter>::difference_type n)
+{
+    using value_type = typename std::iterator_traits<_RandomAccessIter>::value_type;
+    mystl::pop_heap_n(first, last, n, std::less<value_type>());
+}
+
+
+} // namespace mystl::
+
+
+#endif // ALGORITHM_POP_HEAP_N_HPP_
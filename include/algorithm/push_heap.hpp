@@ -10,6 +10,8 @@
 #include <iterator>
 #include <algorithm>   // for iter_swap   TODO: implement my own iter_swap someday for avoid cyclic dependencies.
 
+#include "instrument.hpp"   // instrument::add
+
 namespace mystl {
 
 
@@ -30,7 +32,7 @@ namespace mystl {
  * \param comp: Comparison functor that defines the heap order. 
  */
 template <typename _RandomAccessIter, typename _Compare>
-void push_heap(_RandomAccessIter first, _RandomAccessIter last, _Compare comp) {
+constexpr void push_heap(_RandomAccessIter first, _RandomAccessIter last, _Compare comp) {
     //
     using difference_type = typename std::iterator_traits<_RandomAccessIter>::difference_type;
 
@@ -47,6 +49,7 @@ void push_heap(_RandomAccessIter first, _RandomAccessIter last, _Compare comp) {
     while (childIdx > 0 && comp(*(first + parentIdx), *(first + childIdx))) {
         // swap if the child didn't statisfy the property of the heap
         std::iter_swap(first + parentIdx, first + childIdx);
+        instrument::add(instrument::event::heap_sift_levels);
 
         // 
         childIdx = parentIdx;
@@ -65,7 +68,7 @@ void push_heap(_RandomAccessIter first, _RandomAccessIter last, _Compare comp) {
  * \param last: Iterator to the last element of the range, which is the newly added element.
  */
 template <typename _RandomAccessIter>
-void push_heap(_RandomAccessIter first, _RandomAccessIter last) {
+constexpr void push_heap(_RandomAccessIter first, _RandomAccessIter last) {
     using value_type = typename std::iterator_traits<_RandomAccessIter>::value_type;
     return mystl::push_heap(first, last, std::less<value_type>());
 }
@@ -32,7 +32,7 @@ namespace mystl {
  * \param comp: Comparison functor that defines the sorted order. 
  */
 template <typename _RandomAccessIter, typename _Compare>
-void sort_heap(_RandomAccessIter first, _RandomAccessIter last, _Compare comp) {
+constexpr void sort_heap(_RandomAccessIter first, _RandomAccessIter last, _Compare comp) {
     // 
     if (last - first <= 1)
         return;
@@ -53,7 +53,7 @@ void sort_heap(_RandomAccessIter first, _RandomAccessIter last, _Compare comp) {
  * \param last: Iterator of the end of the range of the heap.
  */
 template <typename _RandomAccessIter>
-void sort_heap(_RandomAccessIter first, _RandomAccessIter last) {
+constexpr void sort_heap(_RandomAccessIter first, _RandomAccessIter last) {
     using value_type = typename std::iterator_traits<_RandomAccessIter>::value_type;
     mystl::sort_heap(first, last, std::less<value_type>());
 }
@@ -0,0 +1,617 @@
+/**
+ * \file algorithm/stable_sort.hpp
+ *
+ * \reference:
+ * - T. Peters: listsort.txt, CPython (the description of Timsort)
+ * - S. de Gouw, J. Rot, F. S. de Boer, R. Bubel, R. Hähnle: OpenJDK's
+ *   java.utils.Collection.sort() Is Broken (the corrected run invariant)
+ */
+
+#pragma once
+
+#ifndef ALGORITHM_STABLE_SORT_HPP_
+#define ALGORITHM_STABLE_SORT_HPP_
+
+#include <cstddef>     // ptrdiff_t
+#include <functional>  // less
+#include <iterator>
+#include <utility>     // move
+#include <algorithm>   // for move_backward, reverse   TODO: implement my own someday for avoid cyclic dependencies.
+
+#include "vector.hpp"
+
+namespace mystl {
+
+
+/**
+ * `stable_sort` is a Timsort: the range is cut into runs that are already
+ * ascending (or strictly descending, which are reversed in place), short runs
+ * are extended to a minimum length by binary insertion sort, and the runs are
+ * merged pairwise while keeping their lengths on a stack balanced. Merges
+ * switch to galloping, exponential search, when one run keeps winning, so
+ * that a run which mostly goes before or after the other is moved in blocks.
+ * Sorted and nearly sorted input is thus handled in close to n comparisons,
+ * random input in n log2(n), and only the shorter run of each merge is
+ * copied to the scratch buffer.
+ */
+
+
+/**
+ * \brief Ranges shorter than this are sorted by binary insertion sort alone.
+ */
+inline constexpr std::ptrdiff_t __timsort_min_merge = 32;
+
+
+/**
+ * \brief Consecutive wins of one run after which a merge starts galloping.
+ */
+inline constexpr std::ptrdiff_t __timsort_min_gallop = 7;
+
+
+/**
+ * \brief Returns the minimum run length for a range of `n` elements, chosen
+ * in [16, 32] so that n / minrun is a power of two or slightly less.
+ */
+template <typename _Diff>
+constexpr _Diff __timsort_min_run(_Diff n) noexcept {
+    _Diff low_bits = 0;
+    while (n >= 2 * __timsort_min_merge) {
+        low_bits |= n & 1;
+        n >>= 1;
+    }
+    return n + low_bits;
+}
+
+
+/**
+ * \brief Sorts [first, last) by binary insertion, given that [first, start)
+ * is already sorted.
+ */
+template <typename _RandomAccessIter, typename _Compare>
+void __binary_insertion_sort(_RandomAccessIter first, _RandomAccessIter last, _RandomAccessIter start, _Compare& comp) {
+    //
+    using value_type = typename std::iterator_traits<_RandomAccessIter>::value_type;
+
+    if (start == first)
+        ++start;
+    for (; start < last; ++start) {
+        // after all equal elements, for stability
+        _RandomAccessIter lo = first, hi = start;
+        while (lo < hi) {
+            _RandomAccessIter mid = lo + (hi - lo) / 2;
+            if (comp(*start, *mid))
+                hi = mid;
+            else
+                lo = mid + 1;
+        }
+
+        //
+        if (lo != start) {
+            value_type pivot = std::move(*start);
+            std::move_backward(lo, start, start + 1);
+            *lo = std::move(pivot);
+        }
+    }
+}
+
+
+/**
+ * \brief Returns the length of the run starting at `first`, reversing it
+ * first if it is strictly descending.
+ */
+template <typename _RandomAccessIter, typename _Compare>
+typename std::iterator_traits<_RandomAccessIter>::difference_type
+__count_run_and_make_ascending(_RandomAccessIter first, _RandomAccessIter last, _Compare& comp) {
+    //
+    _RandomAccessIter run_end = first + 1;
+    if (run_end == last)
+        return 1;
+
+    // strictly, so that reversing never reorders equal elements
+    if (comp(*run_end, *first)) {
+        ++run_end;
+        while (run_end < last && comp(*run_end, *(run_end - 1)))
+            ++run_end;
+        std::reverse(first, run_end);
+    } else {
+        ++run_end;
+        while (run_end < last && !comp(*run_end, *(run_end - 1)))
+            ++run_end;
+    }
+    return run_end - first;
+}
+
+
+/**
+ * \brief Returns the position at which `key` would be inserted into the
+ * sorted range [base, base + len) before all equal elements, searching
+ * exponentially outwards from `base + hint`.
+ */
+template <typename _T, typename _RandomAccessIter, typename _Compare>
+typename std::iterator_traits<_RandomAccessIter>::difference_type
+__gallop_left(const _T& key, _RandomAccessIter base,
+        typename std::iterator_traits<_RandomAccessIter>::difference_type len,
+        typename std::iterator_traits<_RandomAccessIter>::difference_type hint, _Compare& comp)
+{
+    //
+    using difference_type = typename std::iterator_traits<_RandomAccessIter>::difference_type;
+
+    // bracket the position between base[hint + last_ofs] and base[hint + ofs]
+    difference_type last_ofs = 0, ofs = 1;
+    if (comp(*(base + hint), key)) {
+        difference_type max_ofs = len - hint;
+        while (ofs < max_ofs && comp(*(base + hint + ofs), key)) {
+            last_ofs = ofs;
+            ofs = 2 * ofs + 1;
+        }
+        if (ofs > max_ofs)
+            ofs = max_ofs;
+        last_ofs += hint;
+        ofs += hint;
+    } else {
+        difference_type max_ofs = hint + 1;
+        while (ofs < max_ofs && !comp(*(base + hint - ofs), key)) {
+            last_ofs = ofs;
+            ofs = 2 * ofs + 1;
+        }
+        if (ofs > max_ofs)
+            ofs = max_ofs;
+        difference_type tmp = last_ofs;
+        last_ofs = hint - ofs;
+        ofs = hint - tmp;
+    }
+
+    // binary search in (last_ofs, ofs]
+    ++last_ofs;
+    while (last_ofs < ofs) {
+        difference_type mid = last_ofs + (ofs - last_ofs) / 2;
+        if (comp(*(base + mid), key))
+            last_ofs = mid + 1;
+        else
+            ofs = mid;
+    }
+    return ofs;
+}
+
+
+/**
+ * \brief Like `__gallop_left`, but the position after all elements equal to
+ * `key`.
+ */
+template <typename _T, typename _RandomAccessIter, typename _Compare>
+typename std::iterator_traits<_RandomAccessIter>::difference_type
+__gallop_right(const _T& key, _RandomAccessIter base,
+        typename std::iterator_traits<_RandomAccessIter>::difference_type len,
+        typename std::iterator_traits<_RandomAccessIter>::difference_type hint, _Compare& comp)
+{
+    //
+    using difference_type = typename std::iterator_traits<_RandomAccessIter>::difference_type;
+
+    //
+    difference_type last_ofs = 0, ofs = 1;
+    if (comp(key, *(base + hint))) {
+        difference_type max_ofs = hint + 1;
+        while (ofs < max_ofs && comp(key, *(base + hint - ofs))) {
+            last_ofs = ofs;
+            ofs = 2 * ofs + 1;
+        }
+        if (ofs > max_ofs)
+            ofs = max_ofs;
+        difference_type tmp = last_ofs;
+        last_ofs = hint - ofs;
+        ofs = hint - tmp;
+    } else {
+        difference_type max_ofs = len - hint;
+        while (ofs < max_ofs && !comp(key, *(base + hint + ofs))) {
+            last_ofs = ofs;
+            ofs = 2 * ofs + 1;
+        }
+        if (ofs > max_ofs)
+            ofs = max_ofs;
+        last_ofs += hint;
+        ofs += hint;
+    }
+
+    //
+    ++last_ofs;
+    while (last_ofs < ofs) {
+        difference_type mid = last_ofs + (ofs - last_ofs) / 2;
+        if (comp(key, *(base + mid)))
+            ofs = mid;
+        else
+            last_ofs = mid + 1;
+    }
+    return ofs;
+}
+
+
+/**
+ * \brief Sorts a short range: its first run, then binary insertion of the rest.
+ */
+template <typename _RandomAccessIter, typename _Compare>
+void __stable_sort_short(_RandomAccessIter first, _RandomAccessIter last, _Compare& comp) {
+    if (last - first < 2)
+        return;
+    auto run = __count_run_and_make_ascending(first, last, comp);
+    __binary_insertion_sort(first, last, first + run, comp);
+}
+
+
+/**
+ * \brief The state of one `stable_sort` call: the pending runs and the
+ * adaptive galloping threshold.
+ */
+template <typename _RandomAccessIter, typename _Compare>
+class __timsort {
+public:
+    using difference_type = typename std::iterator_traits<_RandomAccessIter>::difference_type;
+    using value_type      = typename std::iterator_traits<_RandomAccessIter>::value_type;
+    using buffer_type     = mystl::vector<value_type>;
+
+    // run lengths grow at least like Fibonacci numbers, so 85 covers any 64-bit length
+    static constexpr int MAX_RUNS = 85;
+
+
+public:
+    /**
+     */
+    __timsort(_RandomAccessIter first, _Compare& comp, buffer_type& buffer)
+        : m_first(first), m_comp(comp), m_buffer(buffer), m_min_gallop(__timsort_min_gallop), m_runs(0) {}
+
+    /**
+     * \brief Sorts [m_first, m_first + len).
+     */
+    void sort(difference_type len) {
+        difference_type min_run = __timsort_min_run(len);
+        difference_type lo = 0;
+        while (lo < len) {
+            // the next run, extended to `min_run` elements if it is shorter
+            difference_type run = __count_run_and_make_ascending(m_first + lo, m_first + len, m_comp);
+            if (run < min_run) {
+                difference_type forced = len - lo < min_run ? len - lo : min_run;
+                __binary_insertion_sort(m_first + lo, m_first + lo + forced, m_first + lo + run, m_comp);
+                run = forced;
+            }
+
+            //
+            m_base[m_runs] = lo;
+            m_len[m_runs] = run;
+            ++m_runs;
+            merge_collapse();
+            lo += run;
+        }
+
+        //
+        while (m_runs > 1) {
+            int n = m_runs - 2;
+            if (n > 0 && m_len[n - 1] < m_len[n + 1])
+                --n;
+            merge_at(n);
+        }
+    }
+
+
+private:
+    /**
+     * \brief Merges runs on top of the stack until each run is longer than
+     * the two above it together and than the one right above it.
+     */
+    void merge_collapse() {
+        while (m_runs > 1) {
+            int n = m_runs - 2;
+            if ((n > 0 && m_len[n - 1] <= m_len[n] + m_len[n + 1]) ||
+                (n > 1 && m_len[n - 2] <= m_len[n - 1] + m_len[n])) {
+                if (m_len[n - 1] < m_len[n + 1])
+                    --n;
+            } else if (m_len[n] > m_len[n + 1]) {
+                break;
+            }
+            merge_at(n);
+        }
+    }
+
+    /**
+     * \brief Merges the runs `i` and `i + 1` of the stack.
+     */
+    void merge_at(int i) {
+        difference_type base1 = m_base[i], len1 = m_len[i];
+        difference_type base2 = m_base[i + 1], len2 = m_len[i + 1];
+
+        //
+        m_len[i] = len1 + len2;
+        if (i == m_runs - 3) {
+            m_base[i + 1] = m_base[i + 2];
+            m_len[i + 1] = m_len[i + 2];
+        }
+        --m_runs;
+
+        // elements of run 1 before the start of run 2 are already in place
+        difference_type skip = __gallop_right(*(m_first + base2), m_first + base1, len1, 0, m_comp);
+        base1 += skip;
+        len1 -= skip;
+        if (len1 == 0)
+            return;
+
+        // and so are those of run 2 after the end of run 1
+        len2 = __gallop_left(*(m_first + base1 + len1 - 1), m_first + base2, len2, len2 - 1, m_comp);
+        if (len2 == 0)
+            return;
+
+        //
+        if (len1 <= len2)
+            merge_lo(base1, len1, base2, len2);
+        else
+            merge_hi(base1, len1, base2, len2);
+    }
+
+    /**
+     * \brief Moves [first, first + len) into the scratch buffer, assigning
+     * over the elements left there by earlier merges before growing it.
+     */
+    value_type* fill_buffer(difference_type first, difference_type len) {
+        using size_type = typename buffer_type::size_type;
+
+        //
+        size_type count = static_cast<size_type>(len);
+        size_type reuse = count < m_buffer.size() ? count : m_buffer.size();
+        std::move(m_first + first, m_first + first + static_cast<difference_type>(reuse), m_buffer.begin());
+        if (reuse < count) {
+            m_buffer.reserve(count);
+            for (size_type i = reuse; i < count; ++i)
+                m_buffer.push_back(std::move(*(m_first + first + static_cast<difference_type>(i))));
+        }
+        return m_buffer.data();
+    }
+
+    /**
+     * \brief Merges two adjacent runs front to back, with the shorter first
+     * run in the buffer; `a[base1]` must belong after `a[base2]` and the
+     * last element of run 1 after all of run 2.
+     */
+    void merge_lo(difference_type base1, difference_type len1, difference_type base2, difference_type len2) {
+        auto a = m_first;
+        auto tmp = fill_buffer(base1, len1);
+        difference_type cursor1 = 0, cursor2 = base2, dest = base1;
+
+        //
+        *(a + dest++) = std::move(*(a + cursor2++));
+        if (--len2 == 0) {
+            std::move(tmp + cursor1, tmp + cursor1 + len1, a + dest);
+            return;
+        }
+        if (len1 == 1) {
+            std::move(a + cursor2, a + cursor2 + len2, a + dest);
+            *(a + dest + len2) = std::move(*(tmp + cursor1));
+            return;
+        }
+
+        //
+        difference_type min_gallop = m_min_gallop;
+        while (true) {
+            // one element at a time until a run wins `min_gallop` times in a row
+            difference_type count1 = 0, count2 = 0;
+            do {
+                if (m_comp(*(a + cursor2), *(tmp + cursor1))) {
+                    *(a + dest++) = std::move(*(a + cursor2++));
+                    ++count2;
+                    count1 = 0;
+                    if (--len2 == 0)
+                        goto done;
+                } else {
+                    *(a + dest++) = std::move(*(tmp + cursor1++));
+                    ++count1;
+                    count2 = 0;
+                    if (--len1 == 1)
+                        goto done;
+                }
+            } while ((count1 | count2) < min_gallop);
+
+            // then in blocks found by galloping, until that stops paying off
+            do {
+                count1 = __gallop_right(*(a + cursor2), tmp + cursor1, len1, 0, m_comp);
+                if (count1 != 0) {
+                    std::move(tmp + cursor1, tmp + cursor1 + count1, a + dest);
+                    dest += count1;
+                    cursor1 += count1;
+                    len1 -= count1;
+                    if (len1 <= 1)
+                        goto done;
+                }
+                *(a + dest++) = std::move(*(a + cursor2++));
+                if (--len2 == 0)
+                    goto done;
+
+                count2 = __gallop_left(*(tmp + cursor1), a + cursor2, len2, 0, m_comp);
+                if (count2 != 0) {
+                    std::move(a + cursor2, a + cursor2 + count2, a + dest);
+                    dest += count2;
+                    cursor2 += count2;
+                    len2 -= count2;
+                    if (len2 == 0)
+                        goto done;
+                }
+                *(a + dest++) = std::move(*(tmp + cursor1++));
+                if (--len1 == 1)
+                    goto done;
+                --min_gallop;
+            } while (count1 >= __timsort_min_gallop || count2 >= __timsort_min_gallop);
+            if (min_gallop < 0)
+                min_gallop = 0;
+            min_gallop += 2;
+        }
+
+    done:
+        m_min_gallop = min_gallop < 1 ? 1 : min_gallop;
+        if (len1 == 1) {
+            std::move(a + cursor2, a + cursor2 + len2, a + dest);
+            *(a + dest + len2) = std::move(*(tmp + cursor1));
+        } else {
+            // len1 is 0 only if `comp` is not a strict weak ordering
+            std::move(tmp + cursor1, tmp + cursor1 + len1, a + dest);
+        }
+    }
+
+    /**
+     * \brief Merges two adjacent runs back to front, with the shorter second
+     * run in the buffer.
+     */
+    void merge_hi(difference_type base1, difference_type len1, difference_type base2, difference_type len2) {
+        auto a = m_first;
+        auto tmp = fill_buffer(base2, len2);
+        difference_type cursor1 = base1 + len1 - 1, cursor2 = len2 - 1, dest = base2 + len2 - 1;
+
+        //
+        *(a + dest--) = std::move(*(a + cursor1--));
+        if (--len1 == 0) {
+            std::move(tmp, tmp + len2, a + (dest - (len2 - 1)));
+            return;
+        }
+        if (len2 == 1) {
+            dest -= len1;
+            cursor1 -= len1;
+            std::move_backward(a + (cursor1 + 1), a + (cursor1 + 1 + len1), a + (dest + 1 + len1));
+            *(a + dest) = std::move(*(tmp + cursor2));
+            return;
+        }
+
+        //
+        difference_type min_gallop = m_min_gallop;
+        while (true) {
+            difference_type count1 = 0, count2 = 0;
+            do {
+                if (m_comp(*(tmp + cursor2), *(a + cursor1))) {
+                    *(a + dest--) = std::move(*(a + cursor1--));
+                    ++count1;
+                    count2 = 0;
+                    if (--len1 == 0)
+                        goto done;
+                } else {
+                    *(a + dest--) = std::move(*(tmp + cursor2--));
+                    ++count2;
+                    count1 = 0;
+                    if (--len2 == 1)
+                        goto done;
+                }
+            } while ((count1 | count2) < min_gallop);
+
+            //
+            do {
+                count1 = len1 - __gallop_right(*(tmp + cursor2), a + base1, len1, len1 - 1, m_comp);
+                if (count1 != 0) {
+                    dest -= count1;
+                    cursor1 -= count1;
+                    len1 -= count1;
+                    std::move_backward(a + (cursor1 + 1), a + (cursor1 + 1 + count1), a + (dest + 1 + count1));
+                    if (len1 == 0)
+                        goto done;
+                }
+                *(a + dest--) = std::move(*(tmp + cursor2--));
+                if (--len2 == 1)
+                    goto done;
+
+                count2 = len2 - __gallop_left(*(a + cursor1), tmp, len2, len2 - 1, m_comp);
+                if (count2 != 0) {
+                    dest -= count2;
+                    cursor2 -= count2;
+                    len2 -= count2;
+                    std::move(tmp + (cursor2 + 1), tmp + (cursor2 + 1 + count2), a + (dest + 1));
+                    if (len2 <= 1)
+                        goto done;
+                }
+                *(a + dest--) = std::move(*(a + cursor1--));
+                if (--len1 == 0)
+                    goto done;
+                --min_gallop;
+            } while (count1 >= __timsort_min_gallop || count2 >= __timsort_min_gallop);
+            if (min_gallop < 0)
+                min_gallop = 0;
+            min_gallop += 2;
+        }
+
+    done:
+        m_min_gallop = min_gallop < 1 ? 1 : min_gallop;
+        if (len2 == 1) {
+            dest -= len1;
+            cursor1 -= len1;
+            std::move_backward(a + (cursor1 + 1), a + (cursor1 + 1 + len1), a + (dest + 1 + len1));
+            *(a + dest) = std::move(*(tmp + cursor2));
+        } else {
+            std::move(tmp, tmp + len2, a + (dest - (len2 - 1)));
+        }
+    }
+
+
+private:
+    _RandomAccessIter m_first;
+    _Compare&         m_comp;
+    buffer_type&      m_buffer;
+    difference_type   m_min_gallop;
+    int               m_runs;
+    difference_type   m_base[MAX_RUNS];
+    difference_type   m_len[MAX_RUNS];
+};
+
+
+/**
+ * \brief Sorts [first, last) in non-descending order, keeping the order of
+ * equal elements.
+ *
+ * Adapts to existing order: takes O(n) comparisons for sorted, reversed, or
+ * concatenated sorted input, and O(n log n) in the worst case.
+ *
+ * \tparam _RandomAccessIter: Type of the iterator used, must support random
+ *         access to elements (e.g., iterators of std::vector).
+ * \tparam _Compare: Type of the comparison functor.
+ *
+ * \param first: Iterator pointing to the start of the range to sort.
+ * \param last: Iterator pointing past the end of the range to sort.
+ * \param comp: Comparison functor that defines the order.
+ * \param buffer: Scratch space for merging, left holding up to half as many
+ *        moved-from elements as the range; passing the same buffer to
+ *        repeated calls saves growing it again.
+ */
+template <typename _RandomAccessIter, typename _Compare>
+void stable_sort(_RandomAccessIter first, _RandomAccessIter last, _Compare comp,
+        mystl::vector<typename std::iterator_traits<_RandomAccessIter>::value_type>& buffer)
+{
+    //
+    auto len = last - first;
+    if (len < __timsort_min_merge) {
+        __stable_sort_short(first, last, comp);
+        return;
+    }
+    __timsort<_RandomAccessIter, _Compare>(first, comp, buffer).sort(len);
+}
+
+
+/**
+ * \brief Overload function of `stable_sort` with a scratch buffer of its own.
+ */
+template <typename _RandomAccessIter, typename _Compare>
+void stable_sort(_RandomAccessIter first, _RandomAccessIter last, _Compare comp) {
+    //
+    using value_type = typename std::iterator_traits<_RandomAccessIter>::value_type;
+
+    // short ranges need no buffer, so do not allocate one
+    if (last - first < __timsort_min_merge) {
+        __stable_sort_short(first, last, comp);
+        return;
+    }
+    mystl::vector<value_type> buffer;
+    mystl::stable_sort(first, last, comp, buffer);
+}
+
+
+/**
+ * \brief Overload function of `stable_sort` to sort by `std::less`.
+ */
+template <typename _RandomAccessIter>
+void stable_sort(_RandomAccessIter first, _RandomAccessIter last) {
+    using value_type = typename std::iterator_traits<_RandomAccessIter>::value_type;
+    mystl::stable_sort(first, last, std::less<value_type>());
+}
+
+
+} // namespace mystl::
+
+#endif // ALGORITHM_STABLE_SORT_HPP_
@@ -147,6 +147,24 @@ public:
     constexpr size_type max_size() const noexcept { return _Size; }
 
 
+/* Memory */
+public:
+    /**
+     * \brief Returns the bytes allocated on the heap, always 0 since the elements are stored inline.
+     */
+    constexpr size_type allocated_bytes() const noexcept { return 0; }
+
+    /**
+     * \brief Returns the bytes used by the array, its own object and `allocated_bytes()`.
+     */
+    constexpr size_type memory_footprint() const noexcept { return sizeof(*this) + allocated_bytes(); }
+
+    /**
+     * \brief Returns the bytes of `memory_footprint()` not holding elements.
+     */
+    constexpr size_type overhead_bytes() const noexcept { return memory_footprint() - _Size * sizeof(value_type); }
+
+
 /* Operations */
 public:
     /**
@@ -0,0 +1,596 @@
+/**
+ * \file bit_vector.hpp
+ *
+ * \brief A dynamic sequence of bits packed into 64-bit words.
+ *
+ * \reference:
+ * - cppreference.com: std::vector<bool>, std::bitset
+ * - Gonzalo Navarro: Compact Data Structures (rank and select on bitvectors)
+ */
+
+#pragma once
+
+#ifndef BIT_VECTOR_HPP_
+#define BIT_VECTOR_HPP_
+
+#include <bit>              // popcount, countr_zero
+#include <cstddef>          // size_t, ptrdiff_t
+#include <cstdint>          // uint64_t
+#include <initializer_list> // initializer_list
+#include <iterator>         // random_access_iterator_tag
+#include <stdexcept>        // out_of_range, invalid_argument, length_error
+
+#include "vector.hpp"
+
+
+namespace mystl {
+
+namespace __detail {
+
+
+using bit_word = std::uint64_t;
+
+inline constexpr std::size_t BITS_PER_WORD = 64;
+
+/**
+ * \brief Number of words needed to hold `bits` bits.
+ */
+constexpr std::size_t __bit_words(std::size_t bits) noexcept {
+    return (bits + BITS_PER_WORD - 1) / BITS_PER_WORD;
+}
+
+/**
+ * \brief Mask of the valid bits in the last word of a sequence of `bits` bits.
+ */
+constexpr bit_word __bit_tail_mask(std::size_t bits) noexcept {
+    std::size_t rem = bits % BITS_PER_WORD;
+    return rem == 0 ? ~bit_word(0) : (bit_word(1) << rem) - 1;
+}
+
+
+/**
+ * \brief Number of set bits in `words[0, n)`.
+ *
+ * Four independent accumulators let the `popcnt`s of consecutive words
+ * overlap in the pipeline instead of serializing on a single sum.
+ */
+constexpr std::size_t __bit_count(const bit_word* words, std::size_t n) noexcept {
+    std::size_t c0 = 0, c1 = 0, c2 = 0, c3 = 0;
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        c0 += std::popcount(words[i]);
+        c1 += std::popcount(words[i + 1]);
+        c2 += std::popcount(words[i + 2]);
+        c3 += std::popcount(words[i + 3]);
+    }
+    for (; i < n; ++i)
+        c0 += std::popcount(words[i]);
+    return c0 + c1 + c2 + c3;
+}
+
+/**
+ * \brief Position of the first set bit at or after `pos`, or `bits` if there is none.
+ */
+constexpr std::size_t __bit_find_from(const bit_word* words, std::size_t bits, std::size_t pos) noexcept {
+    if (pos >= bits)
+        return bits;
+
+    std::size_t nwords = __bit_words(bits);
+    std::size_t w = pos / BITS_PER_WORD;
+    bit_word word = words[w] & (~bit_word(0) << (pos % BITS_PER_WORD));
+
+    while (true) {
+        if (word != 0)
+            return w * BITS_PER_WORD + std::countr_zero(word);
+        if (++w == nwords)
+            return bits;
+        word = words[w];
+    }
+}
+
+/**
+ * \brief Number of set bits in `[0, pos)`.
+ */
+constexpr std::size_t __bit_rank(const bit_word* words, std::size_t pos) noexcept {
+    std::size_t w = pos / BITS_PER_WORD;
+    std::size_t count = __bit_count(words, w);
+    if (pos % BITS_PER_WORD != 0)
+        count += std::popcount(words[w] & ((bit_word(1) << (pos % BITS_PER_WORD)) - 1));
+    return count;
+}
+
+/**
+ * \brief Position of the `k`-th (0-based) set bit, or `bits` if there are not
+ * that many set bits.
+ */
+constexpr std::size_t __bit_select(const bit_word* words, std::size_t bits, std::size_t k) noexcept {
+    std::size_t nwords = __bit_words(bits);
+    for (std::size_t w = 0; w < nwords; ++w) {
+        std::size_t ones = std::popcount(words[w]);
+        if (k < ones) {
+            // drop the `k` lowest set bits, the answer is then the lowest one
+            bit_word word = words[w];
+            for (; k > 0; --k)
+                word &= word - 1;
+            return w * BITS_PER_WORD + std::countr_zero(word);
+        }
+        k -= ones;
+    }
+    return bits;
+}
+
+
+/**
+ * \class __bit_reference
+ *
+ * \brief Proxy standing for a single bit inside a word.
+ */
+class __bit_reference {
+public:
+    constexpr __bit_reference(bit_word* word, bit_word mask) noexcept : p_word(word), m_mask(mask) {}
+    constexpr __bit_reference(const __bit_reference&) = default;
+
+    constexpr operator bool() const noexcept { return (*p_word & m_mask) != 0; }
+    constexpr bool operator~() const noexcept { return !bool(*this); }
+
+    constexpr __bit_reference& operator=(bool value) noexcept {
+        if (value)
+            *p_word |= m_mask;
+        else
+            *p_word &= ~m_mask;
+        return *this;
+    }
+
+    constexpr __bit_reference& operator=(const __bit_reference& other) noexcept {
+        return *this = bool(other);
+    }
+
+    constexpr __bit_reference& flip() noexcept {
+        *p_word ^= m_mask;
+        return *this;
+    }
+
+private:
+    bit_word* p_word;
+    bit_word  m_mask;
+};
+
+
+/**
+ * \class __bit_iterator
+ *
+ * \brief Random access iterator over packed bits, dereferencing to a
+ * `__bit_reference` (or to `bool` when `_Const`).
+ */
+template <bool _Const>
+class __bit_iterator {
+private:
+    using word_pointer = std::conditional_t<_Const, const bit_word*, bit_word*>;
+
+public:
+    using value_type        = bool;
+    using reference         = std::conditional_t<_Const, bool, __bit_reference>;
+    using pointer           = void;
+    using difference_type   = std::ptrdiff_t;
+    using iterator_category = std::random_access_iterator_tag;
+
+public:
+    constexpr __bit_iterator() noexcept : p_words(nullptr), m_pos(0) {}
+    constexpr __bit_iterator(word_pointer words, std::size_t pos) noexcept : p_words(words), m_pos(pos) {}
+
+    // iterator -> const_iterator
+    constexpr __bit_iterator(const __bit_iterator<false>& other) noexcept requires _Const
+        : p_words(other.words()), m_pos(other.position()) {}
+
+public:
+    constexpr reference operator*() const noexcept {
+        word_pointer word = p_words + m_pos / BITS_PER_WORD;
+        bit_word mask = bit_word(1) << (m_pos % BITS_PER_WORD);
+        if constexpr (_Const)
+            return (*word & mask) != 0;
+        else
+            return __bit_reference(word, mask);
+    }
+
+    constexpr reference operator[](difference_type n) const noexcept { return *(*this + n); }
+
+    constexpr __bit_iterator& operator+=(difference_type n) noexcept { m_pos += n; return *this; }
+    constexpr __bit_iterator& operator-=(difference_type n) noexcept { m_pos -= n; return *this; }
+
+    constexpr __bit_iterator& operator++()    noexcept { ++m_pos; return *this; }
+    constexpr __bit_iterator& operator--()    noexcept { --m_pos; return *this; }
+    constexpr __bit_iterator  operator++(int) noexcept { __bit_iterator old(*this); ++m_pos; return old; }
+    constexpr __bit_iterator  operator--(int) noexcept { __bit_iterator old(*this); --m_pos; return old; }
+
+    constexpr __bit_iterator operator+(difference_type n) const noexcept { return __bit_iterator(p_words, m_pos + n); }
+    constexpr __bit_iterator operator-(difference_type n) const noexcept { return __bit_iterator(p_words, m_pos - n); }
+    friend constexpr __bit_iterator operator+(difference_type n, const __bit_iterator& it) noexcept { return it + n; }
+
+    constexpr difference_type operator-(const __bit_iterator& other) const noexcept {
+        return difference_type(m_pos) - difference_type(other.m_pos);
+    }
+
+    constexpr bool operator==(const __bit_iterator& other) const noexcept { return m_pos == other.m_pos; }
+    constexpr auto operator<=>(const __bit_iterator& other) const noexcept { return m_pos <=> other.m_pos; }
+
+    constexpr word_pointer words()    const noexcept { return p_words; }
+    constexpr std::size_t  position() const noexcept { return m_pos; }
+
+private:
+    word_pointer p_words;
+    std::size_t  m_pos;
+};
+
+
+} // namespace __detail
+
+
+/**
+ * \class bit_vector
+ *
+ * \brief A resizable sequence of bits, stored 64 per word in a `mystl::vector`.
+ *
+ * Bulk operations (`&=`, `|=`, `^=`, `flip`, `count`, `find_next`, ...) work a
+ * whole word at a time. Bits past `size()` in the last word are always kept
+ * cleared, so word-level operations never need to mask them.
+ */
+class bit_vector {
+public:
+    using value_type      = bool;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using word_type       = __detail::bit_word;
+    using reference       = __detail::__bit_reference;
+    using const_reference = bool;
+    using iterator        = __detail::__bit_iterator<false>;
+    using const_iterator  = __detail::__bit_iterator<true>;
+
+    static constexpr size_type BITS_PER_WORD = __detail::BITS_PER_WORD;
+
+
+/* Constructor and Destructor */
+public:
+    /**
+     * \brief Constructs an empty bit_vector.
+     */
+    bit_vector() : m_words(), m_size(0) {}
+
+    /**
+     * \brief Constructs a bit_vector of `count` bits set to `value`.
+     */
+    explicit bit_vector(size_type count, bool value = false)
+        : m_words(__detail::__bit_words(count), value ? ~word_type(0) : word_type(0)), m_size(count)
+    {
+        clear_unused_bits();
+    }
+
+    /**
+     * \brief Constructs a bit_vector from a list of bools.
+     */
+    bit_vector(std::initializer_list<bool> ilist) : bit_vector(ilist.size()) {
+        size_type i = 0;
+        for (bool bit : ilist)
+            set(i++, bit);
+    }
+
+
+/* Operators */
+public:
+    /**
+     * \brief Access specified bit, without bounds checking.
+     */
+    reference operator[](size_type pos) {
+        return reference(m_words.data() + pos / BITS_PER_WORD, word_type(1) << (pos % BITS_PER_WORD));
+    }
+    const_reference operator[](size_type pos) const { return test_unchecked(pos); }
+
+    /**
+     * \brief Word-wise bitwise operations.
+     *
+     * \throws std::invalid_argument if the sizes differ.
+     */
+    bit_vector& operator&=(const bit_vector& other) {
+        check_same_size(other, "bit_vector::operator&=");
+        for (size_type i = 0; i < word_count(); ++i)
+            m_words[i] &= other.m_words[i];
+        return *this;
+    }
+
+    bit_vector& operator|=(const bit_vector& other) {
+        check_same_size(other, "bit_vector::operator|=");
+        for (size_type i = 0; i < word_count(); ++i)
+            m_words[i] |= other.m_words[i];
+        return *this;
+    }
+
+    bit_vector& operator^=(const bit_vector& other) {
+        check_same_size(other, "bit_vector::operator^=");
+        for (size_type i = 0; i < word_count(); ++i)
+            m_words[i] ^= other.m_words[i];
+        return *this;
+    }
+
+    bit_vector operator~() const {
+        bit_vector result(*this);
+        result.flip();
+        return result;
+    }
+
+    bool operator==(const bit_vector& other) const {
+        if (m_size != other.m_size)
+            return false;
+        for (size_type i = 0; i < word_count(); ++i)
+            if (m_words[i] != other.m_words[i])
+                return false;
+        return true;
+    }
+
+
+/* Element access */
+public:
+    /**
+     * \brief Returns the bit at `pos`.
+     *
+     * \throws std::out_of_range if `pos >= size()`.
+     */
+    bool test(size_type pos) const {
+        if (pos >= m_size)
+            throw std::out_of_range("bit_vector::test");
+        return test_unchecked(pos);
+    }
+
+    /**
+     * \brief Access specified bit with bounds checking.
+     *
+     * \throws std::out_of_range if `pos >= size()`.
+     */
+    reference at(size_type pos) {
+        if (pos >= m_size)
+            throw std::out_of_range("bit_vector::at");
+        return (*this)[pos];
+    }
+
+    /**
+     * \brief Direct access to the underlying words.
+     */
+    word_type* data() noexcept { return m_words.data(); }
+    const word_type* data() const noexcept { return m_words.data(); }
+
+
+/* Iterators */
+public:
+    /**
+     */
+    iterator        begin()       noexcept { return iterator(m_words.data(), 0); }
+    const_iterator cbegin() const noexcept { return const_iterator(m_words.data(), 0); }
+
+    /**
+     */
+    iterator        end()       noexcept { return iterator(m_words.data(), m_size); }
+    const_iterator cend() const noexcept { return const_iterator(m_words.data(), m_size); }
+
+
+/* Capacity */
+public:
+    /**
+     * \brief Returns the number of bits.
+     */
+    size_type size() const noexcept { return m_size; }
+
+    /**
+     * \brief Returns the number of words holding the bits.
+     */
+    size_type word_count() const noexcept { return __detail::__bit_words(m_size); }
+
+    /**
+     * \brief Checks whether the container is empty.
+     */
+    bool empty() const noexcept { return m_size == 0; }
+
+    /**
+     * \brief Reserves storage for `bits` bits.
+     */
+    void reserve(size_type bits) { m_words.reserve(__detail::__bit_words(bits)); }
+
+
+/* Modifiers */
+public:
+    /**
+     * \brief Sets the bit at `pos` to `value`.
+     *
+     * \throws std::out_of_range if `pos >= size()`.
+     */
+    bit_vector& set(size_type pos, bool value = true) {
+        at(pos) = value;
+        return *this;
+    }
+
+    /**
+     * \brief Sets all bits.
+     */
+    bit_vector& set() noexcept {
+        for (size_type i = 0; i < word_count(); ++i)
+            m_words[i] = ~word_type(0);
+        clear_unused_bits();
+        return *this;
+    }
+
+    /**
+     * \brief Clears the bit at `pos`.
+     *
+     * \throws std::out_of_range if `pos >= size()`.
+     */
+    bit_vector& reset(size_type pos) { return set(pos, false); }
+
+    /**
+     * \brief Clears all bits.
+     */
+    bit_vector& reset() noexcept {
+        for (size_type i = 0; i < word_count(); ++i)
+            m_words[i] = 0;
+        return *this;
+    }
+
+    /**
+     * \brief Toggles the bit at `pos`.
+     *
+     * \throws std::out_of_range if `pos >= size()`.
+     */
+    bit_vector& flip(size_type pos) {
+        at(pos).flip();
+        return *this;
+    }
+
+    /**
+     * \brief Toggles all bits.
+     */
+    bit_vector& flip() noexcept {
+        for (size_type i = 0; i < word_count(); ++i)
+            m_words[i] = ~m_words[i];
+        clear_unused_bits();
+        return *this;
+    }
+
+    /**
+     * \brief Appends a bit.
+     */
+    void push_back(bool value) {
+        if (m_size % BITS_PER_WORD == 0)
+            m_words.push_back(0);
+        ++m_size;
+        (*this)[m_size - 1] = value;
+    }
+
+    /**
+     * \brief Removes the last bit.
+     *
+     * \throws std::length_error if the container is empty.
+     */
+    void pop_back() {
+        if (m_size == 0)
+            throw std::length_error("bit_vector::pop_back(): the bit_vector is empty");
+        resize(m_size - 1);
+    }
+
+    /**
+     * \brief Changes the number of bits, new bits are set to `value`.
+     */
+    void resize(size_type count, bool value = false) {
+        size_type oldSize = m_size;
+        m_words.resize(__detail::__bit_words(count), value ? ~word_type(0) : word_type(0));
+        m_size = count;
+
+        // the old last word may have cleared bits which now belong to the container
+        if (value && count > oldSize && oldSize % BITS_PER_WORD != 0)
+            m_words[oldSize / BITS_PER_WORD] |= ~__detail::__bit_tail_mask(oldSize);
+        clear_unused_bits();
+    }
+
+    /**
+     * \brief Removes all bits.
+     */
+    void clear() noexcept {
+        m_words.clear();
+        m_size = 0;
+    }
+
+    /**
+     * \brief Swaps the contents.
+     */
+    void swap(bit_vector& other) noexcept {
+        m_words.swap(other.m_words);
+        std::swap(m_size, other.m_size);
+    }
+
+
+/* Operations */
+public:
+    /**
+     * \brief Returns the number of set bits.
+     */
+    size_type count() const noexcept { return __detail::__bit_count(m_words.data(), word_count()); }
+
+    /**
+     * \brief Checks whether all, any or none of the bits are set.
+     */
+    bool all()  const noexcept { return count() == m_size; }
+    bool any()  const noexcept { return find_first() != m_size; }
+    bool none() const noexcept { return !any(); }
+
+    /**
+     * \brief Position of the first set bit, or `size()` if there is none.
+     */
+    size_type find_first() const noexcept { return __detail::__bit_find_from(m_words.data(), m_size, 0); }
+
+    /**
+     * \brief Position of the first set bit after `pos`, or `size()` if there is none.
+     */
+    size_type find_next(size_type pos) const noexcept { return __detail::__bit_find_from(m_words.data(), m_size, pos + 1); }
+
+    /**
+     * \brief Number of set bits in `[0, pos)`.
+     *
+     * \throws std::out_of_range if `pos > size()`.
+     */
+    size_type rank(size_type pos) const {
+        if (pos > m_size)
+            throw std::out_of_range("bit_vector::rank");
+        return __detail::__bit_rank(m_words.data(), pos);
+    }
+
+    /**
+     * \brief Position of the `k`-th (0-based) set bit, or `size()` if there
+     * are at most `k` set bits.
+     */
+    size_type select(size_type k) const noexcept { return __detail::__bit_select(m_words.data(), m_size, k); }
+
+
+private:
+    /**
+     */
+    bool test_unchecked(size_type pos) const noexcept {
+        return (m_words[pos / BITS_PER_WORD] >> (pos % BITS_PER_WORD)) & 1;
+    }
+
+    /**
+     * \brief Clears the bits past `size()` in the last word.
+     */
+    void clear_unused_bits() noexcept {
+        if (m_size % BITS_PER_WORD != 0)
+            m_words[word_count() - 1] &= __detail::__bit_tail_mask(m_size);
+    }
+
+    /**
+     */
+    void check_same_size(const bit_vector& other, const char* what) const {
+        if (m_size != other.m_size)
+            throw std::invalid_argument(what);
+    }
+
+
+private:
+    mystl::vector<word_type> m_words;
+    size_type                m_size;
+};
+
+
+/**
+ * \brief Bitwise operations on two bit_vectors of the same size.
+ */
+inline bit_vector operator&(const bit_vector& lhs, const bit_vector& rhs) { bit_vector result(lhs); return result &= rhs; }
+inline bit_vector operator|(const bit_vector& lhs, const bit_vector& rhs) { bit_vector result(lhs); return result |= rhs; }
+inline bit_vector operator^(const bit_vector& lhs, const bit_vector& rhs) { bit_vector result(lhs); return result ^= rhs; }
+
+
+/**
+ * \brief Specializes the std::swap algorithm for mystl::bit_vector.
+ */
+inline void swap(bit_vector& lhs, bit_vector& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+
+} // namespace mystl::
+
+
+#endif // BIT_VECTOR_HPP_
@@ -0,0 +1,286 @@
+/**
+ * \file bitset.hpp
+ *
+ * \reference:
+ * - cppreference.com: std::bitset
+ */
+
+#pragma once
+
+#ifndef BITSET_HPP_
+#define BITSET_HPP_
+
+#include <cstddef>          // size_t
+#include <stdexcept>        // out_of_range
+
+#include "bit_vector.hpp"   // word-level bit algorithms, __bit_reference, __bit_iterator
+
+
+namespace mystl {
+
+
+/**
+ * \class bitset
+ *
+ * \brief A fixed-size sequence of `_N` bits stored inline, 64 per word.
+ *
+ * Shares its word-level algorithms with `bit_vector`, and like it keeps the
+ * bits past `_N` in the last word cleared. Usable in constant expressions.
+ */
+template <std::size_t _N>
+class bitset {
+public:
+    using size_type       = std::size_t;
+    using word_type       = __detail::bit_word;
+    using reference       = __detail::__bit_reference;
+    using const_reference = bool;
+    using iterator        = __detail::__bit_iterator<false>;
+    using const_iterator  = __detail::__bit_iterator<true>;
+
+    static constexpr size_type BITS_PER_WORD = __detail::BITS_PER_WORD;
+    static constexpr size_type WORD_COUNT    = __detail::__bit_words(_N);
+
+
+/* Constructor */
+public:
+    /**
+     * \brief Constructs a bitset with all bits cleared.
+     */
+    constexpr bitset() noexcept : m_words{} {}
+
+    /**
+     * \brief Constructs a bitset whose first (up to 64) bits are those of `value`.
+     */
+    constexpr bitset(unsigned long long value) noexcept : m_words{} {
+        if constexpr (_N > 0) {
+            m_words[0] = value;
+            clear_unused_bits();
+        }
+    }
+
+
+/* Operators */
+public:
+    /**
+     * \brief Access specified bit, without bounds checking.
+     */
+    constexpr reference operator[](size_type pos) {
+        return reference(m_words + pos / BITS_PER_WORD, word_type(1) << (pos % BITS_PER_WORD));
+    }
+    constexpr const_reference operator[](size_type pos) const {
+        return (m_words[pos / BITS_PER_WORD] >> (pos % BITS_PER_WORD)) & 1;
+    }
+
+    /**
+     * \brief Word-wise bitwise operations.
+     */
+    constexpr bitset& operator&=(const bitset& other) noexcept {
+        for (size_type i = 0; i < WORD_COUNT; ++i)
+            m_words[i] &= other.m_words[i];
+        return *this;
+    }
+
+    constexpr bitset& operator|=(const bitset& other) noexcept {
+        for (size_type i = 0; i < WORD_COUNT; ++i)
+            m_words[i] |= other.m_words[i];
+        return *this;
+    }
+
+    constexpr bitset& operator^=(const bitset& other) noexcept {
+        for (size_type i = 0; i < WORD_COUNT; ++i)
+            m_words[i] ^= other.m_words[i];
+        return *this;
+    }
+
+    constexpr bitset operator~() const noexcept {
+        bitset result(*this);
+        result.flip();
+        return result;
+    }
+
+    constexpr bool operator==(const bitset& other) const noexcept {
+        for (size_type i = 0; i < WORD_COUNT; ++i)
+            if (m_words[i] != other.m_words[i])
+                return false;
+        return true;
+    }
+
+
+/* Element access */
+public:
+    /**
+     * \brief Returns the bit at `pos`.
+     *
+     * \throws std::out_of_range if `pos >= _N`.
+     */
+    constexpr bool test(size_type pos) const {
+        if (pos >= _N)
+            throw std::out_of_range("bitset::test");
+        return (*this)[pos];
+    }
+
+    /**
+     * \brief Direct access to the underlying words.
+     */
+    constexpr word_type* data() noexcept { return m_words; }
+    constexpr const word_type* data() const noexcept { return m_words; }
+
+
+/* Iterators */
+public:
+    /**
+     */
+    constexpr iterator        begin()       noexcept { return iterator(m_words, 0); }
+    constexpr const_iterator cbegin() const noexcept { return const_iterator(m_words, 0); }
+
+    /**
+     */
+    constexpr iterator        end()       noexcept { return iterator(m_words, _N); }
+    constexpr const_iterator cend() const noexcept { return const_iterator(m_words, _N); }
+
+
+/* Capacity */
+public:
+    /**
+     * \brief Returns the number of bits, `_N`.
+     */
+    static constexpr size_type size() noexcept { return _N; }
+
+
+/* Modifiers */
+public:
+    /**
+     * \brief Sets the bit at `pos` to `value`.
+     *
+     * \throws std::out_of_range if `pos >= _N`.
+     */
+    constexpr bitset& set(size_type pos, bool value = true) {
+        if (pos >= _N)
+            throw std::out_of_range("bitset::set");
+        (*this)[pos] = value;
+        return *this;
+    }
+
+    /**
+     * \brief Sets all bits.
+     */
+    constexpr bitset& set() noexcept {
+        for (size_type i = 0; i < WORD_COUNT; ++i)
+            m_words[i] = ~word_type(0);
+        clear_unused_bits();
+        return *this;
+    }
+
+    /**
+     * \brief Clears the bit at `pos`.
+     *
+     * \throws std::out_of_range if `pos >= _N`.
+     */
+    constexpr bitset& reset(size_type pos) { return set(pos, false); }
+
+    /**
+     * \brief Clears all bits.
+     */
+    constexpr bitset& reset() noexcept {
+        for (size_type i = 0; i < WORD_COUNT; ++i)
+            m_words[i] = 0;
+        return *this;
+    }
+
+    /**
+     * \brief Toggles the bit at `pos`.
+     *
+     * \throws std::out_of_range if `pos >= _N`.
+     */
+    constexpr bitset& flip(size_type pos) {
+        if (pos >= _N)
+            throw std::out_of_range("bitset::flip");
+        (*this)[pos].flip();
+        return *this;
+    }
+
+    /**
+     * \brief Toggles all bits.
+     */
+    constexpr bitset& flip() noexcept {
+        for (size_type i = 0; i < WORD_COUNT; ++i)
+            m_words[i] = ~m_words[i];
+        clear_unused_bits();
+        return *this;
+    }
+
+
+/* Operations */
+public:
+    /**
+     * \brief Returns the number of set bits.
+     */
+    constexpr size_type count() const noexcept { return __detail::__bit_count(m_words, WORD_COUNT); }
+
+    /**
+     * \brief Checks whether all, any or none of the bits are set.
+     */
+    constexpr bool all()  const noexcept { return count() == _N; }
+    constexpr bool any()  const noexcept { return find_first() != _N; }
+    constexpr bool none() const noexcept { return !any(); }
+
+    /**
+     * \brief Position of the first set bit, or `_N` if there is none.
+     */
+    constexpr size_type find_first() const noexcept { return __detail::__bit_find_from(m_words, _N, 0); }
+
+    /**
+     * \brief Position of the first set bit after `pos`, or `_N` if there is none.
+     */
+    constexpr size_type find_next(size_type pos) const noexcept { return __detail::__bit_find_from(m_words, _N, pos + 1); }
+
+    /**
+     * \brief Number of set bits in `[0, pos)`.
+     *
+     * \throws std::out_of_range if `pos > _N`.
+     */
+    constexpr size_type rank(size_type pos) const {
+        if (pos > _N)
+            throw std::out_of_range("bitset::rank");
+        return __detail::__bit_rank(m_words, pos);
+    }
+
+    /**
+     * \brief Position of the `k`-th (0-based) set bit, or `_N` if there are at
+     * most `k` set bits.
+     */
+    constexpr size_type select(size_type k) const noexcept { return __detail::__bit_select(m_words, _N, k); }
+
+
+private:
+    /**
+     * \brief Clears the bits past `_N` in the last word.
+     */
+    constexpr void clear_unused_bits() noexcept {
+        if constexpr (_N % BITS_PER_WORD != 0)
+            m_words[WORD_COUNT - 1] &= __detail::__bit_tail_mask(_N);
+    }
+
+
+private:
+    word_type m_words[WORD_COUNT == 0 ? 1 : WORD_COUNT];
+};
+
+
+/**
+ * \brief Bitwise operations on two bitsets.
+ */
+template <std::size_t _N>
+constexpr bitset<_N> operator&(const bitset<_N>& lhs, const bitset<_N>& rhs) noexcept { bitset<_N> result(lhs); return result &= rhs; }
+
+template <std::size_t _N>
+constexpr bitset<_N> operator|(const bitset<_N>& lhs, const bitset<_N>& rhs) noexcept { bitset<_N> result(lhs); return result |= rhs; }
+
+template <std::size_t _N>
+constexpr bitset<_N> operator^(const bitset<_N>& lhs, const bitset<_N>& rhs) noexcept { bitset<_N> result(lhs); return result ^= rhs; }
+
+
+} // namespace mystl::
+
+
+#endif // BITSET_HPP_
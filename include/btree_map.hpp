@@ -0,0 +1,1295 @@
+/**
+ * \file btree_map.hpp
+ *
+ * \reference:
+ * - Rudolf Bayer, Edward McCreight, "Organization and Maintenance of Large
+ *   Ordered Indexes"
+ * - cppreference.com: std::map
+ */
+
+#pragma once
+
+#ifndef BTREE_MAP_HPP_
+#define BTREE_MAP_HPP_
+
+#include <cassert>          // assert
+#include <cstddef>          // size_t, ptrdiff_t
+#include <cstdint>          // uint32_t
+#include <functional>       // less
+#include <initializer_list> // initializer_list
+#include <iterator>         // bidirectional_iterator_tag, distance
+#include <memory>           // construct_at, destroy_at
+#include <new>              // launder
+#include <stdexcept>        // out_of_range
+#include <tuple>            // forward_as_tuple
+#include <type_traits>      // is_arithmetic_v, is_same_v, is_convertible_v
+#include <utility>          // pair, piecewise_construct, move, forward, swap
+
+#include "vector.hpp"       // vector
+
+
+namespace mystl {
+
+
+/**
+ * \brief Tag selecting the constructors that take input already sorted by key
+ * and free of equivalent keys.
+ */
+struct sorted_unique_t {
+    explicit sorted_unique_t() = default;
+};
+
+inline constexpr sorted_unique_t sorted_unique{};
+
+
+namespace __detail {
+
+
+inline constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+
+/**
+ * \brief Uninitialized storage for `_N` objects of type `_T`, whose lifetimes
+ * are managed by the owning node.
+ */
+template <typename _T, std::size_t _N>
+struct __btree_slots {
+    _T*       data()       noexcept { return std::launder(reinterpret_cast<_T*>(m_bytes)); }
+    const _T* data() const noexcept { return std::launder(reinterpret_cast<const _T*>(m_bytes)); }
+
+    _T&       operator[](std::size_t i)       noexcept { return data()[i]; }
+    const _T& operator[](std::size_t i) const noexcept { return data()[i]; }
+
+    alignas(_T) unsigned char m_bytes[_N * sizeof(_T)];
+};
+
+
+/**
+ * \brief Moves the object at `src` into the raw slot `dst` and ends the
+ * lifetime of `src`.
+ */
+template <typename _T>
+void __btree_relocate(_T* dst, _T* src) {
+    std::construct_at(dst, std::move(*src));
+    std::destroy_at(src);
+}
+
+
+/**
+ * \brief Opens a raw slot at `pos` by moving [pos, count) one slot right.
+ */
+template <typename _T>
+void __btree_shift_right(_T* data, std::size_t pos, std::size_t count) {
+    for (std::size_t i = count; i > pos; --i)
+        __btree_relocate(data + i, data + i - 1);
+}
+
+
+/**
+ * \brief Closes the raw slot at `pos` by moving [pos + 1, count) one slot left.
+ */
+template <typename _T>
+void __btree_shift_left(_T* data, std::size_t pos, std::size_t count) {
+    for (std::size_t i = pos; i + 1 < count; ++i)
+        __btree_relocate(data + i, data + i + 1);
+}
+
+
+/**
+ * \brief Key extractors for maps and sets.
+ */
+struct __btree_select_first {
+    template <typename _Pair>
+    const auto& operator()(const _Pair& value) const noexcept { return value.first; }
+};
+
+struct __btree_identity {
+    template <typename _T>
+    const _T& operator()(const _T& value) const noexcept { return value; }
+};
+
+
+/**
+ * \class __btree
+ *
+ * \brief A B+-tree of unique keys: the elements live in the leaves, which are
+ * chained in key order, and the inner nodes only hold separator keys.
+ *
+ * Node capacities are derived from `_NodeBytes` so that each node spans a
+ * whole number of cache lines. Keys of a node are searched with a branch-free
+ * linear count when they are arithmetic and compared with `std::less`, which
+ * compilers turn into SIMD compares, and with a binary search otherwise.
+ *
+ * Insertion and erasure invalidate all iterators.
+ *
+ * \tparam _Key: Type of the keys.
+ * \tparam _Value: Type of the elements.
+ * \tparam _KeyOfValue: Returns the key of an element.
+ * \tparam _Compare: Strict weak ordering on the keys.
+ * \tparam _NodeBytes: Target size of a node.
+ */
+template <typename _Key, typename _Value, typename _KeyOfValue, typename _Compare, std::size_t _NodeBytes>
+class __btree {
+private:
+    struct node_base;
+    struct leaf_node;
+    struct inner_node;
+
+    template <typename _Iter_val, typename _Iter_ptr, typename _Iter_ref>
+    class btree_iterator_base;
+
+public:
+    using key_type        = _Key;
+    using value_type      = _Value;
+    using size_type       = std::size_t;
+    using key_compare     = _Compare;
+    using iterator        = btree_iterator_base<_Value, _Value*, _Value&>;
+    using const_iterator  = btree_iterator_base<_Value, const _Value*, const _Value&>;
+
+
+private:
+    struct node_base {
+        bool          leaf  = true;
+        std::uint32_t count = 0;
+    };
+
+    static constexpr size_type max_of(size_type a, size_type b) { return a < b ? b : a; }
+
+public:
+    static constexpr size_type LEAF_SLOTS  = max_of(4, (_NodeBytes - sizeof(node_base) - 2 * sizeof(void*)) / sizeof(_Value));
+    static constexpr size_type INNER_SLOTS = max_of(4, (_NodeBytes - sizeof(node_base) - 2 * sizeof(void*) - sizeof(_Key))
+                                                       / (sizeof(_Key) + sizeof(void*)));
+
+private:
+    static constexpr size_type MIN_LEAF  = LEAF_SLOTS / 2;
+    static constexpr size_type MIN_INNER = INNER_SLOTS / 2;
+    static constexpr size_type MAX_DEPTH = 64;
+
+    static constexpr bool LINEAR_SEARCH = std::is_arithmetic_v<_Key>
+        && (std::is_same_v<_Compare, std::less<_Key>> || std::is_same_v<_Compare, std::less<>>);
+
+    /**
+     * \brief A leaf holds up to `LEAF_SLOTS` elements and links to its neighbours.
+     */
+    struct alignas(CACHE_LINE_SIZE) leaf_node : node_base {
+        leaf_node* prev = nullptr;
+        leaf_node* next = nullptr;
+        __btree_slots<_Value, LEAF_SLOTS> values;
+    };
+
+    /**
+     * \brief An inner node with `count` separator keys has `count + 1`
+     * children; child `i` holds the keys in [keys[i - 1], keys[i]). One extra
+     * slot lets a node overflow by one before it is split.
+     */
+    struct alignas(CACHE_LINE_SIZE) inner_node : node_base {
+        inner_node() noexcept { this->leaf = false; }
+
+        __btree_slots<_Key, INNER_SLOTS + 1> keys;
+        node_base*                           children[INNER_SLOTS + 2];
+    };
+
+    /**
+     * \brief An inner node on the way down and the child that was taken.
+     */
+    struct path_entry {
+        inner_node* node;
+        size_type   index;
+    };
+
+
+/* Iterators */
+private:
+    /**
+     * \brief Bidirectional iterator over the chained leaves, as a leaf and a
+     * slot in it; `end()` is one past the last slot of the last leaf.
+     *
+     * \tparam _Iter_val Type of the value that the iterator points to.
+     * \tparam _Iter_ptr Type of the pointer to the value (const or non-const).
+     * \tparam _Iter_ref Type of the reference to the value (const or non-const).
+     */
+    template <typename _Iter_val, typename _Iter_ptr, typename _Iter_ref>
+    class btree_iterator_base {
+        friend class __btree;
+
+        template <typename, typename, typename>
+        friend class btree_iterator_base;
+
+    public:
+        using value_type        = _Iter_val;
+        using pointer           = _Iter_ptr;
+        using reference         = _Iter_ref;
+        using difference_type   = std::ptrdiff_t;
+        using iterator_category = std::bidirectional_iterator_tag;
+
+    public:
+        btree_iterator_base(leaf_node* leaf = nullptr, size_type pos = 0) : p_leaf(leaf), m_pos(pos) {}
+
+        /**
+         * \brief Converts an `iterator` into a `const_iterator`.
+         */
+        template <typename _Ptr, typename _Ref>
+            requires (!std::is_same_v<_Ptr, _Iter_ptr> && std::is_convertible_v<_Ptr, _Iter_ptr>)
+        btree_iterator_base(const btree_iterator_base<_Iter_val, _Ptr, _Ref>& other)
+            : p_leaf(other.p_leaf), m_pos(other.m_pos) {}
+
+    public:
+        btree_iterator_base& operator++() {
+            assert(p_leaf != nullptr && "Attempting to increment an empty iterator");
+            if (++m_pos == p_leaf->count && p_leaf->next != nullptr) {
+                p_leaf = p_leaf->next;
+                m_pos = 0;
+            }
+            return *this;
+        }
+
+        btree_iterator_base operator++(int) {
+            btree_iterator_base old = *this;
+            ++*this;
+            return old;
+        }
+
+        btree_iterator_base& operator--() {
+            assert(p_leaf != nullptr && "Attempting to decrement an empty iterator");
+            if (m_pos == 0) {
+                p_leaf = p_leaf->prev;
+                m_pos = p_leaf->count;
+            }
+            --m_pos;
+            return *this;
+        }
+
+        btree_iterator_base operator--(int) {
+            btree_iterator_base old = *this;
+            --*this;
+            return old;
+        }
+
+        reference operator*() const {
+            assert(p_leaf != nullptr && m_pos < p_leaf->count && "Dereferencing an end iterator.");
+            return p_leaf->values[m_pos];
+        }
+
+        pointer operator->() const {
+            assert(p_leaf != nullptr && m_pos < p_leaf->count && "Dereferencing an end iterator.");
+            return &p_leaf->values[m_pos];
+        }
+
+        bool operator==(const btree_iterator_base& other) const noexcept {
+            return p_leaf == other.p_leaf && m_pos == other.m_pos;
+        }
+
+        bool operator!=(const btree_iterator_base& other) const noexcept {
+            return !(*this == other);
+        }
+
+    private:
+        leaf_node* p_leaf;
+        size_type  m_pos;
+    };
+
+
+/* Constructor and Destructor */
+public:
+    /**
+     */
+    explicit __btree(const key_compare& comp = key_compare())
+        : p_root(nullptr), p_first(nullptr), p_last(nullptr), m_size(0), m_comp(comp)
+    {
+    }
+
+    /**
+     * \brief Copy constructor, bulk loads the (already sorted) elements in O(n).
+     */
+    __btree(const __btree& other)
+        : __btree(other.m_comp)
+    {
+        build_sorted(other.cbegin(), other.cend());
+    }
+
+    /**
+     * \brief Move constructor, `other` is left empty.
+     */
+    __btree(__btree&& other) noexcept
+        : __btree(other.m_comp)
+    {
+        swap(other);
+    }
+
+    /**
+     */
+    ~__btree() { clear(); }
+
+
+/* Operators */
+public:
+    /**
+     */
+    __btree& operator=(const __btree& other) {
+        if (this != &other) {
+            __btree copy(other);
+            swap(copy);
+        }
+        return *this;
+    }
+
+    __btree& operator=(__btree&& other) noexcept {
+        if (this != &other) {
+            clear();
+            swap(other);
+        }
+        return *this;
+    }
+
+
+/* Iterators */
+public:
+    /**
+     */
+    iterator        begin()       noexcept { return iterator(p_first, 0); }
+    const_iterator cbegin() const noexcept { return const_iterator(p_first, 0); }
+
+    /**
+     */
+    iterator        end()       noexcept { return iterator(p_last, p_last != nullptr ? p_last->count : 0); }
+    const_iterator cend() const noexcept { return const_iterator(p_last, p_last != nullptr ? p_last->count : 0); }
+
+
+/* Capacity */
+public:
+    /**
+     */
+    size_type size() const noexcept { return m_size; }
+
+    /**
+     * \brief Returns the number of levels, 0 when empty and 1 for a single leaf.
+     */
+    size_type height() const noexcept {
+        size_type levels = 0;
+        for (const node_base* curr = p_root; curr != nullptr; ++levels)
+            curr = curr->leaf ? nullptr : static_cast<const inner_node*>(curr)->children[0];
+        return levels;
+    }
+
+
+/* Modifiers */
+public:
+    /**
+     * \brief Destroys all elements and frees every node.
+     */
+    void clear() noexcept {
+        if (p_root != nullptr)
+            destroy_subtree(p_root);
+        p_root = nullptr;
+        p_first = p_last = nullptr;
+        m_size = 0;
+    }
+
+    /**
+     * \brief Inserts an element constructed from `args` if `key` is not
+     * present; `args` are untouched otherwise.
+     *
+     * \note Strong exception guarantee as long as copying keys and moving
+     * elements do not throw.
+     */
+    template <typename... Args>
+    std::pair<iterator, bool> emplace_unique(const key_type& key, Args&&... args) {
+        //
+        if (p_root == nullptr) {
+            leaf_node* leaf = new leaf_node;
+            try {
+                std::construct_at(&leaf->values[0], std::forward<Args>(args)...);
+            }
+            catch (...) {
+                delete leaf;
+                throw;
+            }
+            leaf->count = 1;
+            p_root = p_first = p_last = leaf;
+            m_size = 1;
+            return {iterator(leaf, 0), true};
+        }
+
+        //
+        path_entry path[MAX_DEPTH];
+        size_type depth = 0;
+        leaf_node* leaf = descend(key, path, &depth);
+        size_type pos = leaf_lower(leaf, key);
+        if (pos < leaf->count && !m_comp(key, _KeyOfValue()(leaf->values[pos])))
+            return {iterator(leaf, pos), false};
+
+        // a full leaf is split first, the tree stays valid if the element then fails to construct
+        if (leaf->count == LEAF_SLOTS) {
+            leaf_node* right = split_leaf(leaf, path, depth);
+            size_type left_count = leaf->count;
+            if (pos > left_count) {
+                leaf = right;
+                pos -= left_count;
+            }
+        }
+
+        //
+        __btree_shift_right(leaf->values.data(), pos, leaf->count);
+        try {
+            std::construct_at(&leaf->values[pos], std::forward<Args>(args)...);
+        }
+        catch (...) {
+            __btree_shift_left(leaf->values.data(), pos, leaf->count + 1);
+            throw;
+        }
+        ++leaf->count;
+        ++m_size;
+        return {iterator(leaf, pos), true};
+    }
+
+    /**
+     * \brief Removes the element with key `key`, if any.
+     *
+     * \return The number of elements removed (0 or 1).
+     */
+    size_type erase_unique(const key_type& key) {
+        if (p_root == nullptr)
+            return 0;
+
+        //
+        path_entry path[MAX_DEPTH];
+        size_type depth = 0;
+        leaf_node* leaf = descend(key, path, &depth);
+        size_type pos = leaf_lower(leaf, key);
+        if (pos == leaf->count || m_comp(key, _KeyOfValue()(leaf->values[pos])))
+            return 0;
+
+        //
+        std::destroy_at(&leaf->values[pos]);
+        __btree_shift_left(leaf->values.data(), pos, leaf->count);
+        --leaf->count;
+        --m_size;
+        rebalance_leaf(leaf, path, depth);
+        return 1;
+    }
+
+    /**
+     * \brief Replaces the (empty) contents with the elements in [first, last),
+     * which must be sorted and free of equivalent keys. O(n): leaves are
+     * filled evenly and the inner levels are built bottom up.
+     */
+    template <std::forward_iterator ForwardIt>
+    void build_sorted(ForwardIt first, ForwardIt last) {
+        assert(p_root == nullptr && "build_sorted() needs an empty tree");
+        size_type n = static_cast<size_type>(std::distance(first, last));
+        if (n == 0)
+            return;
+
+        //
+        mystl::vector<inner_node*> inners;
+        try {
+            mystl::vector<std::pair<node_base*, const key_type*>> level;
+            size_type leaves = (n + LEAF_SLOTS - 1) / LEAF_SLOTS;
+            level.reserve(leaves);
+            for (size_type i = 0; i < leaves; ++i) {
+                leaf_node* leaf = new leaf_node;
+                leaf->prev = p_last;
+                if (p_last != nullptr)
+                    p_last->next = leaf;
+                else
+                    p_first = leaf;
+                p_last = leaf;
+
+                //
+                size_type count = n * (i + 1) / leaves - n * i / leaves;
+                for (; leaf->count < count; ++first) {
+                    std::construct_at(&leaf->values[leaf->count], *first);
+                    ++leaf->count;
+                    ++m_size;
+                }
+                assert((leaf->prev == nullptr || m_comp(_KeyOfValue()(leaf->prev->values[leaf->prev->count - 1]),
+                                                        _KeyOfValue()(leaf->values[0])))
+                       && "build_sorted() needs sorted, unique input");
+                level.push_back({leaf, &_KeyOfValue()(leaf->values[0])});
+            }
+
+            //
+            while (level.size() > 1) {
+                size_type m = level.size();
+                size_type groups = (m + INNER_SLOTS) / (INNER_SLOTS + 1);
+                mystl::vector<std::pair<node_base*, const key_type*>> parents;
+                parents.reserve(groups);
+                for (size_type g = 0; g < groups; ++g) {
+                    size_type begin = m * g / groups;
+                    size_type end = m * (g + 1) / groups;
+
+                    inners.push_back(nullptr);
+                    inner_node* inner = new inner_node;
+                    inners.back() = inner;
+                    inner->children[0] = level[begin].first;
+                    for (size_type j = begin + 1; j < end; ++j) {
+                        std::construct_at(&inner->keys[inner->count], *level[j].second);
+                        ++inner->count;
+                        inner->children[inner->count] = level[j].first;
+                    }
+                    parents.push_back({inner, level[begin].second});
+                }
+                level.swap(parents);
+            }
+            p_root = level[0].first;
+        }
+        catch (...) {
+            for (size_type i = 0; i < inners.size(); ++i) {
+                if (inners[i] != nullptr) {
+                    std::destroy(inners[i]->keys.data(), inners[i]->keys.data() + inners[i]->count);
+                    delete inners[i];
+                }
+            }
+            destroy_leaves();
+            throw;
+        }
+    }
+
+    /**
+     * \brief swaps the contents
+     */
+    void swap(__btree& other) noexcept {
+        using std::swap;
+        swap(p_root, other.p_root);
+        swap(p_first, other.p_first);
+        swap(p_last, other.p_last);
+        swap(m_size, other.m_size);
+        swap(m_comp, other.m_comp);
+    }
+
+
+/* Lookup */
+public:
+    /**
+     * \brief Returns the element with key `key`, or `end()`.
+     */
+    iterator find(const key_type& key) const {
+        if (p_root == nullptr)
+            return iterator();
+        leaf_node* leaf = descend(key, nullptr, nullptr);
+        size_type pos = leaf_lower(leaf, key);
+        if (pos < leaf->count && !m_comp(key, _KeyOfValue()(leaf->values[pos])))
+            return iterator(leaf, pos);
+        return end_iterator();
+    }
+
+    /**
+     * \brief Returns the first element whose key is not less than `key`.
+     */
+    iterator lower_bound(const key_type& key) const {
+        if (p_root == nullptr)
+            return iterator();
+        leaf_node* leaf = descend(key, nullptr, nullptr);
+        return normalize(leaf, leaf_lower(leaf, key));
+    }
+
+    /**
+     * \brief Returns the first element whose key is greater than `key`.
+     */
+    iterator upper_bound(const key_type& key) const {
+        if (p_root == nullptr)
+            return iterator();
+        leaf_node* leaf = descend(key, nullptr, nullptr);
+        return normalize(leaf, leaf_upper(leaf, key));
+    }
+
+
+/* Observers */
+public:
+    /**
+     */
+    key_compare key_comp() const { return m_comp; }
+
+
+private:
+    /**
+     * \brief Position of the child to descend into: the number of separator
+     * keys not greater than `key`.
+     */
+    size_type inner_upper(const inner_node* node, const key_type& key) const {
+        const key_type* keys = node->keys.data();
+        if constexpr (LINEAR_SEARCH) {
+            size_type pos = 0;
+            for (size_type i = 0; i < node->count; ++i)
+                pos += !(key < keys[i]);
+            return pos;
+        } else {
+            size_type lo = 0, hi = node->count;
+            while (lo < hi) {
+                size_type mid = lo + (hi - lo) / 2;
+                if (m_comp(key, keys[mid]))
+                    hi = mid;
+                else
+                    lo = mid + 1;
+            }
+            return lo;
+        }
+    }
+
+    /**
+     * \brief Number of elements in `leaf` whose key is less than `key`.
+     */
+    size_type leaf_lower(const leaf_node* leaf, const key_type& key) const {
+        if constexpr (LINEAR_SEARCH) {
+            size_type pos = 0;
+            for (size_type i = 0; i < leaf->count; ++i)
+                pos += _KeyOfValue()(leaf->values[i]) < key;
+            return pos;
+        } else {
+            size_type lo = 0, hi = leaf->count;
+            while (lo < hi) {
+                size_type mid = lo + (hi - lo) / 2;
+                if (m_comp(_KeyOfValue()(leaf->values[mid]), key))
+                    lo = mid + 1;
+                else
+                    hi = mid;
+            }
+            return lo;
+        }
+    }
+
+    /**
+     * \brief Number of elements in `leaf` whose key is not greater than `key`.
+     */
+    size_type leaf_upper(const leaf_node* leaf, const key_type& key) const {
+        if constexpr (LINEAR_SEARCH) {
+            size_type pos = 0;
+            for (size_type i = 0; i < leaf->count; ++i)
+                pos += !(key < _KeyOfValue()(leaf->values[i]));
+            return pos;
+        } else {
+            size_type lo = 0, hi = leaf->count;
+            while (lo < hi) {
+                size_type mid = lo + (hi - lo) / 2;
+                if (m_comp(key, _KeyOfValue()(leaf->values[mid])))
+                    hi = mid;
+                else
+                    lo = mid + 1;
+            }
+            return lo;
+        }
+    }
+
+    /**
+     * \brief Walks from the root to the leaf that may hold `key`, recording the
+     * inner nodes and child positions in `path` when it is not null.
+     */
+    leaf_node* descend(const key_type& key, path_entry* path, size_type* depth) const {
+        node_base* curr = p_root;
+        size_type level = 0;
+        while (!curr->leaf) {
+            inner_node* inner = static_cast<inner_node*>(curr);
+            size_type index = inner_upper(inner, key);
+            if (path != nullptr)
+                path[level] = {inner, index};
+            ++level;
+            curr = inner->children[index];
+        }
+        if (depth != nullptr)
+            *depth = level;
+        return static_cast<leaf_node*>(curr);
+    }
+
+    /**
+     */
+    iterator end_iterator() const noexcept { return iterator(p_last, p_last->count); }
+
+    /**
+     * \brief Moves a past-the-leaf position to the first slot of the next leaf.
+     */
+    static iterator normalize(leaf_node* leaf, size_type pos) noexcept {
+        if (pos == leaf->count && leaf->next != nullptr)
+            return iterator(leaf->next, 0);
+        return iterator(leaf, pos);
+    }
+
+    /**
+     * \brief Splits the full `leaf`, keeping its lower (LEAF_SLOTS + 1) / 2
+     * elements, and links the new right half into the parent.
+     */
+    leaf_node* split_leaf(leaf_node* leaf, path_entry* path, size_type depth) {
+        leaf_node* right = new leaf_node;
+        size_type keep = (LEAF_SLOTS + 1) / 2;
+        for (size_type i = keep; i < leaf->count; ++i)
+            __btree_relocate(&right->values[i - keep], &leaf->values[i]);
+        right->count = leaf->count - keep;
+        leaf->count = keep;
+
+        //
+        right->prev = leaf;
+        right->next = leaf->next;
+        if (leaf->next != nullptr)
+            leaf->next->prev = right;
+        else
+            p_last = right;
+        leaf->next = right;
+
+        //
+        insert_into_parent(leaf, _KeyOfValue()(right->values[0]), right, path, depth);
+        return right;
+    }
+
+    /**
+     * \brief Links `right` after `left` under the separator `key`, splitting
+     * full ancestors on the way up and growing a new root if needed.
+     */
+    void insert_into_parent(node_base* left, const key_type& key, node_base* right, path_entry* path, size_type depth) {
+        //
+        if (depth == 0) {
+            inner_node* root = new inner_node;
+            std::construct_at(&root->keys[0], key);
+            root->children[0] = left;
+            root->children[1] = right;
+            root->count = 1;
+            p_root = root;
+            return;
+        }
+
+        //
+        inner_node* parent = path[depth - 1].node;
+        size_type index = path[depth - 1].index;
+        __btree_shift_right(parent->keys.data(), index, parent->count);
+        std::construct_at(&parent->keys[index], key);
+        for (size_type i = parent->count + 1; i > index + 1; --i)
+            parent->children[i] = parent->children[i - 1];
+        parent->children[index + 1] = right;
+        ++parent->count;
+        if (parent->count <= INNER_SLOTS)
+            return;
+
+        // overflowed by one: the middle key moves up
+        inner_node* sibling = new inner_node;
+        size_type mid = parent->count / 2;
+        for (size_type i = mid + 1; i < parent->count; ++i) {
+            __btree_relocate(&sibling->keys[i - mid - 1], &parent->keys[i]);
+            sibling->children[i - mid - 1] = parent->children[i];
+        }
+        sibling->children[parent->count - mid - 1] = parent->children[parent->count];
+        sibling->count = static_cast<std::uint32_t>(parent->count - mid - 1);
+        parent->count = static_cast<std::uint32_t>(mid);
+
+        key_type up = std::move(parent->keys[mid]);
+        std::destroy_at(&parent->keys[mid]);
+        insert_into_parent(parent, up, sibling, path, depth - 1);
+    }
+
+    /**
+     * \brief Restores the minimum fill of `leaf` after an erasure by borrowing
+     * from a sibling or merging with it.
+     */
+    void rebalance_leaf(leaf_node* leaf, path_entry* path, size_type depth) {
+        if (depth == 0) {
+            if (leaf->count == 0) {
+                delete leaf;
+                p_root = nullptr;
+                p_first = p_last = nullptr;
+            }
+            return;
+        }
+        if (leaf->count >= MIN_LEAF)
+            return;
+
+        //
+        inner_node* parent = path[depth - 1].node;
+        size_type index = path[depth - 1].index;
+        leaf_node* left  = index > 0 ? static_cast<leaf_node*>(parent->children[index - 1]) : nullptr;
+        leaf_node* right = index < parent->count ? static_cast<leaf_node*>(parent->children[index + 1]) : nullptr;
+
+        //
+        if (left != nullptr && left->count > MIN_LEAF) {
+            __btree_shift_right(leaf->values.data(), 0, leaf->count);
+            __btree_relocate(&leaf->values[0], &left->values[left->count - 1]);
+            --left->count;
+            ++leaf->count;
+            parent->keys[index - 1] = _KeyOfValue()(leaf->values[0]);
+            return;
+        }
+        if (right != nullptr && right->count > MIN_LEAF) {
+            __btree_relocate(&leaf->values[leaf->count], &right->values[0]);
+            __btree_shift_left(right->values.data(), 0, right->count);
+            --right->count;
+            ++leaf->count;
+            parent->keys[index] = _KeyOfValue()(right->values[0]);
+            return;
+        }
+
+        //
+        if (left != nullptr) {
+            merge_leaves(left, leaf);
+            remove_child(parent, index - 1);
+        } else {
+            merge_leaves(leaf, right);
+            remove_child(parent, index);
+        }
+        rebalance_inner(path, depth - 1);
+    }
+
+    /**
+     * \brief Restores the minimum fill of the inner node `path[depth].node`,
+     * rotating a key through the parent or merging with a sibling; collapses
+     * an empty root.
+     */
+    void rebalance_inner(path_entry* path, size_type depth) {
+        inner_node* node = path[depth].node;
+        if (depth == 0) {
+            if (node->count == 0) {
+                p_root = node->children[0];
+                delete node;
+            }
+            return;
+        }
+        if (node->count >= MIN_INNER)
+            return;
+
+        //
+        inner_node* parent = path[depth - 1].node;
+        size_type index = path[depth - 1].index;
+        inner_node* left  = index > 0 ? static_cast<inner_node*>(parent->children[index - 1]) : nullptr;
+        inner_node* right = index < parent->count ? static_cast<inner_node*>(parent->children[index + 1]) : nullptr;
+
+        //
+        if (left != nullptr && left->count > MIN_INNER) {
+            __btree_shift_right(node->keys.data(), 0, node->count);
+            for (size_type i = node->count + 1; i > 0; --i)
+                node->children[i] = node->children[i - 1];
+            std::construct_at(&node->keys[0], std::move(parent->keys[index - 1]));
+            node->children[0] = left->children[left->count];
+            ++node->count;
+
+            parent->keys[index - 1] = std::move(left->keys[left->count - 1]);
+            std::destroy_at(&left->keys[left->count - 1]);
+            --left->count;
+            return;
+        }
+        if (right != nullptr && right->count > MIN_INNER) {
+            std::construct_at(&node->keys[node->count], std::move(parent->keys[index]));
+            node->children[node->count + 1] = right->children[0];
+            ++node->count;
+
+            parent->keys[index] = std::move(right->keys[0]);
+            std::destroy_at(&right->keys[0]);
+            __btree_shift_left(right->keys.data(), 0, right->count);
+            for (size_type i = 0; i < right->count; ++i)
+                right->children[i] = right->children[i + 1];
+            --right->count;
+            return;
+        }
+
+        //
+        if (left != nullptr) {
+            merge_inner(left, node, parent, index - 1);
+        } else {
+            merge_inner(node, right, parent, index);
+        }
+        rebalance_inner(path, depth - 1);
+    }
+
+    /**
+     * \brief Appends the elements of `src` to `dst`, unchains and frees `src`.
+     */
+    void merge_leaves(leaf_node* dst, leaf_node* src) noexcept {
+        for (size_type i = 0; i < src->count; ++i)
+            __btree_relocate(&dst->values[dst->count + i], &src->values[i]);
+        dst->count += src->count;
+
+        //
+        dst->next = src->next;
+        if (src->next != nullptr)
+            src->next->prev = dst;
+        else
+            p_last = dst;
+        delete src;
+    }
+
+    /**
+     * \brief Pulls the separator `parent->keys[index]` down into `dst`,
+     * appends `src` (the child right of it) and frees `src`.
+     */
+    void merge_inner(inner_node* dst, inner_node* src, inner_node* parent, size_type index) {
+        std::construct_at(&dst->keys[dst->count], std::move(parent->keys[index]));
+        for (size_type i = 0; i < src->count; ++i)
+            __btree_relocate(&dst->keys[dst->count + 1 + i], &src->keys[i]);
+        for (size_type i = 0; i <= src->count; ++i)
+            dst->children[dst->count + 1 + i] = src->children[i];
+        dst->count += src->count + 1;
+
+        //
+        delete src;
+        remove_child(parent, index);
+    }
+
+    /**
+     * \brief Removes the separator `keys[index]` and the child right of it.
+     */
+    static void remove_child(inner_node* parent, size_type index) {
+        std::destroy_at(&parent->keys[index]);
+        __btree_shift_left(parent->keys.data(), index, parent->count);
+        for (size_type i = index + 1; i < parent->count; ++i)
+            parent->children[i] = parent->children[i + 1];
+        --parent->count;
+    }
+
+    /**
+     */
+    void destroy_subtree(node_base* node) noexcept {
+        if (node->leaf) {
+            leaf_node* leaf = static_cast<leaf_node*>(node);
+            std::destroy(leaf->values.data(), leaf->values.data() + leaf->count);
+            delete leaf;
+            return;
+        }
+
+        //
+        inner_node* inner = static_cast<inner_node*>(node);
+        for (size_type i = 0; i <= inner->count; ++i)
+            destroy_subtree(inner->children[i]);
+        std::destroy(inner->keys.data(), inner->keys.data() + inner->count);
+        delete inner;
+    }
+
+    /**
+     * \brief Frees the leaf chain, used when a bulk load fails before the
+     * inner levels are complete.
+     */
+    void destroy_leaves() noexcept {
+        while (p_first != nullptr) {
+            leaf_node* next = p_first->next;
+            std::destroy(p_first->values.data(), p_first->values.data() + p_first->count);
+            delete p_first;
+            p_first = next;
+        }
+        p_root = nullptr;
+        p_last = nullptr;
+        m_size = 0;
+    }
+
+
+private:
+    node_base*  p_root;
+    leaf_node*  p_first;   // leftmost leaf, `begin()`
+    leaf_node*  p_last;    // rightmost leaf, `end()`
+    size_type   m_size;
+    [[no_unique_address]] key_compare m_comp;
+};
+
+
+} // namespace mystl::__detail
+
+
+/**
+ * \class btree_map
+ *
+ * \brief An ordered map of unique keys stored in a cache-conscious B+-tree.
+ *
+ * Nodes are `_NodeBytes` large and cache-line aligned, so a lookup touches
+ * one node per level instead of one per comparison as a red-black tree does,
+ * and a range scan walks contiguous slots of chained leaves. Unlike `std::map`,
+ * insertion and erasure move elements between slots and invalidate all
+ * iterators, pointers and references.
+ *
+ * \tparam _Key: Type of the keys.
+ * \tparam _T: Type of the mapped values.
+ * \tparam _Compare: Strict weak ordering on the keys.
+ * \tparam _NodeBytes: Target size of a node, a multiple of the cache line size.
+ */
+template <typename _Key, typename _T, typename _Compare = std::less<_Key>, std::size_t _NodeBytes = 256>
+class btree_map {
+private:
+    using tree_type = __detail::__btree<_Key, std::pair<const _Key, _T>, __detail::__btree_select_first, _Compare, _NodeBytes>;
+
+public:
+    using key_type        = _Key;
+    using mapped_type     = _T;
+    using value_type      = std::pair<const _Key, _T>;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using key_compare     = _Compare;
+    using reference       = value_type&;
+    using const_reference = const value_type&;
+    using iterator        = typename tree_type::iterator;
+    using const_iterator  = typename tree_type::const_iterator;
+
+    static constexpr size_type LEAF_SLOTS  = tree_type::LEAF_SLOTS;
+    static constexpr size_type INNER_SLOTS = tree_type::INNER_SLOTS;
+
+
+/* Constructor */
+public:
+    /**
+     * \brief Constructs an empty map.
+     */
+    btree_map() : m_tree() {}
+
+    explicit btree_map(const key_compare& comp) : m_tree(comp) {}
+
+    /**
+     * \brief Constructs the map from the elements in [first, last), keeping the
+     * first of any equivalent keys.
+     */
+    template <std::input_iterator InputIt>
+    btree_map(InputIt first, InputIt last, const key_compare& comp = key_compare())
+        : m_tree(comp)
+    {
+        insert(first, last);
+    }
+
+    /**
+     * \brief Bulk loads the elements in [first, last), which must be sorted by
+     * key and free of equivalent keys, in O(n).
+     */
+    template <std::forward_iterator ForwardIt>
+    btree_map(sorted_unique_t, ForwardIt first, ForwardIt last, const key_compare& comp = key_compare())
+        : m_tree(comp)
+    {
+        m_tree.build_sorted(first, last);
+    }
+
+    /**
+     * \brief Bulk loads a sorted vector of unique keys, see above.
+     */
+    btree_map(sorted_unique_t, const mystl::vector<value_type>& sorted, const key_compare& comp = key_compare())
+        : btree_map(sorted_unique, sorted.cbegin(), sorted.cend(), comp)
+    {
+    }
+
+    /**
+     * \brief Construct by initializer.
+     */
+    btree_map(std::initializer_list<value_type> initList, const key_compare& comp = key_compare())
+        : btree_map(initList.begin(), initList.end(), comp)
+    {
+    }
+
+
+/* Operators */
+public:
+    /**
+     * \brief Returns a reference to the value mapped to `key`, inserting a
+     * value-initialized one if there is none.
+     */
+    mapped_type& operator[](const key_type& key) {
+        return try_emplace(key).first->second;
+    }
+
+    mapped_type& operator[](key_type&& key) {
+        return try_emplace(std::move(key)).first->second;
+    }
+
+    /**
+     */
+    bool operator==(const btree_map& other) const {
+        if (size() != other.size())
+            return false;
+        for (const_iterator lhs = cbegin(), rhs = other.cbegin(); lhs != cend(); ++lhs, ++rhs)
+            if (!(*lhs == *rhs))
+                return false;
+        return true;
+    }
+
+
+/* Element access */
+public:
+    /**
+     * \brief Access the value mapped to `key` with bounds checking.
+     *
+     * \throws std::out_of_range if there is no such key.
+     */
+    mapped_type& at(const key_type& key) {
+        iterator it = m_tree.find(key);
+        if (it == m_tree.end())
+            throw std::out_of_range("btree_map::at");
+        return it->second;
+    }
+
+    const mapped_type& at(const key_type& key) const {
+        const_iterator it = m_tree.find(key);
+        if (it == m_tree.cend())
+            throw std::out_of_range("btree_map::at");
+        return it->second;
+    }
+
+
+/* Iterators */
+public:
+    /**
+     */
+    iterator        begin()       noexcept { return m_tree.begin(); }
+    const_iterator  begin() const noexcept { return m_tree.cbegin(); }
+    const_iterator cbegin() const noexcept { return m_tree.cbegin(); }
+
+    /**
+     */
+    iterator        end()       noexcept { return m_tree.end(); }
+    const_iterator  end() const noexcept { return m_tree.cend(); }
+    const_iterator cend() const noexcept { return m_tree.cend(); }
+
+
+/* Capacity */
+public:
+    /**
+     */
+    size_type size() const noexcept { return m_tree.size(); }
+
+    /**
+     */
+    [[nodiscard]] bool empty() const noexcept { return m_tree.size() == 0; }
+
+    /**
+     * \brief Returns the number of levels of the tree.
+     */
+    size_type height() const noexcept { return m_tree.height(); }
+
+
+/* Modifiers */
+public:
+    /**
+     */
+    void clear() noexcept { m_tree.clear(); }
+
+    /**
+     * \brief Inserts `value` if its key is not present yet.
+     */
+    std::pair<iterator, bool> insert(const value_type& value) {
+        return m_tree.emplace_unique(value.first, value);
+    }
+
+    std::pair<iterator, bool> insert(value_type&& value) {
+        const key_type& key = value.first;
+        return m_tree.emplace_unique(key, std::move(value));
+    }
+
+    /**
+     * \brief Inserts the elements in [first, last) whose keys are not present yet.
+     */
+    template <std::input_iterator InputIt>
+    void insert(InputIt first, InputIt last) {
+        for (; first != last; ++first)
+            insert(*first);
+    }
+
+    /**
+     * \brief Constructs an element from `args` and inserts it if its key is
+     * not present yet.
+     */
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(Args&&... args) {
+        value_type value(std::forward<Args>(args)...);
+        return m_tree.emplace_unique(value.first, std::move(value));
+    }
+
+    /**
+     * \brief Inserts an element with key `key` and value constructed from
+     * `args` if the key is not present yet; `args` are untouched otherwise.
+     */
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(const key_type& key, Args&&... args) {
+        return m_tree.emplace_unique(key, std::piecewise_construct, std::forward_as_tuple(key),
+                                     std::forward_as_tuple(std::forward<Args>(args)...));
+    }
+
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(key_type&& key, Args&&... args) {
+        return m_tree.emplace_unique(key, std::piecewise_construct, std::forward_as_tuple(std::move(key)),
+                                     std::forward_as_tuple(std::forward<Args>(args)...));
+    }
+
+    /**
+     * \brief Inserts `value` under `key`, or assigns it if the key is present.
+     */
+    template <typename _M>
+    std::pair<iterator, bool> insert_or_assign(const key_type& key, _M&& value) {
+        auto result = try_emplace(key, std::forward<_M>(value));
+        if (!result.second)
+            result.first->second = std::forward<_M>(value);
+        return result;
+    }
+
+    /**
+     * \brief Removes the element with key `key`, if any.
+     *
+     * \return The number of elements removed (0 or 1).
+     */
+    size_type erase(const key_type& key) { return m_tree.erase_unique(key); }
+
+    /**
+     * \brief Removes the element at `pos`.
+     *
+     * \return An iterator to the element after the removed one.
+     */
+    iterator erase(const_iterator pos) {
+        key_type key = pos->first;
+        m_tree.erase_unique(key);
+        return m_tree.upper_bound(key);
+    }
+
+    /**
+     * \brief swaps the contents
+     */
+    void swap(btree_map& other) noexcept { m_tree.swap(other.m_tree); }
+
+
+/* Lookup */
+public:
+    /**
+     */
+    size_type count(const key_type& key) const { return contains(key) ? 1 : 0; }
+
+    /**
+     */
+    iterator       find(const key_type& key)       { return m_tree.find(key); }
+    const_iterator find(const key_type& key) const { return m_tree.find(key); }
+
+    /**
+     */
+    bool contains(const key_type& key) const { return m_tree.find(key) != m_tree.cend(); }
+
+    /**
+     * \brief Returns an iterator to the first element whose key is not less
+     * than `key`.
+     */
+    iterator       lower_bound(const key_type& key)       { return m_tree.lower_bound(key); }
+    const_iterator lower_bound(const key_type& key) const { return m_tree.lower_bound(key); }
+
+    /**
+     * \brief Returns an iterator to the first element whose key is greater
+     * than `key`.
+     */
+    iterator       upper_bound(const key_type& key)       { return m_tree.upper_bound(key); }
+    const_iterator upper_bound(const key_type& key) const { return m_tree.upper_bound(key); }
+
+    /**
+     */
+    std::pair<iterator, iterator> equal_range(const key_type& key) {
+        return {lower_bound(key), upper_bound(key)};
+    }
+
+    std::pair<const_iterator, const_iterator> equal_range(const key_type& key) const {
+        return {lower_bound(key), upper_bound(key)};
+    }
+
+
+/* Observers */
+public:
+    /**
+     */
+    key_compare key_comp() const { return m_tree.key_comp(); }
+
+
+private:
+    tree_type m_tree;
+};
+
+
+/**
+ * \brief Specializes the std::swap algorithm for mystl::btree_map.
+ */
+template <typename K, typename T, typename C, std::size_t B>
+void swap(btree_map<K, T, C, B>& lhs, btree_map<K, T, C, B>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+
+} // namespace mystl::
+
+
+#endif // BTREE_MAP_HPP_
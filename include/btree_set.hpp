@@ -0,0 +1,262 @@
+/**
+ * \file btree_set.hpp
+ *
+ * \reference:
+ * - cppreference.com: std::set
+ */
+
+#pragma once
+
+#ifndef BTREE_SET_HPP_
+#define BTREE_SET_HPP_
+
+#include <cstddef>          // size_t, ptrdiff_t
+#include <functional>       // less
+#include <initializer_list> // initializer_list
+#include <iterator>         // input_iterator, forward_iterator
+#include <utility>          // pair, move, forward
+
+#include "btree_map.hpp"    // __btree, sorted_unique_t
+#include "vector.hpp"       // vector
+
+
+namespace mystl {
+
+
+/**
+ * \class btree_set
+ *
+ * \brief An ordered set of unique keys stored in the same cache-conscious
+ * B+-tree as `btree_map`.
+ *
+ * Insertion and erasure invalidate all iterators, pointers and references.
+ *
+ * \tparam _Key: Type of the keys.
+ * \tparam _Compare: Strict weak ordering on the keys.
+ * \tparam _NodeBytes: Target size of a node, a multiple of the cache line size.
+ */
+template <typename _Key, typename _Compare = std::less<_Key>, std::size_t _NodeBytes = 256>
+class btree_set {
+private:
+    using tree_type = __detail::__btree<_Key, _Key, __detail::__btree_identity, _Compare, _NodeBytes>;
+
+public:
+    using key_type        = _Key;
+    using value_type      = _Key;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using key_compare     = _Compare;
+    using reference       = value_type&;
+    using const_reference = const value_type&;
+    using iterator        = typename tree_type::const_iterator;
+    using const_iterator  = typename tree_type::const_iterator;
+
+    static constexpr size_type LEAF_SLOTS  = tree_type::LEAF_SLOTS;
+    static constexpr size_type INNER_SLOTS = tree_type::INNER_SLOTS;
+
+
+/* Constructor */
+public:
+    /**
+     * \brief Constructs an empty set.
+     */
+    btree_set() : m_tree() {}
+
+    explicit btree_set(const key_compare& comp) : m_tree(comp) {}
+
+    /**
+     * \brief Constructs the set from the keys in [first, last).
+     */
+    template <std::input_iterator InputIt>
+    btree_set(InputIt first, InputIt last, const key_compare& comp = key_compare())
+        : m_tree(comp)
+    {
+        insert(first, last);
+    }
+
+    /**
+     * \brief Bulk loads the keys in [first, last), which must be sorted and
+     * free of equivalent keys, in O(n).
+     */
+    template <std::forward_iterator ForwardIt>
+    btree_set(sorted_unique_t, ForwardIt first, ForwardIt last, const key_compare& comp = key_compare())
+        : m_tree(comp)
+    {
+        m_tree.build_sorted(first, last);
+    }
+
+    /**
+     * \brief Bulk loads a sorted vector of unique keys, see above.
+     */
+    btree_set(sorted_unique_t, const mystl::vector<value_type>& sorted, const key_compare& comp = key_compare())
+        : btree_set(sorted_unique, sorted.cbegin(), sorted.cend(), comp)
+    {
+    }
+
+    /**
+     * \brief Construct by initializer.
+     */
+    btree_set(std::initializer_list<value_type> initList, const key_compare& comp = key_compare())
+        : btree_set(initList.begin(), initList.end(), comp)
+    {
+    }
+
+
+/* Operators */
+public:
+    /**
+     */
+    bool operator==(const btree_set& other) const {
+        if (size() != other.size())
+            return false;
+        for (const_iterator lhs = cbegin(), rhs = other.cbegin(); lhs != cend(); ++lhs, ++rhs)
+            if (!(*lhs == *rhs))
+                return false;
+        return true;
+    }
+
+
+/* Iterators */
+public:
+    /**
+     */
+    const_iterator  begin() const noexcept { return m_tree.cbegin(); }
+    const_iterator cbegin() const noexcept { return m_tree.cbegin(); }
+
+    /**
+     */
+    const_iterator  end() const noexcept { return m_tree.cend(); }
+    const_iterator cend() const noexcept { return m_tree.cend(); }
+
+
+/* Capacity */
+public:
+    /**
+     */
+    size_type size() const noexcept { return m_tree.size(); }
+
+    /**
+     */
+    [[nodiscard]] bool empty() const noexcept { return m_tree.size() == 0; }
+
+    /**
+     * \brief Returns the number of levels of the tree.
+     */
+    size_type height() const noexcept { return m_tree.height(); }
+
+
+/* Modifiers */
+public:
+    /**
+     */
+    void clear() noexcept { m_tree.clear(); }
+
+    /**
+     * \brief Inserts `key` if it is not present yet.
+     */
+    std::pair<iterator, bool> insert(const value_type& key) {
+        return m_tree.emplace_unique(key, key);
+    }
+
+    std::pair<iterator, bool> insert(value_type&& key) {
+        return m_tree.emplace_unique(key, std::move(key));
+    }
+
+    /**
+     * \brief Inserts the keys in [first, last) that are not present yet.
+     */
+    template <std::input_iterator InputIt>
+    void insert(InputIt first, InputIt last) {
+        for (; first != last; ++first)
+            insert(*first);
+    }
+
+    /**
+     * \brief Constructs a key from `args` and inserts it if it is not present yet.
+     */
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(Args&&... args) {
+        value_type key(std::forward<Args>(args)...);
+        return m_tree.emplace_unique(key, std::move(key));
+    }
+
+    /**
+     * \brief Removes `key`, if present.
+     *
+     * \return The number of elements removed (0 or 1).
+     */
+    size_type erase(const key_type& key) { return m_tree.erase_unique(key); }
+
+    /**
+     * \brief Removes the element at `pos`.
+     *
+     * \return An iterator to the element after the removed one.
+     */
+    iterator erase(const_iterator pos) {
+        key_type key = *pos;
+        m_tree.erase_unique(key);
+        return m_tree.upper_bound(key);
+    }
+
+    /**
+     * \brief swaps the contents
+     */
+    void swap(btree_set& other) noexcept { m_tree.swap(other.m_tree); }
+
+
+/* Lookup */
+public:
+    /**
+     */
+    size_type count(const key_type& key) const { return contains(key) ? 1 : 0; }
+
+    /**
+     */
+    const_iterator find(const key_type& key) const { return m_tree.find(key); }
+
+    /**
+     */
+    bool contains(const key_type& key) const { return m_tree.find(key) != m_tree.cend(); }
+
+    /**
+     * \brief Returns an iterator to the first key not less than `key`.
+     */
+    const_iterator lower_bound(const key_type& key) const { return m_tree.lower_bound(key); }
+
+    /**
+     * \brief Returns an iterator to the first key greater than `key`.
+     */
+    const_iterator upper_bound(const key_type& key) const { return m_tree.upper_bound(key); }
+
+    /**
+     */
+    std::pair<const_iterator, const_iterator> equal_range(const key_type& key) const {
+        return {lower_bound(key), upper_bound(key)};
+    }
+
+
+/* Observers */
+public:
+    /**
+     */
+    key_compare key_comp() const { return m_tree.key_comp(); }
+
+
+private:
+    tree_type m_tree;
+};
+
+
+/**
+ * \brief Specializes the std::swap algorithm for mystl::btree_set.
+ */
+template <typename K, typename C, std::size_t B>
+void swap(btree_set<K, C, B>& lhs, btree_set<K, C, B>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+
+} // namespace mystl::
+
+
+#endif // BTREE_SET_HPP_
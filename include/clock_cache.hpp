@@ -0,0 +1,252 @@
+/**
+ * \file clock_cache.hpp
+ */
+
+#pragma once
+
+#ifndef CLOCK_CACHE_HPP_
+#define CLOCK_CACHE_HPP_
+
+#include <cstddef>          // size_t
+#include <cstdint>          // uint32_t
+#include <functional>       // hash, equal_to
+#include <utility>          // move
+
+#include "lru_cache.hpp"    // __cache_index
+#include "vector.hpp"       // vector
+
+
+namespace mystl {
+
+
+/**
+ * \class clock_cache
+ *
+ * \brief A bounded key-value cache with CLOCK (second chance) eviction, an
+ * approximation of LRU with a cheaper hit path.
+ *
+ * Entries live in one contiguous array of slots. A hit only sets the slot's
+ * referenced bit instead of relinking a node, and there are no per-entry
+ * links. To make room, a hand sweeps the slots, clearing referenced bits
+ * until it finds an unreferenced slot to overwrite in place.
+ *
+ * \tparam _Key: Type of the keys.
+ * \tparam _T: Type of the cached values.
+ * \tparam _Hash: Hash function for the keys.
+ * \tparam _KeyEqual: Equality for the keys.
+ *
+ * \note The capacity is an entry count. Storage for all slots is reserved up
+ * front, so `put` never moves an entry and pointers returned by `get` stay
+ * valid until their entry is replaced. `erase` keeps the slots dense by
+ * moving the last entry into the freed slot, so it invalidates every pointer
+ * returned by `get`, not only the ones to the erased entry.
+ */
+template <typename _Key, typename _T, typename _Hash = std::hash<_Key>,
+          typename _KeyEqual = std::equal_to<_Key>>
+class clock_cache {
+private:
+    struct slot {
+        _Key        key;
+        _T          value;
+        std::size_t hash;
+        bool        referenced;
+    };
+
+    using index_type = __detail::__cache_index<std::uint32_t>;
+
+public:
+    using key_type    = _Key;
+    using mapped_type = _T;
+    using size_type   = std::size_t;
+    using hasher      = _Hash;
+    using key_equal   = _KeyEqual;
+
+
+/* Constructor */
+public:
+    /**
+     * \brief Constructs an empty cache holding at most `capacity` entries.
+     */
+    explicit clock_cache(size_type capacity, const hasher& hash = hasher(), const key_equal& equal = key_equal())
+        : m_slots(), m_index(), m_capacity(capacity), m_hand(0), m_hash(hash), m_equal(equal)
+    {
+        m_slots.reserve(capacity);
+        m_index.reserve(capacity);
+    }
+
+    clock_cache(const clock_cache&) = delete;
+    clock_cache& operator=(const clock_cache&) = delete;
+
+
+/* Lookup */
+public:
+    /**
+     * \brief Returns the value cached under `key` and marks it referenced, or
+     * null on a miss.
+     */
+    mapped_type* get(const key_type& key) {
+        size_type bucket = find_bucket(key, m_hash(key));
+        if (bucket == index_type::npos)
+            return nullptr;
+
+        //
+        slot& s = m_slots[m_index.ref(bucket)];
+        s.referenced = true;
+        return &s.value;
+    }
+
+    /**
+     * \brief Returns the value cached under `key` without marking it
+     * referenced, or null on a miss.
+     */
+    const mapped_type* peek(const key_type& key) const {
+        size_type bucket = find_bucket(key, m_hash(key));
+        if (bucket == index_type::npos)
+            return nullptr;
+        return &m_slots[m_index.ref(bucket)].value;
+    }
+
+    /**
+     * \brief Checks whether `key` is cached, without marking it referenced.
+     */
+    bool contains(const key_type& key) const { return peek(key) != nullptr; }
+
+
+/* Modifiers */
+public:
+    /**
+     * \brief Caches `value` under `key`, replacing any previous value and
+     * evicting an unreferenced entry if the cache is full.
+     *
+     * \return Whether the entry is cached; false only for a zero capacity.
+     */
+    bool put(const key_type& key, mapped_type value) {
+        std::size_t hash = m_hash(key);
+        size_type bucket = find_bucket(key, hash);
+
+        // update in place
+        if (bucket != index_type::npos) {
+            slot& s = m_slots[m_index.ref(bucket)];
+            s.value = std::move(value);
+            s.referenced = true;
+            return true;
+        }
+        if (m_capacity == 0)
+            return false;
+
+        // fill a free slot
+        if (m_slots.size() < m_capacity) {
+            m_slots.push_back(slot{key, std::move(value), hash, false});
+            m_index.insert(hash, static_cast<std::uint32_t>(m_slots.size() - 1));
+            return true;
+        }
+
+        // overwrite the victim in place
+        std::uint32_t victim = sweep();
+        slot& s = m_slots[victim];
+        m_index.erase(find_slot(victim));
+        s.key = key;
+        s.value = std::move(value);
+        s.hash = hash;
+        s.referenced = false;
+        m_index.insert(hash, victim);
+        return true;
+    }
+
+    /**
+     * \brief Removes the entry for `key`, if any.
+     *
+     * \return Whether an entry was removed.
+     *
+     * \note Moves the last slot into the freed one to keep the slots dense,
+     * which invalidates all pointers returned by `get`.
+     */
+    bool erase(const key_type& key) {
+        size_type bucket = find_bucket(key, m_hash(key));
+        if (bucket == index_type::npos)
+            return false;
+
+        //
+        std::uint32_t hole = m_index.ref(bucket);
+        std::uint32_t last = static_cast<std::uint32_t>(m_slots.size() - 1);
+        m_index.erase(bucket);
+        if (hole != last) {
+            m_index.ref(find_slot(last)) = hole;
+            m_slots[hole] = std::move(m_slots[last]);
+        }
+        m_slots.pop_back();
+        if (m_hand >= m_slots.size())
+            m_hand = 0;
+        return true;
+    }
+
+    /**
+     * \brief Removes all entries.
+     */
+    void clear() {
+        m_slots.clear();
+        m_index.clear();
+        m_hand = 0;
+    }
+
+
+/* Capacity */
+public:
+    /**
+     * \brief Returns the number of entries.
+     */
+    size_type size() const noexcept { return m_slots.size(); }
+
+    /**
+     */
+    [[nodiscard]] bool empty() const noexcept { return m_slots.size() == 0; }
+
+    /**
+     * \brief Returns the maximum number of entries.
+     */
+    size_type capacity() const noexcept { return m_capacity; }
+
+
+private:
+    /**
+     */
+    size_type find_bucket(const key_type& key, std::size_t hash) const {
+        return m_index.find(hash, [&](std::uint32_t i) { return m_equal(m_slots[i].key, key); });
+    }
+
+    /**
+     * \brief Returns the bucket that refers to slot `i`.
+     */
+    size_type find_slot(std::uint32_t i) const {
+        return m_index.find(m_slots[i].hash, [&](std::uint32_t j) { return j == i; });
+    }
+
+    /**
+     * \brief Advances the hand past referenced slots, clearing their bits, and
+     * returns the first unreferenced one. Terminates within two laps.
+     */
+    std::uint32_t sweep() noexcept {
+        while (m_slots[m_hand].referenced) {
+            m_slots[m_hand].referenced = false;
+            m_hand = (m_hand + 1 == m_slots.size()) ? 0 : m_hand + 1;
+        }
+        std::uint32_t victim = static_cast<std::uint32_t>(m_hand);
+        m_hand = (m_hand + 1 == m_slots.size()) ? 0 : m_hand + 1;
+        return victim;
+    }
+
+
+private:
+    mystl::vector<slot> m_slots;
+    index_type          m_index;
+    size_type           m_capacity;
+    size_type           m_hand;     // next slot the sweep inspects
+    [[no_unique_address]] hasher    m_hash;
+    [[no_unique_address]] key_equal m_equal;
+};
+
+
+} // namespace mystl::
+
+
+#endif // CLOCK_CACHE_HPP_
@@ -0,0 +1,188 @@
+/**
+ * \file double_ended_priority_queue.hpp
+ */
+
+#pragma once
+
+#ifndef DOUBLE_ENDED_PRIORITY_QUEUE_HPP_
+#define DOUBLE_ENDED_PRIORITY_QUEUE_HPP_
+
+#include <functional>   // std::less
+#include <utility>      // std::move
+#include <iterator>     // std::input_iterator
+#include <stdexcept>    // std::out_of_range
+
+#include "vector.hpp"
+#include "algorithm/minmax_heap.hpp"
+
+namespace mystl {
+
+/**
+ * \class double_ended_priority_queue
+ *
+ * \brief A container adaptor giving access to both the smallest and the
+ * largest element, kept as a min-max heap in a single container.
+ *
+ * Both ends are read in O(1) and removed in O(log n), without the second
+ * heap and lazy deletion that two `priority_queue`s would need.
+ *
+ * \tparam _T: Type of the elements.
+ * \tparam _Container: Type of the underlying container, must support random
+ * access iterators (defaults to `mystl::vector<_T>`).
+ * \tparam _Compare: Comparison functor type that orders the elements,
+ * defaults to `std::less<>`.
+ */
+template <class _T, class _Container = mystl::vector<_T>,
+          class _Compare = std::less<typename _Container::value_type> >
+class double_ended_priority_queue {
+public:
+    using container_type  = _Container;
+    using value_compare   = _Compare;
+    using value_type      = typename _Container::value_type;
+    using size_type       = typename _Container::size_type;
+    using reference       = typename _Container::reference;
+    using const_reference = typename _Container::const_reference;
+
+/* Constructor */
+public:
+    /**
+     * \brief Construct an empty double_ended_priority_queue.
+     */
+    double_ended_priority_queue()
+        : m_container(container_type()), m_comp(value_compare()) {}
+
+
+    /**
+     * \brief Construct an empty double_ended_priority_queue with a custom comparison functor.
+     */
+    explicit double_ended_priority_queue(const value_compare& comp)
+        : m_container(container_type()), m_comp(comp) {}
+
+
+    /**
+     * \brief Construct the double_ended_priority_queue from an existing
+     *        container, heapified in O(n).
+     */
+    double_ended_priority_queue(const value_compare& comp, container_type container)
+        : m_container(std::move(container)), m_comp(comp)
+    {
+        mystl::make_minmax_heap(m_container.begin(), m_container.end(), m_comp);
+    }
+
+
+    /**
+     * \brief Constructs the double_ended_priority_queue from a range and an
+     *        optional comparison functor.
+     */
+    template <std::input_iterator InputIt>
+    double_ended_priority_queue(InputIt first, InputIt last, const value_compare& comp = value_compare())
+        : m_container(first, last), m_comp(comp)
+    {
+        mystl::make_minmax_heap(m_container.begin(), m_container.end(), m_comp);
+    }
+
+
+/* Element access */
+public:
+    /**
+     * \brief Access the smallest element.
+     *
+     * \throws std::out_of_range if the queue is empty.
+     */
+    const_reference min() const { return m_container.front(); }
+
+
+    /**
+     * \brief Access the largest element.
+     *
+     * \throws std::out_of_range if the queue is empty.
+     */
+    const_reference max() const {
+        if (empty())
+            throw std::out_of_range("double_ended_priority_queue::max(): the queue is empty");
+        return *mystl::minmax_heap_max(m_container.cbegin(), m_container.cend(), m_comp);
+    }
+
+
+/* Capacity */
+public:
+    /**
+     * \brief Checks whether the double_ended_priority_queue is empty.
+     */
+    bool empty() const { return m_container.empty(); }
+
+
+    /**
+     * \brief Returns the number of elements.
+     */
+    size_type size() const { return m_container.size(); }
+
+
+/* Modifiers */
+public:
+    /**
+     * \brief Inserts an element.
+     */
+    void push(const_reference value) {
+        m_container.push_back(value);
+        mystl::push_minmax_heap(m_container.begin(), m_container.end(), m_comp);
+    }
+
+
+    /**
+     * \brief Inserts a movable element.
+     */
+    void push(value_type&& value) {
+        m_container.push_back(std::move(value));
+        mystl::push_minmax_heap(m_container.begin(), m_container.end(), m_comp);
+    }
+
+
+    /**
+     * \brief Constructs an element in-place.
+     */
+    template <typename... Args>
+    void emplace(Args&&... args) {
+        m_container.emplace_back(std::forward<Args>(args)...);
+        mystl::push_minmax_heap(m_container.begin(), m_container.end(), m_comp);
+    }
+
+
+    /**
+     * \brief Removes the smallest element.
+     */
+    void pop_min() {
+        mystl::pop_min(m_container.begin(), m_container.end(), m_comp);
+        m_container.pop_back();
+    }
+
+
+    /**
+     * \brief Removes the largest element.
+     */
+    void pop_max() {
+        mystl::pop_max(m_container.begin(), m_container.end(), m_comp);
+        m_container.pop_back();
+    }
+
+
+    /**
+     * \brief Swaps this double_ended_priority_queue with another one.
+     */
+    void swap(double_ended_priority_queue& other) noexcept {
+        std::swap(m_container, other.m_container);
+        std::swap(m_comp, other.m_comp);
+    }
+
+
+/**/
+private:
+    container_type m_container;
+    value_compare  m_comp;
+};
+
+
+} // namespace mystl::
+
+
+#endif // DOUBLE_ENDED_PRIORITY_QUEUE_HPP_
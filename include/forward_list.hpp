@@ -14,14 +14,25 @@
 #include <initializer_list> // initializer_list
 #include <cassert>          // assert
 #include <stdexcept>        // out_of_range, logic_error
+#include <type_traits>      // conditional_t
+
+#include "node_handle.hpp"   // node_handle
+#include "instrument.hpp"    // instrument::__detail::__counted_node
+#include "trace.hpp"         // trace::scope
 
 namespace mystl {
 
 
 
 /**
+ * \class forward_list
+ *
+ * \tparam _T: Type of the elements.
+ * \tparam _CacheTail: Keep a pointer to the last node, which enables O(1)
+ *         `push_back`/`emplace_back` and O(1) whole-list `splice_after`, at the
+ *         cost of one pointer and of keeping it up to date in every modifier.
  */
-template <typename _T>
+template <typename _T, bool _CacheTail = false>
 class forward_list {
 private:
     struct node;
@@ -40,12 +51,13 @@ public:
     using const_iterator  = forward_iterator_base<_T, const_pointer, const_reference>;
 
     using node_pointer    = node*;
+    using node_type       = node_handle<node, value_type>;
 
 
 private:
     /**
      */
-    struct node {
+    struct node : instrument::__detail::__counted_node<instrument::event::forward_list_node_allocs, instrument::event::forward_list_node_frees> {
         node() = default;
 
         node(const _T& data, node* next = nullptr) 
@@ -76,7 +88,7 @@ private:
      */
     template <typename _Iter_val, typename _Iter_ptr, typename _Iter_ref>
     class forward_iterator_base {
-        friend class forward_list<_T>;
+        friend class forward_list;
 
     public:
         using value_type        = _Iter_val;
@@ -136,7 +148,7 @@ public:
      * Default constructor
      */
     forward_list()
-        : m_size(0), p_before_head(new node)
+        : m_size(0), p_before_head(new node), p_tail(p_before_head)
     {
     }
 
@@ -144,7 +156,7 @@ public:
      * \brief Constructs the container with count copies of elements with value value.
      */
     explicit forward_list(size_type count, const_reference value = value_type())
-        : m_size(0), p_before_head(new node)
+        : m_size(0), p_before_head(new node), p_tail(p_before_head)
     {
         insert_after(cbefore_begin(), count, value);
     }
@@ -158,7 +170,7 @@ public:
      */
     template <std::input_iterator InputIt>
     forward_list(InputIt first, InputIt last)
-        : m_size(0), p_before_head(new node)
+        : m_size(0), p_before_head(new node), p_tail(p_before_head)
     {
         insert_after(cbefore_begin(), first, last);
     }
@@ -167,7 +179,7 @@ public:
      * Copy constructor
      */
     forward_list(const forward_list& other) 
-        : m_size(0), p_before_head(new node)
+        : m_size(0), p_before_head(new node), p_tail(p_before_head)
     {
         // 
         node_pointer curr = p_before_head;
@@ -180,23 +192,25 @@ public:
             curr = curr->next;
             ++m_size;
         }
+        set_tail(curr);
     }
 
     /**
      * Move constructor
      */
     forward_list(forward_list&& other) noexcept
-        : m_size(other.m_size), p_before_head(std::move(other.p_before_head))
+        : m_size(other.m_size), p_before_head(std::move(other.p_before_head)), p_tail(other.p_tail)
     {
         other.m_size = 0;
         other.p_before_head = new node;   // reset other.p_before_head to a valid empty state
+        other.p_tail = other.p_before_head;
     }
 
     /**
      * \brief Construct by initializer.
      */
     forward_list(std::initializer_list<value_type> initList) 
-        : m_size(0), p_before_head(new node)
+        : m_size(0), p_before_head(new node), p_tail(p_before_head)
     {
         insert_after(cbefore_begin(), initList);
     }
@@ -232,6 +246,7 @@ public:
                 curr = curr->next;
                 ++m_size;
             }
+            set_tail(curr);
         }
 
         // 
@@ -250,10 +265,12 @@ public:
             // 
             m_size = other.m_size;
             p_before_head = std::move(other.p_before_head);
+            p_tail = other.p_tail;
 
             // 
             other.m_size = 0;
             other.p_before_head = new node;   // reset other.p_before_head to a valid empty state
+            other.p_tail = other.p_before_head;
         }
 
         // 
@@ -274,6 +291,7 @@ public:
             curr = curr->next;
             ++m_size;
         }
+        set_tail(curr);
 
         // 
         return *this;
@@ -298,6 +316,23 @@ public:
         return p_before_head->next->data;
     }
 
+    /**
+     * \brief Access the last element in O(1).
+     *
+     * \note Only available when the tail is cached (`_CacheTail`).
+     */
+    reference back() requires _CacheTail {
+        if (p_before_head->next == nullptr)
+            throw std::out_of_range("forward_list is empty");
+        return p_tail->data;
+    }
+
+    const_reference back() const requires _CacheTail {
+        if (p_before_head->next == nullptr)
+            throw std::out_of_range("forward_list is empty");
+        return p_tail->data;
+    }
+
 
 /* Iterators */
 public:
@@ -336,6 +371,26 @@ public:
     size_type size() const noexcept { return m_size; }
 
 
+/* Memory */
+public:
+    /**
+     * \brief Returns the bytes allocated on the heap, one node per element and the sentinel node.
+     */
+    size_type allocated_bytes() const noexcept { return (m_size + 1) * sizeof(node); }
+
+    /**
+     * \brief Returns the bytes used by the forward_list, its own object and `allocated_bytes()`.
+     *
+     * \note The allocator's own bookkeeping of each block is not included.
+     */
+    size_type memory_footprint() const noexcept { return sizeof(*this) + allocated_bytes(); }
+
+    /**
+     * \brief Returns the bytes of `memory_footprint()` not holding elements.
+     */
+    size_type overhead_bytes() const noexcept { return memory_footprint() - m_size * sizeof(value_type); }
+
+
 /* Modifiers */
 public:
     /**
@@ -353,6 +408,7 @@ public:
         // 
         p_before_head->next = nullptr;
         m_size = 0;
+        set_tail(p_before_head);
     }
 
 
@@ -370,6 +426,8 @@ public:
         node_pointer newNode = new node(val, curr->next);
         curr->next = newNode;
         ++m_size;
+        if (is_tail(curr))
+            set_tail(newNode);
 
         return iterator(newNode);
     }
@@ -386,6 +444,8 @@ public:
         node_pointer newNode = new node(std::move(val), curr->next);
         curr->next = newNode;
         ++m_size;
+        if (is_tail(curr))
+            set_tail(newNode);
 
         return iterator(newNode);
     }
@@ -422,6 +482,32 @@ public:
     }
 
 
+    /**
+     * \brief Links the node owned by `nh` after `pos`, without allocating or copying.
+     *
+     * \return An iterator to the inserted element, or `pos` if `nh` is empty.
+     */
+    iterator insert_after(const_iterator pos, node_type&& nh) {
+        // 
+        if (pos == cend()) {
+            throw std::logic_error("mystl::insert_after: Attempting to insert after the end iterator");
+        }
+        if (nh.empty())
+            return iterator(pos.get_node());
+
+        // 
+        node_pointer curr = pos.get_node();
+        node_pointer newNode = nh.release();
+        newNode->next = curr->next;
+        curr->next = newNode;
+        ++m_size;
+        if (is_tail(curr))
+            set_tail(newNode);
+
+        return iterator(newNode);
+    }
+
+
     /**
      * \brief constructs elements in-place after an element
      */
@@ -438,6 +524,8 @@ public:
         newNode->next = curr->next;
         curr->next = newNode;
         ++m_size;
+        if (is_tail(curr))
+            set_tail(newNode);
 
         return iterator(newNode);
     }
@@ -459,6 +547,8 @@ public:
         // 
         node_pointer node_to_delete = curr->next;
         curr->next = curr->next->next;
+        if (is_tail(node_to_delete))
+            set_tail(curr);
         delete node_to_delete;
 
         --m_size;
@@ -484,22 +574,56 @@ public:
             delete node_to_delete;
             --m_size;
         }
+        if (curr->next == nullptr)
+            set_tail(curr);
 
         return iterator(curr->next);
     }
 
 
+    /**
+     * \brief Unlinks the element after `pos` and returns a handle owning its node.
+     *
+     * \note The handle can be inserted into any forward_list of the same type.
+     * Pointers and references to the element stay valid.
+     */
+    node_type extract_after(const_iterator pos) {
+        // 
+        node_pointer curr = pos.get_node();
+
+        // 
+        if (curr == nullptr)
+            throw std::logic_error("extract_after(): Invalid iterator");
+        else if (curr->next == nullptr)
+            throw std::logic_error("extract_after(): no element after pos");
+
+        // 
+        node_pointer extracted = curr->next;
+        curr->next = extracted->next;
+        extracted->next = nullptr;
+        if (is_tail(extracted))
+            set_tail(curr);
+        --m_size;
+
+        return node_type(extracted);
+    }
+
+
     /**
      * \brief inserts an element to the beginning
      */
     void push_front(const_reference value) {
         p_before_head->next = new node(value, p_before_head->next);
         ++m_size;
+        if (is_tail(p_before_head))
+            set_tail(p_before_head->next);
     }
 
     void push_front(value_type&& value) {
         p_before_head->next = new node(std::move(value), p_before_head->next);
         ++m_size;
+        if (is_tail(p_before_head))
+            set_tail(p_before_head->next);
     }
 
 
@@ -512,6 +636,8 @@ public:
         p_before_head->next = new node(std::forward<Args>(args)...);
         p_before_head->next->next = originalFirstNode;
         ++m_size;
+        if (is_tail(p_before_head))
+            set_tail(p_before_head->next);
     }
 
 
@@ -524,11 +650,42 @@ public:
         }
         node_pointer node_to_delete = p_before_head->next;
         p_before_head->next = node_to_delete->next;
+        if (is_tail(node_to_delete))
+            set_tail(p_before_head);
         delete node_to_delete;
         --m_size;
     }
 
 
+    /**
+     * \brief Appends an element in O(1).
+     *
+     * \note Only available when the tail is cached (`_CacheTail`).
+     */
+    void push_back(const_reference value) requires _CacheTail {
+        emplace_back(value);
+    }
+
+    void push_back(value_type&& value) requires _CacheTail {
+        emplace_back(std::move(value));
+    }
+
+
+    /**
+     * \brief Constructs an element in-place at the end in O(1).
+     *
+     * \note Only available when the tail is cached (`_CacheTail`).
+     */
+    template <typename... Args>
+    reference emplace_back(Args&&... args) requires _CacheTail {
+        node_pointer newNode = new node(std::forward<Args>(args)...);
+        p_tail->next = newNode;
+        p_tail = newNode;
+        ++m_size;
+        return newNode->data;
+    }
+
+
     /**
      * \brief changes the number of elements stored
      */
@@ -556,6 +713,7 @@ public:
     void swap(forward_list& other) {
         std::swap(m_size, other.m_size);
         std::swap(p_before_head, other.p_before_head);
+        std::swap(p_tail, other.p_tail);
     }
 
 
@@ -574,11 +732,10 @@ public:
         if (this == &other)
             return;
 
-        // 
-        node_pointer dummy = new node;
-        node_pointer tail = dummy;
+        // the sentinel heads the merged nodes
         node_pointer curr1 = p_before_head->next;
         node_pointer curr2 = other.p_before_head->next;
+        node_pointer tail = p_before_head;
 
         // 
         while (curr1 != nullptr && curr2 != nullptr) {
@@ -598,14 +755,20 @@ public:
         if (curr2 != nullptr)
             tail->next = curr2;
 
+        // the last node is the tail of whichever list still had nodes left
+        if (curr2 != nullptr) {
+            if constexpr (_CacheTail)
+                p_tail = other.p_tail;
+        }
+        else if (curr1 == nullptr)
+            set_tail(tail);
+
         // 
-        p_before_head->next = dummy->next;
         m_size += other.m_size;
 
         other.p_before_head->next = nullptr;
         other.m_size = 0;
-
-        delete dummy;
+        other.set_tail(other.p_before_head);
     }
 
 
@@ -621,28 +784,112 @@ public:
      */
     void splice_after(const_iterator pos, forward_list& other) {
         // 
-        if (pos == cbefore_begin() || pos == cend())
-            throw std::logic_error("splice_after(): Attempting to splice after end or before_begin.");
+        if (pos == cend())
+            throw std::logic_error("splice_after(): Attempting to splice after end.");
 
         // 
-        node_pointer pos_ptr = pos.get_node();
+        if (other.empty() || this == &other)
+            return;
 
         // 
-        if (pos_ptr->next != nullptr) {
-            // Find the last node in the other list
-            node_pointer other_tail = other.p_before_head->next;
-            while (other_tail->next != nullptr)
-                other_tail = other_tail->next;
-            other_tail->next = pos_ptr->next;
-        }
+        node_pointer pos_ptr = pos.get_node();
+        node_pointer other_tail = other.find_tail();   // O(1) when the tail is cached
 
         // 
+        other_tail->next = pos_ptr->next;
         pos_ptr->next = other.p_before_head->next;
         m_size += other.m_size;
+        if (is_tail(pos_ptr))
+            set_tail(other_tail);
 
         // 
         other.p_before_head->next = nullptr;
         other.m_size = 0;
+        other.set_tail(other.p_before_head);
+    }
+
+
+    /**
+     * \brief Moves the element following `it` from `other` to after `pos`.
+     *
+     * \param pos: element after which the element will be inserted.
+     * \param other: container to move the element from (may be `*this`).
+     * \param it: iterator to the element before the one to move.
+     *
+     * \note O(1). No iterators or references become invalidated.
+     */
+    void splice_after(const_iterator pos, forward_list& other, const_iterator it) {
+        // 
+        if (pos == cend() || it == other.cend())
+            throw std::logic_error("splice_after(): Attempting to splice after end.");
+
+        // 
+        node_pointer pos_ptr = pos.get_node();
+        node_pointer prev = it.get_node();
+        node_pointer moved = prev->next;
+        if (moved == nullptr || pos_ptr == prev || pos_ptr == moved)
+            return;
+
+        // unlink from `other`
+        prev->next = moved->next;
+        if (other.is_tail(moved))
+            other.set_tail(prev);
+        --other.m_size;
+
+        // link after `pos`
+        moved->next = pos_ptr->next;
+        pos_ptr->next = moved;
+        if (is_tail(pos_ptr))
+            set_tail(moved);
+        ++m_size;
+    }
+
+
+    /**
+     * \brief Moves the elements in the open range (first, last) from `other`
+     * to after `pos`.
+     *
+     * \param pos: element after which the elements will be inserted, must not
+     *        be inside (first, last).
+     * \param other: container to move the elements from (may be `*this`).
+     * \param first, last: the elements strictly between them are moved.
+     *
+     * \note Relinks in O(1), but walks the range once to find its last node
+     * and count it. No iterators or references become invalidated.
+     */
+    void splice_after(const_iterator pos, forward_list& other, const_iterator first, const_iterator last) {
+        // 
+        if (pos == cend() || first == other.cend())
+            throw std::logic_error("splice_after(): Attempting to splice after end.");
+
+        // 
+        node_pointer pos_ptr = pos.get_node();
+        node_pointer before = first.get_node();
+        node_pointer stop = last.get_node();
+        if (before->next == stop || pos_ptr == before)
+            return;
+
+        // find the last node of the range
+        node_pointer range_tail = before->next;
+        size_type count = 1;
+        while (range_tail->next != stop) {
+            range_tail = range_tail->next;
+            ++count;
+        }
+
+        // unlink from `other`
+        node_pointer range_head = before->next;
+        before->next = stop;
+        if (other.is_tail(range_tail))
+            other.set_tail(before);
+        other.m_size -= count;
+
+        // link after `pos`
+        range_tail->next = pos_ptr->next;
+        pos_ptr->next = range_head;
+        if (is_tail(pos_ptr))
+            set_tail(range_tail);
+        m_size += count;
     }
 
 
@@ -668,6 +915,7 @@ public:
                 curr = curr->next;
             }
         }
+        set_tail(prev);
     }
 
     /**
@@ -678,6 +926,8 @@ public:
         node_pointer prev = nullptr;
         node_pointer curr = p_before_head->next;
         node_pointer next = nullptr;
+        if (curr != nullptr)
+            set_tail(curr);
 
         // 
         while (curr != nullptr) {
@@ -712,6 +962,7 @@ public:
                 curr = curr->next;
             }
         }
+        set_tail(prev);
     }
 
     /**
@@ -720,11 +971,58 @@ public:
      * \note use merge sort
      */
     void sort() {
+        trace::scope span("forward_list::sort", m_size);
         p_before_head->next = merge_sort(p_before_head->next);
+        if constexpr (_CacheTail)
+            p_tail = walk_to_tail();
     }
 
 
 private:
+    /**
+     * \brief Whether `ptr` is the last node, always false without `_CacheTail`.
+     */
+    bool is_tail(node_pointer ptr) const noexcept {
+        if constexpr (_CacheTail)
+            return ptr == p_tail;
+        else
+            return false;
+    }
+
+
+    /**
+     * \brief Records the last node (`p_before_head` when empty), a no-op
+     * without `_CacheTail`.
+     */
+    void set_tail(node_pointer ptr) noexcept {
+        if constexpr (_CacheTail)
+            p_tail = ptr;
+    }
+
+
+    /**
+     * \brief Returns the last node (`p_before_head` when empty), O(1) with
+     * `_CacheTail`, O(n) otherwise.
+     */
+    node_pointer find_tail() const noexcept {
+        if constexpr (_CacheTail)
+            return p_tail;
+        else
+            return walk_to_tail();
+    }
+
+
+    /**
+     * \brief Returns the last node by walking the list, ignoring the cache.
+     */
+    node_pointer walk_to_tail() const noexcept {
+        node_pointer tail = p_before_head;
+        while (tail->next != nullptr)
+            tail = tail->next;
+        return tail;
+    }
+
+
     /**
      * \brief Merge sort
      */
@@ -771,47 +1069,46 @@ private:
      * \param head2: head of sorted list 2
      */
     node_pointer merge(node_pointer head1, node_pointer head2) {
-        // 
-        node_pointer dummy = new node;
-        node_pointer tail = dummy;
-
-        // 
+        // `link` is the next pointer the smaller head is linked to
+        node_pointer head = nullptr;
+        node_pointer* link = &head;
         while (head1 != nullptr && head2 != nullptr) {
-            if (head1->data < head2->data) {
-                tail->next = head1;
-                head1 = head1->next;
-            } else {
-                tail->next = head2;
-                head2 = head2->next;
-            }
-            tail = tail->next;
+            node_pointer& smaller = head1->data < head2->data ? head1 : head2;
+            *link = smaller;
+            link = &smaller->next;
+            smaller = smaller->next;
         }
 
         // 
-        if (head1 != nullptr)
-            tail->next = head1;
-        if (head2 != nullptr)
-            tail->next = head2;
-
-        // 
-        node_pointer head = dummy->next;
-        delete dummy;
-
+        *link = head1 != nullptr ? head1 : head2;
         return head;
     }
 
 
+private:
+    /**
+     * \brief Stands in for `p_tail` without `_CacheTail`; takes no space and
+     * ignores the assignments of the code shared by both variants.
+     */
+    struct __empty {
+        constexpr __empty() noexcept = default;
+        constexpr __empty(node_pointer) noexcept {}
+        constexpr __empty& operator=(node_pointer) noexcept { return *this; }
+    };
+
+
 private:
     size_type m_size;
     node*     p_before_head;   // sentinel node
+    [[no_unique_address]] std::conditional_t<_CacheTail, node*, __empty> p_tail;   // last node, only with `_CacheTail`
 };
 
 
 /**
  * \brief Specializes the std::swap algorithm for mystl::forward_list.
  */
-template <typename T>
-void swap(forward_list<T>& lhs, forward_list<T>& rhs) {
+template <typename T, bool CacheTail>
+void swap(forward_list<T, CacheTail>& lhs, forward_list<T, CacheTail>& rhs) {
     lhs.swap(rhs);
 }
 
@@ -0,0 +1,541 @@
+/**
+ * \file inplace_vector.hpp
+ *
+ * \reference:
+ * - cppreference.com: std::inplace_vector (C++26)
+ *               url: https://en.cppreference.com/w/cpp/container/inplace_vector
+ */
+
+#pragma once
+
+#ifndef INPLACE_VECTOR_HPP_
+#define INPLACE_VECTOR_HPP_
+
+#include <cstddef>          // size_t
+#include <utility>          // move, forward
+#include <initializer_list> // initializer_list
+#include <stdexcept>        // out_of_range, length_error
+#include <new>              // bad_alloc
+#include <iterator>         // reverse_iterator, input_iterator
+#include <memory>           // construct_at, destroy_at
+#include <type_traits>      // is_trivial_v, is_trivially_copyable_v
+
+#include "instrument.hpp"   // instrument::add
+
+
+namespace mystl {
+
+
+/**
+ * \brief Inline storage of `inplace_vector`, no element is constructed by the storage itself.
+ *
+ * Trivial types are stored in a plain array so that the container stays usable
+ * in constant expressions. Other types are wrapped in an anonymous union, which
+ * leaves the elements unconstructed until the container constructs them.
+ */
+template <typename _T, std::size_t _N, bool = std::is_trivial_v<_T>>
+struct __inplace_vector_storage {
+    constexpr __inplace_vector_storage() {}
+
+    _T m_data[_N == 0 ? 1 : _N];
+};
+
+template <typename _T, std::size_t _N>
+struct __inplace_vector_storage<_T, _N, false> {
+    constexpr __inplace_vector_storage() {}
+    __inplace_vector_storage(const __inplace_vector_storage&) = default;
+    __inplace_vector_storage& operator=(const __inplace_vector_storage&) = default;
+
+    ~__inplace_vector_storage() requires std::is_trivially_destructible_v<_T> = default;
+    ~__inplace_vector_storage() {}
+
+    union {
+        _T m_data[_N == 0 ? 1 : _N];
+    };
+};
+
+
+/**
+ * \class inplace_vector
+ *
+ * \brief A vector with a fixed capacity `_N` whose elements are stored inside
+ * the object itself, it never allocates.
+ *
+ * Provides the modifiers of `mystl::vector`. Growing beyond `_N` throws
+ * `std::bad_alloc`, `try_push_back` and `try_emplace_back` report it by
+ * returning `nullptr` instead. When `_T` is trivially copyable, so is the
+ * `inplace_vector`.
+ */
+template <typename _T, std::size_t _N>
+class inplace_vector : private __inplace_vector_storage<_T, _N> {
+public:
+    using value_type             = _T;
+    using size_type              = std::size_t;
+    using difference_type        = std::ptrdiff_t;
+    using pointer                = _T*;
+    using reference              = _T&;
+    using const_pointer          = const _T*;
+    using const_reference        = const _T&;
+    using iterator               = _T*;
+    using const_iterator         = const _T*;
+    using reverse_iterator       = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+
+/* Constructor and Destructor */
+public:
+    /**
+     * \brief Constructs an empty container, no element is constructed.
+     *
+     * \note The other constructors delegate to this one, so that the
+     * destructor releases the elements already built if they throw.
+     */
+    constexpr inplace_vector() noexcept : m_size(0) {}
+
+    /**
+     * \brief Constructs the container with `count` copies of `value`.
+     *
+     * \throws std::bad_alloc if `count > _N`.
+     */
+    constexpr inplace_vector(size_type count, const_reference value) : inplace_vector() {
+        resize(count, value);
+    }
+
+    /**
+     * \brief Constructs the container with `count` value-initialized elements.
+     *
+     * \throws std::bad_alloc if `count > _N`.
+     */
+    constexpr explicit inplace_vector(size_type count) : inplace_vector() {
+        resize(count);
+    }
+
+    /**
+     * \brief Constructs the container with the contents of the range [first, last).
+     *
+     * \throws std::bad_alloc if the range holds more than `_N` elements.
+     */
+    template <std::input_iterator InputIt>
+    constexpr inplace_vector(InputIt first, InputIt last) : inplace_vector() {
+        for (; first != last; ++first)
+            emplace_back(*first);
+    }
+
+    /**
+     * \brief Construct by initializer list.
+     *
+     * \throws std::bad_alloc if `ilist.size() > _N`.
+     */
+    constexpr inplace_vector(std::initializer_list<value_type> ilist)
+        : inplace_vector(ilist.begin(), ilist.end()) {}
+
+    /**
+     * \brief Copy constructor, trivial when `_T` is trivially copyable.
+     */
+    constexpr inplace_vector(const inplace_vector&) requires std::is_trivially_copyable_v<_T> = default;
+    constexpr inplace_vector(const inplace_vector& other) : inplace_vector() {
+        for (size_type i = 0; i < other.m_size; ++i)
+            unchecked_emplace_back(other.data()[i]);
+    }
+
+    /**
+     * \brief Move constructor, moves the elements one by one (the storage
+     * cannot be stolen). `other` keeps its (moved-from) elements.
+     */
+    constexpr inplace_vector(inplace_vector&&) requires std::is_trivially_copyable_v<_T> = default;
+    constexpr inplace_vector(inplace_vector&& other) noexcept(std::is_nothrow_move_constructible_v<_T>)
+        : inplace_vector()
+    {
+        for (size_type i = 0; i < other.m_size; ++i)
+            unchecked_emplace_back(std::move(other.data()[i]));
+    }
+
+    /**
+     * \brief Destructor, trivial when `_T` is trivially destructible.
+     */
+    constexpr ~inplace_vector() requires std::is_trivially_destructible_v<_T> = default;
+    constexpr ~inplace_vector() { clear(); }
+
+
+/* Operators */
+public:
+    /**
+     * \brief Copy assignment operator
+     */
+    constexpr inplace_vector& operator=(const inplace_vector&) requires std::is_trivially_copyable_v<_T> = default;
+    constexpr inplace_vector& operator=(const inplace_vector& other) {
+        if (this != &other) {
+            clear();
+            for (size_type i = 0; i < other.m_size; ++i)
+                unchecked_emplace_back(other.data()[i]);
+        }
+        return *this;
+    }
+
+    /**
+     * \brief Move assignment operator
+     */
+    constexpr inplace_vector& operator=(inplace_vector&&) requires std::is_trivially_copyable_v<_T> = default;
+    constexpr inplace_vector& operator=(inplace_vector&& other) noexcept(std::is_nothrow_move_constructible_v<_T>) {
+        if (this != &other) {
+            clear();
+            for (size_type i = 0; i < other.m_size; ++i)
+                unchecked_emplace_back(std::move(other.data()[i]));
+        }
+        return *this;
+    }
+
+    /**
+     * \brief Initializer list assignment operator
+     *
+     * \throws std::bad_alloc if `ilist.size() > _N`.
+     */
+    constexpr inplace_vector& operator=(std::initializer_list<value_type> ilist) {
+        if (ilist.size() > _N)
+            throw std::bad_alloc();
+        clear();
+        for (const auto& elem : ilist)
+            unchecked_emplace_back(elem);
+        return *this;
+    }
+
+    /**
+     * \brief Access specified element
+     */
+    constexpr reference operator[](size_type index) { return data()[index]; }
+    constexpr const_reference operator[](size_type index) const { return data()[index]; }
+
+
+/* Element access */
+public:
+    /**
+     * \brief Access specified element with bounds checking
+     *
+     * \throws std::out_of_range if `pos >= size()`.
+     */
+    constexpr reference at(size_type pos) {
+        if (pos >= m_size)
+            throw std::out_of_range("inplace_vector::at");
+        return data()[pos];
+    }
+
+    constexpr const_reference at(size_type pos) const {
+        if (pos >= m_size)
+            throw std::out_of_range("inplace_vector::at");
+        return data()[pos];
+    }
+
+    /**
+     * \brief Access the first element
+     *
+     * \throws std::out_of_range if the container is empty.
+     */
+    constexpr reference front() {
+        if (empty())
+            throw std::out_of_range("front(): inplace_vector is empty");
+        return data()[0];
+    }
+
+    constexpr const_reference front() const {
+        if (empty())
+            throw std::out_of_range("front(): inplace_vector is empty");
+        return data()[0];
+    }
+
+    /**
+     * \brief Access the last element
+     *
+     * \throws std::out_of_range if the container is empty.
+     */
+    constexpr reference back() {
+        if (empty())
+            throw std::out_of_range("back(): inplace_vector is empty");
+        return data()[m_size - 1];
+    }
+
+    constexpr const_reference back() const {
+        if (empty())
+            throw std::out_of_range("back(): inplace_vector is empty");
+        return data()[m_size - 1];
+    }
+
+    /**
+     * \brief Direct access to the underlying contiguous storage
+     */
+    constexpr pointer data() noexcept { return this->m_data; }
+    constexpr const_pointer data() const noexcept { return this->m_data; }
+
+
+/* Iterators */
+public:
+    /**
+     */
+    constexpr iterator                 begin()       noexcept { return data(); }
+    constexpr const_iterator          cbegin() const noexcept { return data(); }
+    constexpr reverse_iterator        rbegin()       noexcept { return reverse_iterator(end()); }
+    constexpr const_reverse_iterator crbegin() const noexcept { return const_reverse_iterator(cend()); }
+
+    /**
+     */
+    constexpr iterator                 end()       noexcept { return data() + m_size; }
+    constexpr const_iterator          cend() const noexcept { return data() + m_size; }
+    constexpr reverse_iterator        rend()       noexcept { return reverse_iterator(begin()); }
+    constexpr const_reverse_iterator crend() const noexcept { return const_reverse_iterator(cbegin()); }
+
+
+/* Capacity */
+public:
+    /**
+     * \brief Return size.
+     */
+    constexpr size_type size() const noexcept { return m_size; }
+
+    /**
+     * \brief Return the fixed capacity `_N`.
+     */
+    static constexpr size_type capacity() noexcept { return _N; }
+    static constexpr size_type max_size() noexcept { return _N; }
+
+    /**
+     * \brief Test whether the container is empty.
+     */
+    constexpr bool empty() const noexcept { return m_size == 0; }
+
+    /**
+     * \brief Test whether the container is full.
+     */
+    constexpr bool full() const noexcept { return m_size == _N; }
+
+    /**
+     * \brief Does nothing, the storage is fixed.
+     *
+     * \throws std::bad_alloc if `newCapacity > _N`.
+     */
+    static constexpr void reserve(size_type newCapacity) {
+        if (newCapacity > _N)
+            throw std::bad_alloc();
+    }
+
+    /**
+     * \brief Does nothing, the storage is fixed.
+     */
+    static constexpr void shrink_to_fit() noexcept {}
+
+
+/* Modifiers */
+public:
+    /**
+     * \brief Destroys all elements.
+     */
+    constexpr void clear() noexcept {
+        if constexpr (!std::is_trivially_destructible_v<value_type>) {
+            for (size_type i = 0; i < m_size; ++i)
+                std::destroy_at(data() + i);
+        }
+        m_size = 0;
+    }
+
+    /**
+     * \brief Erases the element at `pos`.
+     *
+     * \return Iterator following the removed element.
+     */
+    constexpr iterator erase(const_iterator pos) {
+        return erase(pos, pos + 1);
+    }
+
+    /**
+     * \brief Erases the elements in [first, last).
+     *
+     * \return Iterator following the last removed element.
+     */
+    constexpr iterator erase(const_iterator first, const_iterator last) {
+        if (first < cbegin() || last > cend() || first > last)
+            throw std::out_of_range("inplace_vector::erase() - Iterator out of range");
+
+        //
+        iterator nonConstFirst = begin() + (first - cbegin());
+        size_type count = last - first;
+        if (count == 0)
+            return nonConstFirst;
+
+        // shift the tail left, then destroy the now unused slots
+        instrument::add(instrument::event::inplace_vector_shifted, cend() - last);
+        for (iterator it = nonConstFirst; it + count != end(); ++it)
+            *it = std::move(*(it + count));
+        for (size_type i = m_size - count; i < m_size; ++i)
+            std::destroy_at(data() + i);
+        m_size -= count;
+
+        return nonConstFirst;
+    }
+
+    /**
+     * \brief Constructs an element in-place before `pos`.
+     *
+     * \return Iterator pointing to the emplaced element.
+     * \throws std::bad_alloc if the container is full.
+     */
+    template <typename... Args>
+    constexpr iterator emplace(const_iterator pos, Args&&... args) {
+        if (full())
+            throw std::bad_alloc();
+
+        //
+        size_type tarIndex = pos - cbegin();
+        if (tarIndex == m_size) {
+            unchecked_emplace_back(std::forward<Args>(args)...);
+            return begin() + tarIndex;
+        }
+
+        // construct first, `args` may alias an element which is about to be shifted
+        value_type value(std::forward<Args>(args)...);
+        instrument::add(instrument::event::inplace_vector_shifted, m_size - tarIndex);
+        std::construct_at(data() + m_size, std::move(data()[m_size - 1]));
+        for (size_type i = m_size - 1; i > tarIndex; --i)
+            data()[i] = std::move(data()[i - 1]);
+        data()[tarIndex] = std::move(value);
+        ++m_size;
+
+        return begin() + tarIndex;
+    }
+
+    /**
+     * \brief Inserts `value` before `pos`.
+     *
+     * \throws std::bad_alloc if the container is full.
+     */
+    constexpr iterator insert(const_iterator pos, const_reference value) {
+        return emplace(pos, value);
+    }
+
+    constexpr iterator insert(const_iterator pos, value_type&& value) {
+        return emplace(pos, std::move(value));
+    }
+
+    /**
+     * \brief Insert at the end.
+     *
+     * \throws std::bad_alloc if the container is full.
+     */
+    constexpr void push_back(const_reference value) {
+        emplace_back(value);
+    }
+
+    constexpr void push_back(value_type&& value) {
+        emplace_back(std::move(value));
+    }
+
+    /**
+     * \brief Construct and insert at the end.
+     *
+     * \throws std::bad_alloc if the container is full.
+     */
+    template <typename... Args>
+    constexpr reference emplace_back(Args&&... args) {
+        if (full())
+            throw std::bad_alloc();
+        return unchecked_emplace_back(std::forward<Args>(args)...);
+    }
+
+    /**
+     * \brief Insert at the end if there is room left.
+     *
+     * \return Pointer to the inserted element, or `nullptr` if the container
+     *         is full (`value` is left untouched).
+     */
+    constexpr pointer try_push_back(const_reference value) {
+        return try_emplace_back(value);
+    }
+
+    constexpr pointer try_push_back(value_type&& value) {
+        return try_emplace_back(std::move(value));
+    }
+
+    /**
+     * \brief Construct and insert at the end if there is room left.
+     *
+     * \return Pointer to the inserted element, or `nullptr` if the container is full.
+     */
+    template <typename... Args>
+    constexpr pointer try_emplace_back(Args&&... args) {
+        if (full())
+            return nullptr;
+        return &unchecked_emplace_back(std::forward<Args>(args)...);
+    }
+
+    /**
+     * \brief Construct and insert at the end without checking the capacity.
+     *
+     * \note Undefined behavior if the container is full.
+     */
+    template <typename... Args>
+    constexpr reference unchecked_emplace_back(Args&&... args) {
+        std::construct_at(data() + m_size, std::forward<Args>(args)...);
+        return data()[m_size++];
+    }
+
+    /**
+     * \brief Delete the last element.
+     *
+     * \throws std::length_error if the container is empty.
+     */
+    constexpr void pop_back() {
+        if (m_size == 0)
+            throw std::length_error("inplace_vector::pop_back(): the inplace_vector is empty");
+        std::destroy_at(data() + --m_size);
+    }
+
+    /**
+     * \brief Changes the number of elements stored.
+     *
+     * \param count: new size of the container
+     * \param value: the value to initialize the new elements with
+     * \throws std::bad_alloc if `count > _N`.
+     */
+    constexpr void resize(size_type count) {
+        if (count > _N)
+            throw std::bad_alloc();
+        if (count < m_size)
+            erase(cbegin() + count, cend());
+        while (m_size < count)
+            unchecked_emplace_back();
+    }
+
+    constexpr void resize(size_type count, const_reference value) {
+        if (count > _N)
+            throw std::bad_alloc();
+        if (count < m_size)
+            erase(cbegin() + count, cend());
+        while (m_size < count)
+            unchecked_emplace_back(value);
+    }
+
+    /**
+     * \brief Swaps the contents, elementwise since the storage cannot be exchanged.
+     */
+    constexpr void swap(inplace_vector& other) noexcept(std::is_nothrow_move_constructible_v<_T>) {
+        inplace_vector temp(std::move(other));
+        other = std::move(*this);
+        *this = std::move(temp);
+    }
+
+
+private:
+    size_type m_size;
+};
+
+
+/**
+ * \brief Specializes the std::swap algorithm for mystl::inplace_vector.
+ */
+template <typename _T, std::size_t _N>
+constexpr void swap(inplace_vector<_T, _N>& lhs, inplace_vector<_T, _N>& rhs) noexcept(noexcept(lhs.swap(rhs))) {
+    lhs.swap(rhs);
+}
+
+
+} // namespace mystl::
+
+
+#endif // INPLACE_VECTOR_HPP_
@@ -0,0 +1,231 @@
+/**
+ * \file instrument.hpp
+ *
+ * \brief Opt-in operation counters of the containers and heap algorithms.
+ *
+ * Compiled in only when `MYSTL_INSTRUMENT` is defined to a non-zero value
+ * before any mystl header is included, e.g. with `-DMYSTL_INSTRUMENT=1`; it
+ * must then be the same in every translation unit of a program. Otherwise
+ * every hook is an empty constexpr function and the node types carry no
+ * extra members, so the instrumentation costs nothing; the counter storage
+ * and the exporters are then left out, along with the headers they need.
+ *
+ * Counts are kept per thread, so recording is a plain increment without any
+ * synchronization; `snapshot()` and `reset()` act on the calling thread's
+ * counters.
+ */
+
+#pragma once
+
+#ifndef INSTRUMENT_HPP_
+#define INSTRUMENT_HPP_
+
+#ifndef MYSTL_INSTRUMENT
+#define MYSTL_INSTRUMENT 0
+#endif
+
+#include <cstddef>      // size_t
+#include <cstdint>      // uint64_t
+
+#if MYSTL_INSTRUMENT
+#include <new>          // operator new, operator delete
+#include <string>       // string, to_string
+#include <type_traits>  // is_constant_evaluated
+#endif
+
+
+namespace mystl::instrument {
+
+
+/**
+ * \brief Whether the counters are compiled in.
+ */
+inline constexpr bool enabled = MYSTL_INSTRUMENT != 0;
+
+
+/**
+ * \brief The counted operations.
+ */
+enum class event : std::size_t {
+    vector_reallocs,            // storage reallocations of `vector`
+    vector_shifted,             // elements moved by `vector::emplace` / `insert` / `erase`
+    inplace_vector_shifted,     // same for `inplace_vector`
+    list_node_allocs,           // nodes allocated by `list`, sentinels included
+    list_node_frees,
+    forward_list_node_allocs,   // nodes allocated by `forward_list`, sentinels included
+    forward_list_node_frees,
+    heap_sift_levels,           // levels walked up or down by the heap algorithms
+    count
+};
+
+
+#if MYSTL_INSTRUMENT
+
+
+/**
+ * \brief A set of counter values, indexed by `event`.
+ */
+struct counters {
+    std::uint64_t values[static_cast<std::size_t>(event::count)] = {};
+
+    /**
+     */
+    std::uint64_t operator[](event e) const noexcept { return values[static_cast<std::size_t>(e)]; }
+};
+
+
+namespace __detail {
+
+
+/**
+ * \brief Container and counter name of each event, for the exporters.
+ */
+struct __event_name {
+    const char* container;
+    const char* counter;
+};
+
+inline constexpr __event_name __event_names[static_cast<std::size_t>(event::count)] = {
+    {"vector",         "reallocs"},
+    {"vector",         "shifted"},
+    {"inplace_vector", "shifted"},
+    {"list",           "node_allocs"},
+    {"list",           "node_frees"},
+    {"forward_list",   "node_allocs"},
+    {"forward_list",   "node_frees"},
+    {"heap",           "sift_levels"},
+};
+
+
+/**
+ * \brief The calling thread's counters.
+ */
+inline counters& __thread_counters() noexcept {
+    static thread_local counters local;
+    return local;
+}
+
+
+} // namespace mystl::instrument::__detail
+
+
+#endif // MYSTL_INSTRUMENT
+
+
+namespace __detail {
+
+
+/**
+ * \brief Base of a node type whose allocations are counted as `_Alloc` and
+ * deallocations as `_Free`; empty when the instrumentation is disabled.
+ */
+template <event _Alloc, event _Free, bool = enabled>
+struct __counted_node {};
+
+#if MYSTL_INSTRUMENT
+template <event _Alloc, event _Free>
+struct __counted_node<_Alloc, _Free, true> {
+    static void* operator new(std::size_t size) {
+        __thread_counters().values[static_cast<std::size_t>(_Alloc)] += 1;
+        return ::operator new(size);
+    }
+
+    static void operator delete(void* p) noexcept {
+        __thread_counters().values[static_cast<std::size_t>(_Free)] += 1;
+        ::operator delete(p);
+    }
+};
+#endif // MYSTL_INSTRUMENT
+
+
+} // namespace mystl::instrument::__detail
+
+
+/**
+ * \brief Adds `n` to the counter of `e`; does nothing when disabled or during
+ * constant evaluation.
+ */
+constexpr void add([[maybe_unused]] event e, [[maybe_unused]] std::uint64_t n = 1) noexcept {
+#if MYSTL_INSTRUMENT
+    if (!std::is_constant_evaluated())
+        __detail::__thread_counters().values[static_cast<std::size_t>(e)] += n;
+#endif
+}
+
+
+#if MYSTL_INSTRUMENT
+
+
+/**
+ * \brief Returns the calling thread's counters.
+ */
+inline counters snapshot() noexcept {
+    return __detail::__thread_counters();
+}
+
+
+/**
+ * \brief Zeroes the calling thread's counters.
+ */
+inline void reset() noexcept {
+    __detail::__thread_counters() = counters();
+}
+
+
+/**
+ * \brief Formats `c` as one `container.counter value` line per counter.
+ */
+inline std::string to_text(const counters& c) {
+    std::string out;
+    for (std::size_t i = 0; i < static_cast<std::size_t>(event::count); ++i) {
+        out += __detail::__event_names[i].container;
+        out += '.';
+        out += __detail::__event_names[i].counter;
+        out += ' ';
+        out += std::to_string(c.values[i]);
+        out += '\n';
+    }
+    return out;
+}
+
+
+/**
+ * \brief Formats `c` as a JSON object with one member object per container,
+ * e.g. `{"vector":{"reallocs":3,"shifted":0},...}`.
+ */
+inline std::string to_json(const counters& c) {
+    std::string out = "{";
+    const char* open = nullptr;
+    for (std::size_t i = 0; i < static_cast<std::size_t>(event::count); ++i) {
+        const __detail::__event_name& name = __detail::__event_names[i];
+
+        // events of one container are adjacent
+        if (open == nullptr || std::string(open) != name.container) {
+            if (open != nullptr)
+                out += "},";
+            out += '"';
+            out += name.container;
+            out += "\":{";
+            open = name.container;
+        } else {
+            out += ',';
+        }
+
+        //
+        out += '"';
+        out += name.counter;
+        out += "\":";
+        out += std::to_string(c.values[i]);
+    }
+    out += "}}";
+    return out;
+}
+
+
+#endif // MYSTL_INSTRUMENT
+
+
+} // namespace mystl::instrument::
+
+
+#endif // INSTRUMENT_HPP_
@@ -7,11 +7,17 @@
 #ifndef LIST_HPP_
 #define LIST_HPP_
 
-#include <iterator>         // bidirectional_iterator_tag
+#include <iterator>         // bidirectional_iterator_tag, distance
 #include <utility>          // move, forward
 #include <cstddef>          // size_t
 #include <initializer_list> // initializer_list
+#include <cassert>          // assert
 #include <stdexcept>        // out_of_range, logic_error
+#include <type_traits>      // is_same_v, is_convertible_v
+
+#include "node_handle.hpp"   // node_handle
+#include "instrument.hpp"    // instrument::__detail::__counted_node
+#include "trace.hpp"         // trace::scope
 
 
 namespace mystl {
@@ -39,11 +45,12 @@ public:
     using const_reverse_iterator = std::reverse_iterator<const_iterator>;
 
     using node_pointer    = node*;
+    using node_type       = node_handle<node, value_type>;
 
 private:
     /**
      */
-    struct node {
+    struct node : instrument::__detail::__counted_node<instrument::event::list_node_allocs, instrument::event::list_node_frees> {
         /**
          */
         node() = default;
@@ -77,6 +84,9 @@ private:
     class list_iterator_base {
         friend class list<_T>;
 
+        template <typename, typename, typename>
+        friend class list_iterator_base;
+
     public:
         using value_type        = _Iter_val;
         using pointer           = _Iter_ptr;
@@ -87,6 +97,13 @@ private:
     public:
         list_iterator_base(node_pointer ptr = nullptr) : p_ptr(ptr) {}
 
+        /**
+         * \brief Converts an `iterator` into a `const_iterator`.
+         */
+        template <typename _Ptr, typename _Ref>
+            requires (!std::is_same_v<_Ptr, _Iter_ptr> && std::is_convertible_v<_Ptr, _Iter_ptr>)
+        list_iterator_base(const list_iterator_base<_Iter_val, _Ptr, _Ref>& other) : p_ptr(other.get_node()) {}
+
     public:
         list_iterator_base& operator++() {
             assert(p_ptr != nullptr && "Attempting to increment an empty iterator");
@@ -165,9 +182,8 @@ public:
      * \param value: The value of the elements to insert. Defaults to a default-constructed value.
      */
     explicit list(size_type count, const_reference value = value_type()) 
-        : m_size(0), p_end(new node)
+        : list()
     {
-        init_sentinel_node();
         insert(cbegin(), count, value);
     }
 
@@ -181,9 +197,8 @@ public:
      */
     template <std::input_iterator InputIt>
     list(InputIt first, InputIt last) 
-        : m_size(0), p_end(new node)
+        : list()
     {
-        init_sentinel_node();
         insert(cbegin(), first, last);
     }
 
@@ -193,9 +208,8 @@ public:
      * \param other: Another list to copy the elements from.
      */
     list(const list& other) 
-        : m_size(0), p_end(new node)
+        : list()
     {
-        init_sentinel_node();
         insert(cbegin(), other.cbegin(), other.cend());
     }
 
@@ -221,9 +235,8 @@ public:
      * \param ilist: An initializer list containing elements to be added to the list.
      */
     list(std::initializer_list<value_type> ilist)
-        : m_size(0), p_end(new node) 
+        : list()
     {
-        init_sentinel_node();
         insert(cbegin(), ilist);
     }
 
@@ -341,6 +354,26 @@ public:
     bool empty() const noexcept { return p_end->next == p_end; }
 
 
+/* Memory */
+public:
+    /**
+     * \brief Returns the bytes allocated on the heap, one node per element and the sentinel node.
+     */
+    size_type allocated_bytes() const noexcept { return (m_size + 1) * sizeof(node); }
+
+    /**
+     * \brief Returns the bytes used by the list, its own object and `allocated_bytes()`.
+     *
+     * \note The allocator's own bookkeeping of each block is not included.
+     */
+    size_type memory_footprint() const noexcept { return sizeof(*this) + allocated_bytes(); }
+
+    /**
+     * \brief Returns the bytes of `memory_footprint()` not holding elements.
+     */
+    size_type overhead_bytes() const noexcept { return memory_footprint() - m_size * sizeof(value_type); }
+
+
 /* Iterators */
 public:
     /**
@@ -437,6 +470,8 @@ public:
      * \param count: The number of copies of `value` to insert.
      * \param value: The value to be inserted.
      * \return  An iterator pointing to the first element inserted, or `pos` if `count` is zero.     
+     *
+     * \note Strong exception guarantee: the new nodes are linked in only once all of them were built.
      */
     iterator insert(const_iterator pos, size_type count, const_reference value) {
         // 
@@ -444,14 +479,10 @@ public:
             return iterator(pos.get_node());   // convert to non-const iterator
 
         // 
-        iterator it, firstIt;
-        for (size_type i = 0; i < count; ++i) {
-            it = insert(pos, value);
-            if (i == 0)
-                firstIt = it;
-        }
+        node_chain chain = make_chain(count, value);
+        link_chain(pos.get_node(), chain);
 
-        return firstIt;
+        return iterator(chain.head);
     }
 
     /**
@@ -463,19 +494,20 @@ public:
      * \param first: An iterator to the beginning of the range to be inserted.
      * \param last: An iterator to the end of the range to be inserted (not inclusive).
      * \return An iterator pointing to the first element inserted, or `pos` if the range is empty.
+     *
+     * \note Strong exception guarantee: the new nodes are linked in only once all of them were built.
      */
     template <std::input_iterator InputIt>
     iterator insert(const_iterator pos, InputIt first, InputIt last) {
         // 
-        iterator first_inserted = insert(pos, *first);
-        ++first;
+        node_chain chain = make_chain(first, last);
+        if (chain.size == 0)
+            return iterator(pos.get_node());
 
         // 
-        for (auto it = first; it != last; ++it) {
-            insert(pos, *it);
-        }
+        link_chain(pos.get_node(), chain);
 
-        return iterator(first_inserted.get_node());
+        return iterator(chain.head);
     }
 
     /**
@@ -490,6 +522,33 @@ public:
     }
 
 
+    /**
+     * \brief Links the node owned by `nh` before `pos`, without allocating or
+     * copying.
+     *
+     * \param pos: A const iterator specifying the position before which the node will be inserted.
+     * \param nh: A handle obtained from `extract` on a list of the same type.
+     * \return An iterator pointing to the inserted element, or `pos` if `nh` is empty.
+     */
+    iterator insert(const_iterator pos, node_type&& nh) noexcept {
+        // 
+        if (nh.empty())
+            return iterator(pos.get_node());
+
+        // 
+        node_pointer curr = pos.get_node();
+        node_pointer newNode = nh.release();
+        newNode->prev = curr->prev;
+        newNode->next = curr;
+        curr->prev->next = newNode;
+        curr->prev = newNode;
+        ++m_size;
+
+        // 
+        return iterator(newNode);
+    }
+
+
     /**
      * \brief Constructs an element in-place at the specified position in the list.
      *
@@ -562,6 +621,33 @@ public:
     }
 
 
+    /**
+     * \brief Unlinks the element at `pos` and returns a handle owning its node.
+     *
+     * \param pos: An iterator to the element to be extracted.
+     * \return A node handle that can be inserted into any list of the same type.
+     * \throws std::out_of_range: Thrown if an attempt to extract the end iterator.
+     *
+     * \note Only iterators to the extracted element are invalidated; pointers
+     * and references to it stay valid and refer to the element in the handle.
+     */
+    node_type extract(const_iterator pos) {
+        // 
+        if (pos == cend())
+            throw std::out_of_range("extract(): Attempt to extract end iterator");
+
+        // 
+        node_pointer curr = pos.get_node();
+        curr->prev->next = curr->next;
+        curr->next->prev = curr->prev;
+        curr->prev = curr->next = nullptr;
+        --m_size;
+
+        // 
+        return node_type(curr);
+    }
+
+
     /**
      * \brief adds an element to the end
      *
@@ -623,7 +709,7 @@ public:
     void pop_back() {
         // 
         if (p_end->next == p_end)
-            throw std::out_of_range("pop_front(): List is empty");
+            throw std::out_of_range("pop_back(): List is empty");
 
         // 
         node_pointer node_2_delete = p_end->prev;
@@ -631,6 +717,7 @@ public:
         p_end->prev->next = p_end;
 
         // 
+        delete node_2_delete;
         --m_size;
     }
 
@@ -718,10 +805,7 @@ public:
      */
     void resize(size_type count, const_reference value = value_type()) {
         if (count > m_size) {
-            size_type num2add = count - m_size;
-            for (size_type i = 0; i < num2add; ++i) {
-                push_back(value);
-            }
+            insert(cend(), count - m_size, value);
         }
         else if (count < m_size) {
             const_iterator it = cbegin();
@@ -837,6 +921,55 @@ public:
     }
 
 
+    /**
+     * \brief Moves the element pointed to by `it` from `other`
+     *
+     * \param pos: element after which the element will be inserted.
+     * \param other: container to move the element from (may be `*this`).
+     * \param it: the element to move.
+     *
+     * \note O(1). No iterators or references become invalidated.
+     */
+    void splice(const_iterator pos, list& other, const_iterator it) {
+        // 
+        node_pointer curr = it.get_node();
+        if (curr == other.p_end || curr == pos.get_node() || curr->prev == pos.get_node())
+            return;
+
+        // 
+        relink_after(pos.get_node(), curr, curr);
+        --other.m_size;
+        ++m_size;
+    }
+
+
+    /**
+     * \brief Moves the elements in the range [first, last) from `other`
+     *
+     * \param pos: element after which the elements will be inserted, must not
+     *        be inside [first, last).
+     * \param other: container to move the elements from (may be `*this`).
+     * \param first, last: the range of elements to move.
+     *
+     * \note Relinks in O(1). Counting the range is O(n) when `other` is a
+     * different list, and skipped when splicing within `*this`. No iterators
+     * or references become invalidated.
+     */
+    void splice(const_iterator pos, list& other, const_iterator first, const_iterator last) {
+        // 
+        if (first == last)
+            return;
+
+        // 
+        if (&other != this) {
+            size_type count = static_cast<size_type>(std::distance(first, last));
+            other.m_size -= count;
+            m_size += count;
+        }
+        relink_after(pos.get_node(), first.get_node(), last.get_node()->prev);
+    }
+
+
     /**
      * \brief Removes elements satisfying specific criteria
      */
@@ -908,6 +1041,8 @@ public:
      * \brief Sorts the elements
      */
     void sort() {
+        trace::scope span("list::sort", m_size);
+
         // 
         if (empty() || p_end->next->next == p_end)
             return;
@@ -934,6 +1069,118 @@ public:
 
 
 private:
+    /**
+     * \brief A run of linked nodes that does not belong to any list yet.
+     */
+    struct node_chain {
+        node_pointer head = nullptr;
+        node_pointer tail = nullptr;
+        size_type    size = 0;
+    };
+
+
+    /**
+     * \brief Appends a new node to `chain`.
+     */
+    template <typename... Args>
+    static void chain_append(node_chain& chain, Args&&... args) {
+        node_pointer newNode = new node(std::forward<Args>(args)...);
+        newNode->prev = chain.tail;
+        if (chain.tail == nullptr)
+            chain.head = newNode;
+        else
+            chain.tail->next = newNode;
+        chain.tail = newNode;
+        ++chain.size;
+    }
+
+
+    /**
+     * \brief Deletes every node of a chain.
+     */
+    static void chain_destroy(node_chain& chain) noexcept {
+        node_pointer curr = chain.head;
+        while (curr != nullptr) {
+            node_pointer next = curr->next;
+            delete curr;
+            curr = next;
+        }
+        chain = node_chain();
+    }
+
+
+    /**
+     * \brief Builds a detached chain holding copies of [first, last).
+     *
+     * If constructing an element throws, the nodes built so far are deleted
+     * and the exception is rethrown, no list is modified.
+     */
+    template <std::input_iterator InputIt>
+    static node_chain make_chain(InputIt first, InputIt last) {
+        node_chain chain;
+        try {
+            for (; first != last; ++first)
+                chain_append(chain, *first);
+        }
+        catch (...) {
+            chain_destroy(chain);
+            throw;
+        }
+        return chain;
+    }
+
+
+    /**
+     * \brief Builds a detached chain holding `count` copies of `value`.
+     */
+    static node_chain make_chain(size_type count, const_reference value) {
+        node_chain chain;
+        try {
+            for (size_type i = 0; i < count; ++i)
+                chain_append(chain, value);
+        }
+        catch (...) {
+            chain_destroy(chain);
+            throw;
+        }
+        return chain;
+    }
+
+
+    /**
+     * \brief Links a non-empty chain before `pos` with a single splice.
+     */
+    void link_chain(node_pointer pos, const node_chain& chain) noexcept {
+        node_pointer prev = pos->prev;
+        prev->next = chain.head;
+        chain.head->prev = prev;
+        chain.tail->next = pos;
+        pos->prev = chain.tail;
+        m_size += chain.size;
+    }
+
+
+    /**
+     * \brief Unlinks the nodes [first, last] from their list and links them
+     * after `pos`, without touching any size.
+     */
+    static void relink_after(node_pointer pos, node_pointer first, node_pointer last) noexcept {
+        if (first->prev == pos)
+            return;
+
+        // 
+        first->prev->next = last->next;
+        last->next->prev = first->prev;
+
+        // 
+        node_pointer next = pos->next;
+        pos->next = first;
+        first->prev = pos;
+        last->next = next;
+        next->prev = last;
+    }
+
+
     /**
      * \brief Initializes the sentinel node used in the list.
      */
@@ -978,39 +1225,26 @@ private:
         if (head2 == nullptr)
             return head1;
 
-        // 
-        node_pointer dummy = new node(0);
-        node_pointer tail = dummy;
-
-        // 
+        // take the smaller head each time, both lists are non-empty so the
+        // first one taken becomes the head
+        node_pointer sorted_head = nullptr;
+        node_pointer tail = nullptr;
         while (head1 != nullptr && head2 != nullptr) {
-            if (head1->data < head2->data) {
-                tail->next = head1;
-                head1->prev = tail;
-                head1 = head1->next;
-            } else {
-                tail->next = head2;
-                head2->prev = tail;
-                head2 = head2->next;
-            }
-            tail = tail->next;
-        }
-
-        // 
-        if (head1 != nullptr) {
-            tail->next = head1;
-            head1->prev = tail;
-        }
-        if (head2 != nullptr) {
-            tail->next = head2;
-            head2->prev = tail;
+            node_pointer& smaller = head1->data < head2->data ? head1 : head2;
+            smaller->prev = tail;
+            if (tail == nullptr)
+                sorted_head = smaller;
+            else
+                tail->next = smaller;
+            tail = smaller;
+            smaller = smaller->next;
         }
 
         // 
-        node_pointer sorted_head = dummy->next;
-        if (sorted_head)
-            sorted_head->prev = nullptr;
-        delete dummy;
+        node_pointer rest = head1 != nullptr ? head1 : head2;
+        tail->next = rest;
+        if (rest != nullptr)
+            rest->prev = tail;
         return sorted_head;
     }
 
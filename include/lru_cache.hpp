@@ -0,0 +1,425 @@
+/**
+ * \file lru_cache.hpp
+ */
+
+#pragma once
+
+#ifndef LRU_CACHE_HPP_
+#define LRU_CACHE_HPP_
+
+#include <cstddef>          // size_t
+#include <functional>       // hash, equal_to
+#include <iterator>         // prev
+#include <utility>          // move
+
+#include "list.hpp"         // list, node handles
+#include "vector.hpp"       // vector
+
+
+namespace mystl {
+
+
+namespace __detail {
+
+
+/**
+ * \brief Weigher that counts every entry as 1, making the capacity an entry count.
+ */
+struct unit_weight {
+    template <typename _K, typename _V>
+    constexpr std::size_t operator()(const _K&, const _V&) const noexcept { return 1; }
+};
+
+
+/**
+ * \class __cache_index
+ *
+ * \brief Open-addressing hash index from a key hash to a reference into the
+ * cache's own storage.
+ *
+ * Buckets hold the full hash next to the reference, so that a probe only
+ * touches the entry when the hashes match. Linear probing with backward-shift
+ * deletion keeps the table free of tombstones; it doubles once half full.
+ *
+ * \tparam _Ref: What a bucket points at, an iterator or a slot index.
+ */
+template <typename _Ref>
+class __cache_index {
+public:
+    using size_type = std::size_t;
+
+    static constexpr size_type npos = size_type(-1);
+
+
+/* Constructor */
+public:
+    /**
+     */
+    __cache_index() : m_buckets(), m_size(0), m_mask(0) {}
+
+
+/* Capacity */
+public:
+    /**
+     */
+    size_type size() const noexcept { return m_size; }
+
+    /**
+     * \brief Sizes the table for `count` references without rehashing.
+     */
+    void reserve(size_type count) {
+        size_type buckets = 8;
+        while (buckets < count * 2)
+            buckets *= 2;
+        if (buckets > m_buckets.size())
+            rehash(buckets);
+    }
+
+
+/* Lookup */
+public:
+    /**
+     * \brief Returns the bucket whose hash is `hash` and whose reference
+     * satisfies `match`, or `npos`.
+     */
+    template <typename _Match>
+    size_type find(std::size_t hash, _Match match) const {
+        if (m_size == 0)
+            return npos;
+        for (size_type i = hash & m_mask; m_buckets[i].used; i = (i + 1) & m_mask)
+            if (m_buckets[i].hash == hash && match(m_buckets[i].ref))
+                return i;
+        return npos;
+    }
+
+    /**
+     */
+    _Ref&       ref(size_type bucket)       noexcept { return m_buckets[bucket].ref; }
+    const _Ref& ref(size_type bucket) const noexcept { return m_buckets[bucket].ref; }
+
+
+/* Modifiers */
+public:
+    /**
+     * \brief Adds a reference, which must not be present yet.
+     */
+    void insert(std::size_t hash, const _Ref& ref) {
+        if ((m_size + 1) * 2 > m_buckets.size())
+            rehash(m_buckets.size() == 0 ? 8 : m_buckets.size() * 2);
+        place(hash, ref);
+        ++m_size;
+    }
+
+    /**
+     * \brief Removes the reference in `bucket`, shifting later members of its
+     * probe run back so that lookups never need tombstones.
+     */
+    void erase(size_type bucket) noexcept {
+        size_type hole = bucket;
+        for (size_type j = (hole + 1) & m_mask; m_buckets[j].used; j = (j + 1) & m_mask) {
+            size_type ideal = m_buckets[j].hash & m_mask;
+            if (((j - ideal) & m_mask) >= ((j - hole) & m_mask)) {
+                m_buckets[hole] = m_buckets[j];
+                hole = j;
+            }
+        }
+        m_buckets[hole].used = false;
+        --m_size;
+    }
+
+    /**
+     */
+    void clear() noexcept {
+        for (size_type i = 0; i < m_buckets.size(); ++i)
+            m_buckets[i].used = false;
+        m_size = 0;
+    }
+
+
+private:
+    struct bucket {
+        std::size_t hash = 0;
+        _Ref        ref  = _Ref();
+        bool        used = false;
+    };
+
+    /**
+     */
+    void place(std::size_t hash, const _Ref& ref) noexcept {
+        size_type i = hash & m_mask;
+        while (m_buckets[i].used)
+            i = (i + 1) & m_mask;
+        m_buckets[i].hash = hash;
+        m_buckets[i].ref = ref;
+        m_buckets[i].used = true;
+    }
+
+    /**
+     */
+    void rehash(size_type count) {
+        mystl::vector<bucket> old(count);
+        old.swap(m_buckets);
+        m_mask = count - 1;
+        for (size_type i = 0; i < old.size(); ++i)
+            if (old[i].used)
+                place(old[i].hash, old[i].ref);
+    }
+
+
+private:
+    mystl::vector<bucket> m_buckets;
+    size_type             m_size;
+    size_type             m_mask;   // bucket count - 1, a power of two
+};
+
+
+} // namespace mystl::__detail
+
+
+/**
+ * \class lru_cache
+ *
+ * \brief A bounded key-value cache that evicts the least recently used
+ * entries, with O(1) `get` and `put`.
+ *
+ * Entries sit in a `mystl::list` in recency order, most recent first, and an
+ * open-addressing index maps keys to list positions. A hit relinks its node
+ * to the front with `splice`. An insertion into a full cache extracts the
+ * evicted node and reuses it for the new entry, so once the cache is full
+ * neither hits nor misses allocate.
+ *
+ * \tparam _Key: Type of the keys.
+ * \tparam _T: Type of the cached values.
+ * \tparam _Hash: Hash function for the keys.
+ * \tparam _KeyEqual: Equality for the keys.
+ * \tparam _Weigher: `size_t(const _Key&, const _T&)` giving the weight an
+ *         entry counts against the capacity; 1 by default, which makes the
+ *         capacity an entry count.
+ *
+ * \note Like `mystl::list`, requires default-constructible keys and values.
+ */
+template <typename _Key, typename _T, typename _Hash = std::hash<_Key>,
+          typename _KeyEqual = std::equal_to<_Key>, typename _Weigher = __detail::unit_weight>
+class lru_cache {
+private:
+    struct entry {
+        _Key        key    = _Key();
+        _T          value  = _T();
+        std::size_t hash   = 0;
+        std::size_t weight = 0;
+    };
+
+    using list_type = mystl::list<entry>;
+    using position  = typename list_type::iterator;
+
+public:
+    using key_type     = _Key;
+    using mapped_type  = _T;
+    using size_type    = std::size_t;
+    using hasher       = _Hash;
+    using key_equal    = _KeyEqual;
+    using weigher_type = _Weigher;
+
+
+/* Constructor */
+public:
+    /**
+     * \brief Constructs an empty cache.
+     *
+     * \param capacity: Maximum total weight, the number of entries with the
+     *        default weigher.
+     */
+    explicit lru_cache(size_type capacity, const hasher& hash = hasher(), const key_equal& equal = key_equal(),
+                       const weigher_type& weigher = weigher_type())
+        : m_entries(), m_index(), m_capacity(capacity), m_weight(0),
+          m_hash(hash), m_equal(equal), m_weigher(weigher)
+    {
+    }
+
+    lru_cache(const lru_cache&) = delete;
+    lru_cache& operator=(const lru_cache&) = delete;
+
+
+/* Lookup */
+public:
+    /**
+     * \brief Returns the value cached under `key` and marks it most recently
+     * used, or null on a miss.
+     *
+     * \note The pointer stays valid until the entry is evicted or erased.
+     */
+    mapped_type* get(const key_type& key) {
+        size_type bucket = find_bucket(key, m_hash(key));
+        if (bucket == index_type::npos)
+            return nullptr;
+
+        //
+        position pos = m_index.ref(bucket);
+        touch(pos);
+        return &pos->value;
+    }
+
+    /**
+     * \brief Returns the value cached under `key` without changing its
+     * recency, or null on a miss.
+     */
+    const mapped_type* peek(const key_type& key) const {
+        size_type bucket = find_bucket(key, m_hash(key));
+        if (bucket == index_type::npos)
+            return nullptr;
+        return &m_index.ref(bucket)->value;
+    }
+
+    /**
+     * \brief Checks whether `key` is cached, without changing its recency.
+     */
+    bool contains(const key_type& key) const { return peek(key) != nullptr; }
+
+
+/* Modifiers */
+public:
+    /**
+     * \brief Caches `value` under `key` as the most recently used entry,
+     * replacing any previous value and evicting least recently used entries
+     * until the total weight fits the capacity.
+     *
+     * \return Whether the entry is cached; false if its weight alone exceeds
+     * the capacity, in which case any previous entry for `key` is dropped too.
+     */
+    bool put(const key_type& key, mapped_type value) {
+        std::size_t hash = m_hash(key);
+        size_type weight = m_weigher(key, value);
+        size_type bucket = find_bucket(key, hash);
+
+        // update in place
+        if (bucket != index_type::npos) {
+            position pos = m_index.ref(bucket);
+            if (weight > m_capacity) {
+                erase_at(bucket);
+                return false;
+            }
+            m_weight = m_weight - pos->weight + weight;
+            pos->value = std::move(value);
+            pos->weight = weight;
+            touch(pos);
+            while (m_weight > m_capacity)
+                evict();
+            return true;
+        }
+        if (weight > m_capacity)
+            return false;
+
+        // evict, keeping the last evicted node to hold the new entry
+        typename list_type::node_type spare;
+        while (m_weight + weight > m_capacity)
+            spare = evict();
+
+        //
+        if (spare.empty()) {
+            m_entries.push_front(entry{key, std::move(value), hash, weight});
+        } else {
+            spare.value() = entry{key, std::move(value), hash, weight};
+            m_entries.insert(m_entries.cbegin(), std::move(spare));
+        }
+        m_index.insert(hash, m_entries.begin());
+        m_weight += weight;
+        return true;
+    }
+
+    /**
+     * \brief Removes the entry for `key`, if any.
+     *
+     * \return Whether an entry was removed.
+     */
+    bool erase(const key_type& key) {
+        size_type bucket = find_bucket(key, m_hash(key));
+        if (bucket == index_type::npos)
+            return false;
+        erase_at(bucket);
+        return true;
+    }
+
+    /**
+     * \brief Removes all entries.
+     */
+    void clear() {
+        m_entries.clear();
+        m_index.clear();
+        m_weight = 0;
+    }
+
+
+/* Capacity */
+public:
+    /**
+     * \brief Returns the number of entries.
+     */
+    size_type size() const noexcept { return m_entries.size(); }
+
+    /**
+     */
+    [[nodiscard]] bool empty() const noexcept { return m_entries.size() == 0; }
+
+    /**
+     * \brief Returns the total weight of the entries.
+     */
+    size_type weight() const noexcept { return m_weight; }
+
+    /**
+     * \brief Returns the maximum total weight.
+     */
+    size_type capacity() const noexcept { return m_capacity; }
+
+
+private:
+    using index_type = __detail::__cache_index<position>;
+
+    /**
+     */
+    size_type find_bucket(const key_type& key, std::size_t hash) const {
+        return m_index.find(hash, [&](const position& pos) { return m_equal(pos->key, key); });
+    }
+
+    /**
+     * \brief Relinks `pos` at the front; splicing after the sentinel `end()`
+     * places it first.
+     */
+    void touch(position pos) {
+        m_entries.splice(m_entries.cend(), m_entries, pos);
+    }
+
+    /**
+     * \brief Unindexes and extracts the least recently used entry.
+     */
+    typename list_type::node_type evict() {
+        position last = std::prev(m_entries.end());
+        m_index.erase(m_index.find(last->hash, [&](const position& pos) { return pos == last; }));
+        m_weight -= last->weight;
+        return m_entries.extract(last);
+    }
+
+    /**
+     */
+    void erase_at(size_type bucket) {
+        position pos = m_index.ref(bucket);
+        m_weight -= pos->weight;
+        m_index.erase(bucket);
+        m_entries.erase(pos);
+    }
+
+
+private:
+    list_type   m_entries;   // most recently used first
+    index_type  m_index;
+    size_type   m_capacity;
+    size_type   m_weight;
+    [[no_unique_address]] hasher       m_hash;
+    [[no_unique_address]] key_equal    m_equal;
+    [[no_unique_address]] weigher_type m_weigher;
+};
+
+
+} // namespace mystl::
+
+
+#endif // LRU_CACHE_HPP_
@@ -0,0 +1,145 @@
+/**
+ * \file node_handle.hpp
+ *
+ * \reference:
+ * - cppreference.com: node handle
+ */
+
+#pragma once
+
+#ifndef NODE_HANDLE_HPP_
+#define NODE_HANDLE_HPP_
+
+#include <cassert>          // assert
+#include <utility>          // exchange, swap
+
+
+namespace mystl {
+
+
+template <typename _T>
+class list;
+
+template <typename _T, bool _CacheTail>
+class forward_list;
+
+
+/**
+ * \class node_handle
+ *
+ * \brief Owns a single node that was extracted from a node-based container.
+ *
+ * The node can be inserted into another container of the same type without
+ * allocating or copying the element. A handle that still owns its node when
+ * destroyed frees it. Move-only.
+ *
+ * \tparam _Node: Node type of the container.
+ * \tparam _Value: Type of the element stored in the node.
+ */
+template <typename _Node, typename _Value>
+class node_handle {
+    template <typename _T>
+    friend class list;
+
+    template <typename _T, bool _CacheTail>
+    friend class forward_list;
+
+public:
+    using value_type = _Value;
+
+
+/* Constructor and Destructor */
+public:
+    /**
+     * \brief Constructs an empty handle.
+     */
+    constexpr node_handle() noexcept : p_node(nullptr) {}
+
+    /**
+     * \brief Takes over the node of `other`, leaving it empty.
+     */
+    node_handle(node_handle&& other) noexcept : p_node(std::exchange(other.p_node, nullptr)) {}
+
+    node_handle(const node_handle&) = delete;
+
+    /**
+     * \brief Frees the owned node, if any.
+     */
+    ~node_handle() { delete p_node; }
+
+
+/* Operators */
+public:
+    /**
+     * \brief Frees the owned node, if any, and takes over the node of `other`.
+     */
+    node_handle& operator=(node_handle&& other) noexcept {
+        if (this != &other) {
+            delete p_node;
+            p_node = std::exchange(other.p_node, nullptr);
+        }
+        return *this;
+    }
+
+    node_handle& operator=(const node_handle&) = delete;
+
+    /**
+     * \brief Checks whether the handle owns a node.
+     */
+    explicit operator bool() const noexcept { return p_node != nullptr; }
+
+
+/* Observers */
+public:
+    /**
+     * \brief Checks whether the handle is empty.
+     */
+    [[nodiscard]] bool empty() const noexcept { return p_node == nullptr; }
+
+    /**
+     * \brief Access the element stored in the node, the handle must not be empty.
+     */
+    value_type& value() const noexcept {
+        assert(p_node != nullptr);
+        return p_node->data;
+    }
+
+
+/* Modifiers */
+public:
+    /**
+     * \brief Exchanges the owned nodes.
+     */
+    void swap(node_handle& other) noexcept { std::swap(p_node, other.p_node); }
+
+
+private:
+    /**
+     * \brief Takes ownership of an already unlinked node, used by the containers.
+     */
+    explicit node_handle(_Node* node) noexcept : p_node(node) {}
+
+    /**
+     * \brief Gives up ownership of the node, used by the containers.
+     */
+    _Node* release() noexcept { return std::exchange(p_node, nullptr); }
+
+
+private:
+    _Node* p_node;
+};
+
+
+/**
+ * \brief Exchanges the nodes owned by two handles.
+ */
+template <typename _Node, typename _Value>
+void swap(node_handle<_Node, _Value>& lhs, node_handle<_Node, _Value>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+
+} // namespace mystl::
+
+
+#endif // NODE_HANDLE_HPP_
@@ -0,0 +1,432 @@
+/**
+ * \file pairing_heap.hpp
+ *
+ * \reference:
+ * - M. L. Fredman, R. Sedgewick, D. D. Sleator, R. E. Tarjan: The Pairing
+ *   Heap: A New Form of Self-Adjusting Heap
+ */
+
+#pragma once
+
+#ifndef PAIRING_HEAP_HPP_
+#define PAIRING_HEAP_HPP_
+
+#include <cstddef>          // size_t
+#include <functional>       // less
+#include <memory>           // construct_at, destroy_at
+#include <stdexcept>        // out_of_range, length_error
+#include <utility>          // move, forward, swap, exchange
+
+
+namespace mystl {
+
+
+/**
+ * \class pairing_heap
+ *
+ * \brief A node-based priority queue with O(1) `push` and `meld`, amortized
+ * O(log n) `pop`, and handles for changing or erasing queued elements.
+ *
+ * The heap is a single tree in which every node outranks its children;
+ * children are kept in a list hanging off their parent. `push` and `meld`
+ * only link two roots. `pop` merges the root's children in two passes, which
+ * is where the amortized work is done. Nodes of popped and erased elements
+ * are pooled and reused by later pushes.
+ *
+ * \tparam _T: Type of the elements.
+ * \tparam _Compare: Comparison functor, `std::less` makes `top()` the largest
+ *         element, like `priority_queue`.
+ */
+template <typename _T, typename _Compare = std::less<_T>>
+class pairing_heap {
+private:
+    struct node {
+        node* child;     // first child
+        node* sibling;   // next sibling
+        node* prev;      // previous sibling, or the parent for a first child
+        union {
+            _T data;     // alive while the node is in the heap, not while it is pooled
+        };
+
+        node() noexcept : child(nullptr), sibling(nullptr), prev(nullptr) {}
+        ~node() {}
+    };
+
+public:
+    using value_type      = _T;
+    using value_compare   = _Compare;
+    using size_type       = std::size_t;
+    using reference       = _T&;
+    using const_reference = const _T&;
+
+
+    /**
+     * \brief Refers to a queued element. Valid until the element is popped
+     * or erased; survives `meld` into another heap.
+     */
+    class handle {
+        friend class pairing_heap;
+
+    public:
+        /**
+         */
+        constexpr handle() noexcept : p_node(nullptr) {}
+
+        /**
+         * \brief Access the element.
+         */
+        const_reference operator*() const noexcept { return p_node->data; }
+        const _T*       operator->() const noexcept { return &p_node->data; }
+
+        /**
+         */
+        bool operator==(const handle& other) const noexcept = default;
+
+    private:
+        explicit handle(node* n) noexcept : p_node(n) {}
+
+    private:
+        node* p_node;
+    };
+
+
+/* Constructor and Destructor */
+public:
+    /**
+     * \brief Construct an empty pairing_heap.
+     */
+    pairing_heap() : p_root(nullptr), p_free(nullptr), m_size(0), m_comp() {}
+
+    explicit pairing_heap(const value_compare& comp) : p_root(nullptr), p_free(nullptr), m_size(0), m_comp(comp) {}
+
+    pairing_heap(const pairing_heap&) = delete;
+    pairing_heap& operator=(const pairing_heap&) = delete;
+
+    /**
+     * \brief Move constructor, handles keep referring to the moved elements.
+     */
+    pairing_heap(pairing_heap&& other) noexcept
+        : p_root(std::exchange(other.p_root, nullptr)), p_free(std::exchange(other.p_free, nullptr)),
+          m_size(std::exchange(other.m_size, 0)), m_comp(std::move(other.m_comp))
+    {
+    }
+
+    /**
+     * \brief Move assignment operator.
+     */
+    pairing_heap& operator=(pairing_heap&& other) noexcept {
+        if (this != &other) {
+            pairing_heap(std::move(other)).swap(*this);
+        }
+        return *this;
+    }
+
+    /**
+     * \brief Destructor
+     */
+    ~pairing_heap() {
+        clear();
+        shrink_to_fit();
+    }
+
+
+/* Element access */
+public:
+    /**
+     * \brief Access the top element, the highest priority element.
+     *
+     * \throws std::out_of_range if the pairing_heap is empty.
+     */
+    const_reference top() const {
+        if (p_root == nullptr)
+            throw std::out_of_range("pairing_heap::top(): the heap is empty");
+        return p_root->data;
+    }
+
+
+/* Capacity */
+public:
+    /**
+     * \brief Checks whether the pairing_heap is empty.
+     */
+    bool empty() const { return m_size == 0; }
+
+    /**
+     * \brief Returns the number of elements.
+     */
+    size_type size() const { return m_size; }
+
+
+/* Modifiers */
+public:
+    /**
+     * \brief Inserts an element in O(1).
+     *
+     * \return A handle to the inserted element.
+     */
+    handle push(const_reference value) { return emplace(value); }
+
+    handle push(value_type&& value) { return emplace(std::move(value)); }
+
+    /**
+     * \brief Constructs an element in-place in O(1).
+     *
+     * \return A handle to the inserted element.
+     */
+    template <typename... Args>
+    handle emplace(Args&&... args) {
+        node* n = acquire(std::forward<Args>(args)...);
+        p_root = p_root ? link(p_root, n) : n;
+        ++m_size;
+        return handle(n);
+    }
+
+    /**
+     * \brief Removes the top element in amortized O(log n).
+     *
+     * \throws std::length_error if the pairing_heap is empty.
+     */
+    void pop() {
+        if (p_root == nullptr)
+            throw std::length_error("pairing_heap::pop(): the heap is empty");
+        node* old = p_root;
+        p_root = merge_children(old);
+        release(old);
+        --m_size;
+    }
+
+    /**
+     * \brief Moves all elements of `other` into this heap in O(1), leaving
+     * `other` empty. Handles to the moved elements stay valid.
+     */
+    void meld(pairing_heap& other) {
+        if (this == &other || other.p_root == nullptr)
+            return;
+
+        //
+        p_root = p_root ? link(p_root, other.p_root) : other.p_root;
+        m_size += other.m_size;
+        other.p_root = nullptr;
+        other.m_size = 0;
+    }
+
+    /**
+     * \brief Replaces the element of `h` with `value`, which must not have a
+     * lower priority (for `std::greater`, a smaller or equal key).
+     *
+     * \note Relinks in O(1), the restructuring is left to the next `pop`.
+     */
+    void decrease_key(handle h, const_reference value) {
+        node* n = h.p_node;
+        n->data = value;
+        if (n == p_root)
+            return;
+        cut(n);
+        p_root = link(p_root, n);
+    }
+
+    void decrease_key(handle h, value_type&& value) {
+        node* n = h.p_node;
+        n->data = std::move(value);
+        if (n == p_root)
+            return;
+        cut(n);
+        p_root = link(p_root, n);
+    }
+
+    /**
+     * \brief Removes the element of `h` in amortized O(log n).
+     */
+    void erase(handle h) {
+        node* n = h.p_node;
+        if (n == p_root) {
+            pop();
+            return;
+        }
+
+        //
+        cut(n);
+        node* rest = merge_children(n);
+        if (rest)
+            p_root = link(p_root, rest);
+        release(n);
+        --m_size;
+    }
+
+    /**
+     * \brief Removes all elements, keeping their nodes in the pool.
+     */
+    void clear() {
+        if (p_root == nullptr)
+            return;
+
+        // walk the tree without recursion or a stack, since it can be a long
+        // chain: the first child of the current node is rotated in front of
+        // it in the `sibling` chain of nodes left to visit
+        node* n = p_root;
+        n->sibling = nullptr;
+        while (n) {
+            if (node* c = n->child) {
+                n->child = c->sibling;
+                c->sibling = n;
+                n = c;
+            } else {
+                node* next = n->sibling;
+                release(n);
+                n = next;
+            }
+        }
+        p_root = nullptr;
+        m_size = 0;
+    }
+
+    /**
+     * \brief Frees the pooled nodes, whose elements are already destroyed.
+     */
+    void shrink_to_fit() noexcept {
+        while (p_free) {
+            node* next = p_free->sibling;
+            delete p_free;
+            p_free = next;
+        }
+    }
+
+    /**
+     * \brief Swaps this pairing_heap with another pairing_heap.
+     */
+    void swap(pairing_heap& other) noexcept {
+        std::swap(p_root, other.p_root);
+        std::swap(p_free, other.p_free);
+        std::swap(m_size, other.m_size);
+        std::swap(m_comp, other.m_comp);
+    }
+
+
+private:
+    /**
+     * \brief Takes a node from the pool, or allocates one, and constructs its
+     * element in place.
+     */
+    template <typename... Args>
+    node* acquire(Args&&... args) {
+        node* n = p_free;
+        if (n == nullptr)
+            n = new node();
+        else
+            p_free = n->sibling;
+
+        //
+        try {
+            std::construct_at(&n->data, std::forward<Args>(args)...);
+        }
+        catch (...) {
+            // the element is not alive, pool the node as it is
+            n->sibling = p_free;
+            p_free = n;
+            throw;
+        }
+        n->child = n->sibling = n->prev = nullptr;
+        return n;
+    }
+
+    /**
+     * \brief Destroys the element of `n` and returns the node to the pool.
+     */
+    void release(node* n) noexcept {
+        std::destroy_at(&n->data);
+        n->sibling = p_free;
+        p_free = n;
+    }
+
+    /**
+     * \brief Makes the lower priority of two roots the first child of the
+     * other, and returns the new root.
+     */
+    node* link(node* a, node* b) {
+        if (m_comp(a->data, b->data))
+            std::swap(a, b);
+
+        //
+        b->sibling = a->child;
+        if (a->child)
+            a->child->prev = b;
+        b->prev = a;
+        a->child = b;
+        a->sibling = a->prev = nullptr;
+        return a;
+    }
+
+    /**
+     * \brief Detaches the subtree of `n`, which is not the root, from its
+     * parent or siblings.
+     */
+    void cut(node* n) noexcept {
+        if (n->prev->child == n)
+            n->prev->child = n->sibling;
+        else
+            n->prev->sibling = n->sibling;
+        if (n->sibling)
+            n->sibling->prev = n->prev;
+        n->sibling = n->prev = nullptr;
+    }
+
+    /**
+     * \brief Merges the children of `n` into one tree by two-pass pairing and
+     * returns its root, or null.
+     */
+    node* merge_children(node* n) {
+        node* first = n->child;
+        n->child = nullptr;
+        if (first == nullptr)
+            return nullptr;
+
+        // left to right: link pairs, chaining the results backwards through `prev`
+        node* last = nullptr;
+        while (first) {
+            node* a = first;
+            node* b = a->sibling;
+            if (b == nullptr) {
+                a->sibling = nullptr;
+                a->prev = last;
+                last = a;
+                break;
+            }
+            first = b->sibling;
+            node* pair = link(a, b);
+            pair->prev = last;
+            last = pair;
+        }
+
+        // right to left: fold the pairs into the last one
+        node* root = last;
+        for (node* curr = last->prev; curr; ) {
+            node* next = curr->prev;
+            root = link(root, curr);
+            curr = next;
+        }
+        root->prev = nullptr;
+        return root;
+    }
+
+
+private:
+    node*         p_root;
+    node*         p_free;   // pool of released nodes, linked by `sibling`
+    size_type     m_size;
+    value_compare m_comp;
+};
+
+
+/**
+ * \brief Specializes the std::swap algorithm for mystl::pairing_heap.
+ */
+template <typename _T, typename _Compare>
+void swap(pairing_heap<_T, _Compare>& lhs, pairing_heap<_T, _Compare>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+
+} // namespace mystl::
+
+
+#endif // PAIRING_HEAP_HPP_
@@ -7,17 +7,81 @@
 #ifndef PRIORITY_QUEUE_HPP_
 #define PRIORITY_QUEUE_HPP_
 
+#include <cstddef>      // std::size_t
 #include <functional>   // std::less
 #include <utility>      // std::move
-#include <iterator>     // std::input_iterator
+#include <iterator>     // std::input_iterator, std::output_iterator
 
 #include "vector.hpp"
 #include "algorithm/push_heap.hpp"
 #include "algorithm/pop_heap.hpp"
 #include "algorithm/make_heap.hpp"
+#include "algorithm/pop_heap_n.hpp"
+#include "algorithm/b_heap.hpp"
 
 namespace mystl {
 
+
+/**
+ * \brief Heap layout of `priority_queue`: the plain binary heap, with the
+ * children of position `i` at `2i + 1` and `2i + 2`.
+ */
+struct binary_heap_layout {
+    template <typename _RandomAccessIter, typename _Compare>
+    static void push(_RandomAccessIter first, _RandomAccessIter last, _Compare comp) {
+        mystl::push_heap(first, last, comp);
+    }
+
+    template <typename _RandomAccessIter, typename _Compare>
+    static void pop(_RandomAccessIter first, _RandomAccessIter last, _Compare comp) {
+        mystl::pop_heap(first, last, comp);
+    }
+
+    template <typename _RandomAccessIter, typename _Compare>
+    static void make(_RandomAccessIter first, _RandomAccessIter last, _Compare comp) {
+        mystl::make_heap(first, last, comp);
+    }
+
+    template <typename _RandomAccessIter, typename _Compare>
+    static void pop_n(_RandomAccessIter first, _RandomAccessIter last,
+                      typename std::iterator_traits<_RandomAccessIter>::difference_type n, _Compare comp) {
+        mystl::pop_heap_n(first, last, n, comp);
+    }
+};
+
+
+/**
+ * \brief Heap layout of `priority_queue`: the B-heap of `algorithm/b_heap.hpp`,
+ * with subtrees packed into pages of `_PageBytes` bytes. Pays a few more
+ * index computations per level for touching far fewer pages once the heap
+ * outgrows the caches.
+ */
+template <std::size_t _PageBytes = 4096>
+struct b_heap_layout {
+    template <typename _RandomAccessIter, typename _Compare>
+    static void push(_RandomAccessIter first, _RandomAccessIter last, _Compare comp) {
+        mystl::push_b_heap<_PageBytes>(first, last, comp);
+    }
+
+    template <typename _RandomAccessIter, typename _Compare>
+    static void pop(_RandomAccessIter first, _RandomAccessIter last, _Compare comp) {
+        mystl::pop_b_heap<_PageBytes>(first, last, comp);
+    }
+
+    template <typename _RandomAccessIter, typename _Compare>
+    static void make(_RandomAccessIter first, _RandomAccessIter last, _Compare comp) {
+        mystl::make_b_heap<_PageBytes>(first, last, comp);
+    }
+
+    template <typename _RandomAccessIter, typename _Compare>
+    static void pop_n(_RandomAccessIter first, _RandomAccessIter last,
+                      typename std::iterator_traits<_RandomAccessIter>::difference_type n, _Compare comp) {
+        for (; n > 0; --n, --last)
+            mystl::pop_b_heap<_PageBytes>(first, last, comp);
+    }
+};
+
+
 /**
  * \class priority_queue
  *
@@ -25,9 +89,12 @@ namespace mystl {
  * \tparam _Container: Type of the underlying container, must support random 
  * access iterators (defaults to `mystl::vector<_T>`). 
  * \tparam _Compare: Comparison functor type, defaults to `std::less<>` for max heap.
+ * \tparam _Layout: How the heap is arranged in the container, `binary_heap_layout`
+ * (default) or `b_heap_layout<PageBytes>`.
  */
 template <class _T, class _Container = mystl::vector<_T>,
-          class _Compare = std::less<typename _Container::value_type> >
+          class _Compare = std::less<typename _Container::value_type>,
+          class _Layout = binary_heap_layout>
 class priority_queue {
 public:
     using container_type  = _Container;
@@ -36,6 +103,7 @@ public:
     using size_type       = typename _Container::size_type;
     using reference       = typename _Container::reference;
     using const_reference = typename _Container::const_reference;
+    using layout_type     = _Layout;
 
 /* Constructor and Destructor */
 public:
@@ -65,7 +133,7 @@ public:
     priority_queue(const value_compare& comp, const container_type& container)
         : m_container(container), m_comp(comp) 
     {
-        mystl::make_heap(m_container.begin(), m_container.end(), m_comp);
+        _Layout::make(m_container.begin(), m_container.end(), m_comp);
     }
 
 
@@ -79,7 +147,7 @@ public:
     priority_queue(const value_compare& comp, container_type&& container)
         : m_container(std::move(container)), m_comp(comp) 
     {
-        mystl::make_heap(m_container.begin(), m_container.end(), m_comp);
+        _Layout::make(m_container.begin(), m_container.end(), m_comp);
     }
 
 
@@ -107,7 +175,7 @@ public:
     priority_queue(InputIt first, InputIt last, const value_compare& comp = value_compare()) 
         : m_container(first, last), m_comp(comp)
     {
-        mystl::make_heap(m_container.begin(), m_container.end(), m_comp);
+        _Layout::make(m_container.begin(), m_container.end(), m_comp);
     }
 
 
@@ -165,6 +233,48 @@ public:
     size_type size() const { return m_container.size(); }
 
 
+    /**
+     * \brief Reserves storage in the underlying container for `count` elements.
+     */
+    void reserve(size_type count)
+        requires requires (container_type& c) { c.reserve(count); }
+    {
+        m_container.reserve(count);
+    }
+
+
+/* Memory */
+public:
+    /**
+     * \brief Returns the bytes the underlying container allocated on the heap.
+     */
+    size_type allocated_bytes() const noexcept
+        requires requires (const container_type& c) { c.allocated_bytes(); }
+    {
+        return m_container.allocated_bytes();
+    }
+
+
+    /**
+     * \brief Returns the bytes used by the priority_queue, its own object and `allocated_bytes()`.
+     */
+    size_type memory_footprint() const noexcept
+        requires requires (const container_type& c) { c.allocated_bytes(); }
+    {
+        return sizeof(*this) + allocated_bytes();
+    }
+
+
+    /**
+     * \brief Returns the bytes of `memory_footprint()` not holding elements.
+     */
+    size_type overhead_bytes() const noexcept
+        requires requires (const container_type& c) { c.allocated_bytes(); }
+    {
+        return memory_footprint() - size() * sizeof(value_type);
+    }
+
+
 /* Modifiers */
 public:
     /**
@@ -174,7 +284,7 @@ public:
      */
     void push(const_reference value) {
         m_container.push_back(value);
-        mystl::push_heap(m_container.begin(), m_container.end(), m_comp);
+        _Layout::push(m_container.begin(), m_container.end(), m_comp);
     }
 
 
@@ -185,7 +295,7 @@ public:
      */
     void push(value_type&& value) {
         m_container.push_back(std::move(value));
-        mystl::push_heap(m_container.begin(), m_container.end(), m_comp);
+        _Layout::push(m_container.begin(), m_container.end(), m_comp);
     }
 
 
@@ -199,7 +309,7 @@ public:
     template <typename... Args>
     void emplace(Args&&... args) {
         m_container.emplace_back(std::forward<Args>(args)...);
-        mystl::push_heap(m_container.begin(), m_container.end(), m_comp);
+        _Layout::push(m_container.begin(), m_container.end(), m_comp);
     }
 
 
@@ -207,8 +317,68 @@ public:
      * \brief Removes the top element of the priority_queue.
      */
     void pop() {
-        mystl::pop_heap(m_container.begin(), m_container.end(), m_comp);
+        _Layout::pop(m_container.begin(), m_container.end(), m_comp);
+        m_container.pop_back();
+    }
+
+
+    /**
+     * \brief Removes the top element and returns it by move, so that a heavy
+     *        element does not have to be copied out of `top()` first.
+     */
+    value_type pop_value() {
+        _Layout::pop(m_container.begin(), m_container.end(), m_comp);
+        value_type value = std::move(m_container.back());
         m_container.pop_back();
+        return value;
+    }
+
+
+    /**
+     * \brief Removes the `n` top elements, or all if there are fewer, and
+     *        writes them to `out` by move, highest priority first.
+     *
+     * Pops them all into the tail of the container first, which for the
+     * binary heap layout takes about half the comparisons of `n` calls of
+     * `pop()`, then moves them out from the back.
+     *
+     * \return The output iterator past the last element written.
+     */
+    template <std::output_iterator<value_type> OutputIt>
+    OutputIt pop_n(size_type n, OutputIt out) {
+        if (n > m_container.size())
+            n = m_container.size();
+        _Layout::pop_n(m_container.begin(), m_container.end(), n, m_comp);
+        for (; n > 0; --n) {
+            *out = std::move(m_container.back());
+            ++out;
+            m_container.pop_back();
+        }
+        return out;
+    }
+
+
+    /**
+     * \brief Moves the underlying container out, leaving the priority_queue
+     *        empty.
+     *
+     * \return The container, still arranged as a heap.
+     */
+    container_type extract_container() {
+        container_type container = std::move(m_container);
+        m_container.clear();
+        return container;
+    }
+
+
+    /**
+     * \brief Replaces the underlying container with `container`, heapified
+     *        in O(n); typically one obtained from `extract_container` and
+     *        refilled, so that its storage is reused.
+     */
+    void replace_container(container_type&& container) {
+        m_container = std::move(container);
+        _Layout::make(m_container.begin(), m_container.end(), m_comp);
     }
 
 
@@ -0,0 +1,222 @@
+/**
+ * \file radix_heap.hpp
+ *
+ * \reference:
+ * - R. K. Ahuja, K. Mehlhorn, J. B. Orlin, R. E. Tarjan: Faster Algorithms
+ *   for the Shortest Path Problem
+ */
+
+#pragma once
+
+#ifndef RADIX_HEAP_HPP_
+#define RADIX_HEAP_HPP_
+
+#include <bit>              // bit_width
+#include <concepts>         // unsigned_integral
+#include <cstddef>          // size_t
+#include <limits>           // numeric_limits
+#include <stdexcept>        // out_of_range, length_error
+#include <tuple>            // forward_as_tuple
+#include <utility>          // pair, piecewise_construct, move, forward, swap
+
+#include "vector.hpp"       // vector
+
+
+namespace mystl {
+
+
+/**
+ * \class radix_heap
+ *
+ * \brief A monotone min priority queue for unsigned integer keys: every
+ * pushed key must be at least the key of the last element returned by
+ * `top()` or removed by `pop()`, which is the case for Dijkstra's algorithm
+ * and for discrete event simulation.
+ *
+ * Elements are kept in buckets by the highest bit in which their key differs
+ * from that last key. When the lowest bucket runs empty, the next
+ * non-empty bucket is emptied into the lower ones around its minimum key.
+ * Every element can only move to strictly lower buckets, so pushing and
+ * popping take amortized O(log C) for keys spanning C values, with a
+ * constant far below that of a binary heap's sift.
+ *
+ * Offers the same interface as `priority_queue`, with `top()` being the
+ * element with the smallest key.
+ *
+ * \tparam _Key: Unsigned integer type of the keys.
+ * \tparam _T: Type of the values stored along the keys.
+ */
+template <std::unsigned_integral _Key, typename _T>
+class radix_heap {
+public:
+    using key_type        = _Key;
+    using mapped_type     = _T;
+    using value_type      = std::pair<_Key, _T>;
+    using size_type       = std::size_t;
+    using reference       = value_type&;
+    using const_reference = const value_type&;
+
+    static constexpr size_type BUCKETS = std::numeric_limits<_Key>::digits + 1;
+
+
+/* Constructor */
+public:
+    /**
+     * \brief Constructs an empty heap whose last key counts as 0.
+     */
+    radix_heap() : m_buckets(), m_size(0), m_last(0) {}
+
+
+/* Element access */
+public:
+    /**
+     * \brief Access the element with the smallest key.
+     *
+     * \throws std::out_of_range if the radix_heap is empty.
+     */
+    const_reference top() const {
+        if (empty())
+            throw std::out_of_range("radix_heap::top(): the heap is empty");
+        pull();
+        return m_buckets[0].back();
+    }
+
+
+/* Capacity */
+public:
+    /**
+     * \brief Checks whether the radix_heap is empty.
+     */
+    bool empty() const { return m_size == 0; }
+
+    /**
+     * \brief Returns the number of elements.
+     */
+    size_type size() const { return m_size; }
+
+    /**
+     * \brief Returns the key of the last element seen by `top` or `pop`, the
+     * lower bound for keys that may be pushed.
+     */
+    key_type last_key() const { return m_last; }
+
+
+/* Modifiers */
+public:
+    /**
+     * \brief Inserts an element.
+     *
+     * \throws std::out_of_range: Thrown if the key is less than `last_key()`.
+     */
+    void push(const value_type& value) {
+        check(value.first);
+        m_buckets[bucket_of(value.first)].push_back(value);
+        ++m_size;
+    }
+
+    void push(value_type&& value) {
+        check(value.first);
+        m_buckets[bucket_of(value.first)].push_back(std::move(value));
+        ++m_size;
+    }
+
+    /**
+     * \brief Constructs an element in place with `key` and a value from `args`.
+     *
+     * \throws std::out_of_range: Thrown if the key is less than `last_key()`.
+     */
+    template <typename... Args>
+    void emplace(key_type key, Args&&... args) {
+        check(key);
+        m_buckets[bucket_of(key)].emplace_back(std::piecewise_construct,
+                                               std::forward_as_tuple(key),
+                                               std::forward_as_tuple(std::forward<Args>(args)...));
+        ++m_size;
+    }
+
+    /**
+     * \brief Removes the element with the smallest key.
+     *
+     * \throws std::length_error if the radix_heap is empty.
+     */
+    void pop() {
+        if (empty())
+            throw std::length_error("radix_heap::pop(): the heap is empty");
+        pull();
+        m_buckets[0].pop_back();
+        --m_size;
+    }
+
+    /**
+     * \brief Removes all elements; `last_key()` is kept.
+     */
+    void clear() {
+        for (size_type i = 0; i < BUCKETS; ++i)
+            m_buckets[i].clear();
+        m_size = 0;
+    }
+
+    /**
+     * \brief Swaps this radix_heap with another radix_heap.
+     */
+    void swap(radix_heap& other) noexcept {
+        for (size_type i = 0; i < BUCKETS; ++i)
+            m_buckets[i].swap(other.m_buckets[i]);
+        std::swap(m_size, other.m_size);
+        std::swap(m_last, other.m_last);
+    }
+
+
+private:
+    /**
+     */
+    size_type bucket_of(key_type key) const noexcept {
+        return static_cast<size_type>(std::bit_width(static_cast<key_type>(key ^ m_last)));
+    }
+
+    /**
+     */
+    void check(key_type key) const {
+        if (key < m_last)
+            throw std::out_of_range("radix_heap::push(): key is less than the last key");
+    }
+
+    /**
+     * \brief Refills bucket 0 from the first non-empty bucket, rebasing on its
+     * minimum key. Bucket 0 then holds exactly the elements with that key.
+     *
+     * \note The heap must not be empty.
+     */
+    void pull() const {
+        if (!m_buckets[0].empty())
+            return;
+
+        //
+        size_type i = 1;
+        while (m_buckets[i].empty())
+            ++i;
+        key_type min = m_buckets[i][0].first;
+        for (size_type j = 1; j < m_buckets[i].size(); ++j)
+            if (m_buckets[i][j].first < min)
+                min = m_buckets[i][j].first;
+
+        //
+        m_last = min;
+        for (size_type j = 0; j < m_buckets[i].size(); ++j)
+            m_buckets[bucket_of(m_buckets[i][j].first)].push_back(std::move(m_buckets[i][j]));
+        m_buckets[i].clear();
+    }
+
+
+private:
+    // refilled lazily by `top`, which is logically const
+    mutable mystl::vector<value_type> m_buckets[BUCKETS];
+    size_type                         m_size;
+    mutable key_type                  m_last;
+};
+
+
+} // namespace mystl::
+
+
+#endif // RADIX_HEAP_HPP_
@@ -0,0 +1,173 @@
+/**
+ * \file sharded_cache.hpp
+ */
+
+#pragma once
+
+#ifndef SHARDED_CACHE_HPP_
+#define SHARDED_CACHE_HPP_
+
+#include <cstddef>          // size_t
+#include <mutex>            // mutex, lock_guard
+#include <optional>         // optional, nullopt
+#include <utility>          // move
+
+
+namespace mystl {
+
+
+/**
+ * \class sharded_cache
+ *
+ * \brief A thread-safe wrapper that splits a cache into independently locked
+ * shards, chosen by key hash, so that threads touching different shards do
+ * not contend.
+ *
+ * Each shard evicts on its own, so the policy (LRU or CLOCK) is only exact
+ * per shard.
+ *
+ * \tparam _Cache: The single-threaded cache, `lru_cache` or `clock_cache`.
+ * \tparam _Shards: Number of shards, a power of two.
+ */
+template <typename _Cache, std::size_t _Shards = 16>
+class sharded_cache {
+    static_assert(_Shards != 0 && (_Shards & (_Shards - 1)) == 0, "sharded_cache: shard count must be a power of two");
+
+public:
+    using cache_type  = _Cache;
+    using key_type    = typename _Cache::key_type;
+    using mapped_type = typename _Cache::mapped_type;
+    using size_type   = std::size_t;
+    using hasher      = typename _Cache::hasher;
+
+    static constexpr size_type SHARDS = _Shards;
+
+
+/* Constructor */
+public:
+    /**
+     * \brief Constructs an empty cache; every shard gets an equal part of
+     * `capacity`, rounded up.
+     */
+    explicit sharded_cache(size_type capacity) : m_shards() {
+        for (size_type i = 0; i < _Shards; ++i)
+            m_shards[i].cache.emplace((capacity + _Shards - 1) / _Shards);
+    }
+
+    sharded_cache(const sharded_cache&) = delete;
+    sharded_cache& operator=(const sharded_cache&) = delete;
+
+
+/* Lookup */
+public:
+    /**
+     * \brief Returns a copy of the value cached under `key`, updating its
+     * recency, or nothing on a miss.
+     */
+    std::optional<mapped_type> get(const key_type& key) {
+        shard& s = shard_for(key);
+        std::lock_guard<std::mutex> lock(s.mutex);
+        if (mapped_type* value = s.cache->get(key))
+            return *value;
+        return std::nullopt;
+    }
+
+    /**
+     * \brief Checks whether `key` is cached, without updating its recency.
+     */
+    bool contains(const key_type& key) {
+        shard& s = shard_for(key);
+        std::lock_guard<std::mutex> lock(s.mutex);
+        return s.cache->contains(key);
+    }
+
+
+/* Modifiers */
+public:
+    /**
+     * \brief Caches `value` under `key`, see the wrapped cache's `put`.
+     */
+    bool put(const key_type& key, mapped_type value) {
+        shard& s = shard_for(key);
+        std::lock_guard<std::mutex> lock(s.mutex);
+        return s.cache->put(key, std::move(value));
+    }
+
+    /**
+     * \brief Removes the entry for `key`, if any.
+     */
+    bool erase(const key_type& key) {
+        shard& s = shard_for(key);
+        std::lock_guard<std::mutex> lock(s.mutex);
+        return s.cache->erase(key);
+    }
+
+    /**
+     * \brief Removes all entries, locking one shard at a time.
+     */
+    void clear() {
+        for (size_type i = 0; i < _Shards; ++i) {
+            std::lock_guard<std::mutex> lock(m_shards[i].mutex);
+            m_shards[i].cache->clear();
+        }
+    }
+
+
+/* Capacity */
+public:
+    /**
+     * \brief Returns the number of entries, locking one shard at a time.
+     */
+    size_type size() {
+        size_type total = 0;
+        for (size_type i = 0; i < _Shards; ++i) {
+            std::lock_guard<std::mutex> lock(m_shards[i].mutex);
+            total += m_shards[i].cache->size();
+        }
+        return total;
+    }
+
+
+private:
+    /**
+     * \brief One lock and its cache, padded to their own cache lines.
+     */
+    struct alignas(64) shard {
+        std::mutex                mutex;
+        std::optional<cache_type> cache;
+    };
+
+    /**
+     * \brief Picks a shard from the high bits of the hash, leaving the low
+     * bits to the shard's own index.
+     */
+    shard& shard_for(const key_type& key) {
+        if constexpr (_Shards == 1) {
+            return m_shards[0];
+        } else {
+            std::size_t hash = hasher()(key);
+            hash ^= hash >> (sizeof(std::size_t) * 4);
+            hash *= static_cast<std::size_t>(0x9E3779B97F4A7C15ull);
+            return m_shards[hash >> (sizeof(std::size_t) * 8 - SHIFT)];
+        }
+    }
+
+    static constexpr size_type shift_for(size_type n) noexcept {
+        size_type bits = 0;
+        while ((size_type(1) << bits) < n)
+            ++bits;
+        return bits;
+    }
+
+    static constexpr size_type SHIFT = shift_for(_Shards);
+
+
+private:
+    shard m_shards[_Shards];
+};
+
+
+} // namespace mystl::
+
+
+#endif // SHARDED_CACHE_HPP_
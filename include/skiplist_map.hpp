@@ -0,0 +1,817 @@
+/**
+ * \file skiplist_map.hpp
+ *
+ * \reference:
+ * - William Pugh, "Skip Lists: A Probabilistic Alternative to Balanced Trees"
+ * - cppreference.com: std::map
+ */
+
+#pragma once
+
+#ifndef SKIPLIST_MAP_HPP_
+#define SKIPLIST_MAP_HPP_
+
+#include <atomic>           // atomic, memory_order
+#include <cassert>          // assert
+#include <cstddef>          // size_t, ptrdiff_t
+#include <cstdint>          // uint64_t
+#include <functional>       // less
+#include <initializer_list> // initializer_list
+#include <iterator>         // forward_iterator_tag
+#include <memory>           // construct_at, destroy_at
+#include <new>              // operator new, operator delete
+#include <stdexcept>        // out_of_range, invalid_argument
+#include <tuple>            // forward_as_tuple
+#include <type_traits>      // is_convertible_v
+#include <utility>          // pair, piecewise_construct, move, forward, swap
+
+
+namespace mystl {
+
+
+/**
+ * \class skiplist_map
+ *
+ * \brief An ordered map of unique keys kept in a skip list.
+ *
+ * Every element sits in the bottom list, so in-order iteration is a plain
+ * linked-list walk. A node of height `h` is also linked into the `h - 1` lists
+ * above, each holding about `probability` times the nodes of the one below,
+ * which gives expected O(log n) lookup, insertion and erasure.
+ *
+ * A node and its forward links live in a single allocation. Erased nodes are
+ * kept in per-height free lists and reused by later insertions, until
+ * `shrink_to_fit()` or destruction.
+ *
+ * \tparam _Key: Type of the keys.
+ * \tparam _T: Type of the mapped values.
+ * \tparam _Compare: Strict weak ordering on the keys.
+ * \tparam _Concurrent: When true, any number of threads may call the const
+ *         lookup members (`find`, `contains`, `lower_bound`, `upper_bound`,
+ *         iteration) while one thread modifies the map; writers must still be
+ *         serialized with each other. Links are published with release stores
+ *         and read with acquire loads, and erased nodes are only destroyed by
+ *         `reclaim()`, which the caller runs when no reader is active.
+ */
+template <typename _Key, typename _T, typename _Compare = std::less<_Key>, bool _Concurrent = false>
+class skiplist_map {
+private:
+    struct node;
+
+    template <typename _Iter_val, typename _Iter_ptr, typename _Iter_ref>
+    class skiplist_iterator_base;
+
+public:
+    using key_type        = _Key;
+    using mapped_type     = _T;
+    using value_type      = std::pair<const _Key, _T>;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using key_compare     = _Compare;
+    using reference       = value_type&;
+    using const_reference = const value_type&;
+    using pointer         = value_type*;
+    using const_pointer   = const value_type*;
+    using iterator        = skiplist_iterator_base<value_type, pointer, reference>;
+    using const_iterator  = skiplist_iterator_base<value_type, const_pointer, const_reference>;
+
+    using node_pointer    = node*;
+
+    static constexpr size_type MAX_LEVEL = 32;
+
+
+private:
+    static constexpr std::memory_order LOAD_ORDER  = _Concurrent ? std::memory_order_acquire : std::memory_order_relaxed;
+    static constexpr std::memory_order STORE_ORDER = _Concurrent ? std::memory_order_release : std::memory_order_relaxed;
+
+    /**
+     * \brief A skip list node, followed in the same allocation by `height`
+     * forward links.
+     *
+     * The value is constructed and destroyed separately from the node so that
+     * pooled nodes can be reused without reallocating.
+     */
+    struct node {
+        node() noexcept {}
+        ~node() {}
+
+        std::atomic<node_pointer>*       links()       noexcept { return reinterpret_cast<std::atomic<node_pointer>*>(this + 1); }
+        const std::atomic<node_pointer>* links() const noexcept { return reinterpret_cast<const std::atomic<node_pointer>*>(this + 1); }
+
+        node_pointer next(size_type level) const noexcept { return links()[level].load(LOAD_ORDER); }
+        void set_next(size_type level, node_pointer ptr) noexcept { links()[level].store(ptr, STORE_ORDER); }
+
+        /**/
+        union { value_type value; };
+        node_pointer pool_next = nullptr;   // free list / retired list link
+        size_type    height    = 0;
+    };
+
+
+/* Iterators */
+private:
+    /**
+     * \brief Forward iterator over the bottom list of a skiplist_map.
+     *
+     * \tparam _Iter_val Type of the value that the iterator points to.
+     * \tparam _Iter_ptr Type of the pointer to the value (const or non-const).
+     * \tparam _Iter_ref Type of the reference to the value (const or non-const).
+     */
+    template <typename _Iter_val, typename _Iter_ptr, typename _Iter_ref>
+    class skiplist_iterator_base {
+        friend class skiplist_map;
+
+        template <typename, typename, typename>
+        friend class skiplist_iterator_base;
+
+    public:
+        using value_type        = _Iter_val;
+        using pointer           = _Iter_ptr;
+        using reference         = _Iter_ref;
+        using difference_type   = std::ptrdiff_t;
+        using iterator_category = std::forward_iterator_tag;
+
+    public:
+        skiplist_iterator_base(node_pointer ptr = nullptr) : p_ptr(ptr) {}
+
+        /**
+         * \brief Converts an `iterator` into a `const_iterator`.
+         */
+        template <typename _Ptr, typename _Ref>
+            requires (!std::is_same_v<_Ptr, _Iter_ptr> && std::is_convertible_v<_Ptr, _Iter_ptr>)
+        skiplist_iterator_base(const skiplist_iterator_base<_Iter_val, _Ptr, _Ref>& other) : p_ptr(other.p_ptr) {}
+
+    public:
+        skiplist_iterator_base& operator++() {
+            assert(p_ptr != nullptr && "Attempting to increment an end iterator");
+            p_ptr = p_ptr->next(0);
+            return *this;
+        }
+
+        skiplist_iterator_base operator++(int) {
+            assert(p_ptr != nullptr && "Attempting to increment an end iterator");
+            skiplist_iterator_base old = *this;
+            p_ptr = p_ptr->next(0);
+            return old;
+        }
+
+        reference operator*() const {
+            assert(p_ptr != nullptr && "Dereferencing an end iterator.");
+            return p_ptr->value;
+        }
+
+        pointer operator->() const {
+            assert(p_ptr != nullptr && "Dereferencing an end iterator.");
+            return &(p_ptr->value);
+        }
+
+        bool operator==(const skiplist_iterator_base& other) const noexcept {
+            return p_ptr == other.p_ptr;
+        }
+
+        bool operator!=(const skiplist_iterator_base& other) const noexcept {
+            return p_ptr != other.p_ptr;
+        }
+
+    private:
+        /**
+         * \brief Retrieves the pointer to the current node.
+         */
+        node_pointer get_node() const noexcept { return p_ptr; }
+
+    private:
+        node_pointer p_ptr;
+    };
+
+
+/* Constructor and Destructor */
+public:
+    /**
+     * \brief Constructs an empty map.
+     *
+     * \param probability: Fraction of the nodes of one level that are also
+     *        linked into the level above, in (0, 1). Lower values give shorter
+     *        nodes and longer searches.
+     * \param comp: The key comparison object.
+     * \throws std::invalid_argument if `probability` is not in (0, 1).
+     */
+    explicit skiplist_map(double probability = 0.25, const key_compare& comp = key_compare())
+        : p_head(new_raw_node(MAX_LEVEL)), m_level(1), m_size(0), m_comp(comp),
+          m_probability(probability), m_threshold(0), m_rng(0x9E3779B97F4A7C15ull),
+          m_free{}, p_retired(nullptr)
+    {
+        if (!(probability > 0.0 && probability < 1.0)) {
+            delete_raw_node(p_head);
+            throw std::invalid_argument("skiplist_map: probability must be in (0, 1)");
+        }
+        m_threshold = static_cast<std::uint64_t>(probability * 18446744073709551616.0);
+    }
+
+    /**
+     * \brief Constructs the map from the elements in [first, last), keeping the
+     * first of any equivalent keys.
+     */
+    template <std::input_iterator InputIt>
+    skiplist_map(InputIt first, InputIt last, double probability = 0.25, const key_compare& comp = key_compare())
+        : skiplist_map(probability, comp)
+    {
+        insert(first, last);
+    }
+
+    /**
+     * \brief Construct by initializer.
+     */
+    skiplist_map(std::initializer_list<value_type> initList, double probability = 0.25, const key_compare& comp = key_compare())
+        : skiplist_map(initList.begin(), initList.end(), probability, comp)
+    {
+    }
+
+    /**
+     * \brief Copy constructor, appends the (already sorted) elements in O(n).
+     */
+    skiplist_map(const skiplist_map& other)
+        : skiplist_map(other.m_probability, other.m_comp)
+    {
+        node_pointer tails[MAX_LEVEL];
+        for (size_type i = 0; i < MAX_LEVEL; ++i)
+            tails[i] = p_head;
+
+        //
+        for (node_pointer curr = other.p_head->next(0); curr != nullptr; curr = curr->next(0)) {
+            node_pointer newNode = create_node(random_height(), curr->value);
+            for (size_type i = 0; i < newNode->height; ++i) {
+                tails[i]->set_next(i, newNode);
+                tails[i] = newNode;
+            }
+            if (newNode->height > m_level.load(std::memory_order_relaxed))
+                m_level.store(newNode->height, STORE_ORDER);
+            ++m_size;
+        }
+    }
+
+    /**
+     * \brief Move constructor, `other` is left empty.
+     */
+    skiplist_map(skiplist_map&& other)
+        : skiplist_map(other.m_probability, other.m_comp)
+    {
+        swap(other);
+    }
+
+    /**
+     * \brief Destroys all elements and frees every node, pooled ones included.
+     */
+    ~skiplist_map() {
+        clear();
+        reclaim();
+        shrink_to_fit();
+        delete_raw_node(p_head);
+    }
+
+
+/* Operators */
+public:
+    /**
+     * \brief Copy assignment operator
+     */
+    skiplist_map& operator=(const skiplist_map& other) {
+        if (this != &other) {
+            skiplist_map copy(other);
+            swap(copy);
+        }
+        return *this;
+    }
+
+    /**
+     * \brief Move assignment operator
+     */
+    skiplist_map& operator=(skiplist_map&& other) {
+        if (this != &other) {
+            skiplist_map moved(std::move(other));
+            swap(moved);
+        }
+        return *this;
+    }
+
+    /**
+     * \brief Returns a reference to the value mapped to `key`, inserting a
+     * value-initialized one if there is none.
+     */
+    mapped_type& operator[](const key_type& key) {
+        return try_emplace(key).first->second;
+    }
+
+    mapped_type& operator[](key_type&& key) {
+        return try_emplace(std::move(key)).first->second;
+    }
+
+
+/* Element access */
+public:
+    /**
+     * \brief Access the value mapped to `key` with bounds checking.
+     *
+     * \throws std::out_of_range if there is no such key.
+     */
+    mapped_type& at(const key_type& key) {
+        node_pointer found = find_node(key);
+        if (found == nullptr)
+            throw std::out_of_range("skiplist_map::at");
+        return found->value.second;
+    }
+
+    const mapped_type& at(const key_type& key) const {
+        node_pointer found = find_node(key);
+        if (found == nullptr)
+            throw std::out_of_range("skiplist_map::at");
+        return found->value.second;
+    }
+
+
+/* Iterators */
+public:
+    /**
+     */
+    iterator        begin()       noexcept { return iterator(p_head->next(0)); }
+    const_iterator  begin() const noexcept { return const_iterator(p_head->next(0)); }
+    const_iterator cbegin() const noexcept { return const_iterator(p_head->next(0)); }
+
+    /**
+     */
+    iterator        end()       noexcept { return iterator(nullptr); }
+    const_iterator  end() const noexcept { return const_iterator(nullptr); }
+    const_iterator cend() const noexcept { return const_iterator(nullptr); }
+
+
+/* Capacity */
+public:
+    /**
+     * \brief Returns the number of elements.
+     *
+     * \note Not synchronized with concurrent writers.
+     */
+    size_type size() const noexcept { return m_size; }
+
+    /**
+     * \brief Checks whether the container is empty.
+     */
+    [[nodiscard]] bool empty() const noexcept { return p_head->next(0) == nullptr; }
+
+    /**
+     * \brief Frees the nodes kept for reuse by erasures.
+     */
+    void shrink_to_fit() noexcept {
+        for (size_type i = 0; i < MAX_LEVEL; ++i) {
+            while (m_free[i] != nullptr) {
+                node_pointer next = m_free[i]->pool_next;
+                delete_raw_node(m_free[i]);
+                m_free[i] = next;
+            }
+        }
+    }
+
+
+/* Modifiers */
+public:
+    /**
+     * \brief Erases all elements, their nodes are kept for reuse.
+     */
+    void clear() noexcept {
+        node_pointer curr = p_head->next(0);
+        for (size_type i = 0; i < MAX_LEVEL; ++i)
+            p_head->set_next(i, nullptr);
+        m_level.store(1, STORE_ORDER);
+        m_size = 0;
+
+        //
+        while (curr != nullptr) {
+            node_pointer next = curr->next(0);
+            release_node(curr);
+            curr = next;
+        }
+    }
+
+    /**
+     * \brief Inserts `value` if its key is not present yet.
+     *
+     * \return An iterator to the element with that key, and whether the
+     * insertion took place.
+     */
+    std::pair<iterator, bool> insert(const value_type& value) {
+        return try_emplace(value.first, value.second);
+    }
+
+    std::pair<iterator, bool> insert(value_type&& value) {
+        return emplace(std::move(value));
+    }
+
+    /**
+     * \brief Inserts the elements in [first, last) whose keys are not present yet.
+     */
+    template <std::input_iterator InputIt>
+    void insert(InputIt first, InputIt last) {
+        for (; first != last; ++first)
+            emplace(*first);
+    }
+
+    /**
+     * \brief Constructs an element from `args` and inserts it if its key is not
+     * present yet.
+     */
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(Args&&... args) {
+        node_pointer newNode = create_node(random_height(), std::forward<Args>(args)...);
+
+        //
+        node_pointer update[MAX_LEVEL];
+        node_pointer found = find_greater_or_equal(newNode->value.first, update);
+        if (found != nullptr && !m_comp(newNode->value.first, found->value.first)) {
+            destroy_node(newNode);   // never published, safe to reuse right away
+            return {iterator(found), false};
+        }
+
+        //
+        link_node(newNode, update);
+        return {iterator(newNode), true};
+    }
+
+    /**
+     * \brief Inserts an element with key `key` and value constructed from
+     * `args` if the key is not present yet; `args` are untouched otherwise.
+     */
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(const key_type& key, Args&&... args) {
+        return try_emplace_impl(key, std::forward<Args>(args)...);
+    }
+
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(key_type&& key, Args&&... args) {
+        return try_emplace_impl(std::move(key), std::forward<Args>(args)...);
+    }
+
+    /**
+     * \brief Inserts `value` under `key`, or assigns it if the key is present.
+     */
+    template <typename _M>
+    std::pair<iterator, bool> insert_or_assign(const key_type& key, _M&& value) {
+        auto result = try_emplace(key, std::forward<_M>(value));
+        if (!result.second)
+            result.first->second = std::forward<_M>(value);
+        return result;
+    }
+
+    /**
+     * \brief Removes the element with key `key`, if any.
+     *
+     * \return The number of elements removed (0 or 1).
+     */
+    size_type erase(const key_type& key) {
+        node_pointer update[MAX_LEVEL];
+        node_pointer found = find_greater_or_equal(key, update);
+        if (found == nullptr || m_comp(key, found->value.first))
+            return 0;
+
+        //
+        unlink_node(found, update);
+        return 1;
+    }
+
+    /**
+     * \brief Removes the element at `pos`.
+     *
+     * \return An iterator to the element after the removed one.
+     */
+    iterator erase(const_iterator pos) {
+        node_pointer curr = pos.get_node();
+        assert(curr != nullptr && "Attempting to erase an end iterator");
+        node_pointer next = curr->next(0);
+        erase(curr->value.first);
+        return iterator(next);
+    }
+
+    /**
+     * \brief Removes the elements in [first, last).
+     */
+    iterator erase(const_iterator first, const_iterator last) {
+        while (first != last)
+            first = erase(first);
+        return iterator(last.get_node());
+    }
+
+    /**
+     * \brief Destroys the elements erased since the last call; only meaningful
+     * with `_Concurrent`, where erasure defers that to here.
+     *
+     * \note Must not run while any reader may still hold a pointer, reference
+     * or iterator into the map.
+     */
+    void reclaim() noexcept {
+        while (p_retired != nullptr) {
+            node_pointer next = p_retired->pool_next;
+            destroy_node(p_retired);
+            p_retired = next;
+        }
+    }
+
+    /**
+     * \brief swaps the contents
+     */
+    void swap(skiplist_map& other) noexcept {
+        using std::swap;
+        swap(p_head, other.p_head);
+        size_type level = m_level.load(std::memory_order_relaxed);
+        m_level.store(other.m_level.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        other.m_level.store(level, std::memory_order_relaxed);
+        swap(m_size, other.m_size);
+        swap(m_comp, other.m_comp);
+        swap(m_probability, other.m_probability);
+        swap(m_threshold, other.m_threshold);
+        swap(m_rng, other.m_rng);
+        swap(m_free, other.m_free);
+        swap(p_retired, other.p_retired);
+    }
+
+
+/* Lookup */
+public:
+    /**
+     * \brief Returns the number of elements with key `key` (0 or 1).
+     */
+    size_type count(const key_type& key) const { return find_node(key) != nullptr ? 1 : 0; }
+
+    /**
+     * \brief Finds the element with key `key`, or `end()`.
+     */
+    iterator       find(const key_type& key)       { return iterator(find_node(key)); }
+    const_iterator find(const key_type& key) const { return const_iterator(find_node(key)); }
+
+    /**
+     * \brief Checks whether there is an element with key `key`.
+     */
+    bool contains(const key_type& key) const { return find_node(key) != nullptr; }
+
+    /**
+     * \brief Returns an iterator to the first element whose key is not less
+     * than `key`.
+     */
+    iterator       lower_bound(const key_type& key)       { return iterator(find_greater_or_equal(key, nullptr)); }
+    const_iterator lower_bound(const key_type& key) const { return const_iterator(find_greater_or_equal(key, nullptr)); }
+
+    /**
+     * \brief Returns an iterator to the first element whose key is greater
+     * than `key`.
+     */
+    iterator       upper_bound(const key_type& key)       { return iterator(find_greater(key)); }
+    const_iterator upper_bound(const key_type& key) const { return const_iterator(find_greater(key)); }
+
+    /**
+     * \brief Returns the range of elements with key `key`, as
+     * `[lower_bound(key), upper_bound(key))`.
+     */
+    std::pair<iterator, iterator> equal_range(const key_type& key) {
+        iterator first = lower_bound(key);
+        iterator last = first;
+        if (last != end() && !m_comp(key, last->first))
+            ++last;
+        return {first, last};
+    }
+
+    std::pair<const_iterator, const_iterator> equal_range(const key_type& key) const {
+        const_iterator first = lower_bound(key);
+        const_iterator last = first;
+        if (last != cend() && !m_comp(key, last->first))
+            ++last;
+        return {first, last};
+    }
+
+
+/* Observers */
+public:
+    /**
+     */
+    key_compare key_comp() const { return m_comp; }
+
+    /**
+     * \brief Returns the level probability the map was constructed with.
+     */
+    double probability() const noexcept { return m_probability; }
+
+
+private:
+    /**
+     * \brief Allocates a node with `height` null links and no value.
+     */
+    static node_pointer new_raw_node(size_type height) {
+        void* mem = ::operator new(sizeof(node) + height * sizeof(std::atomic<node_pointer>));
+        node_pointer ptr = ::new (mem) node;
+        ptr->height = height;
+        for (size_type i = 0; i < height; ++i)
+            ::new (static_cast<void*>(ptr->links() + i)) std::atomic<node_pointer>(nullptr);
+        return ptr;
+    }
+
+    /**
+     * \brief Frees a node whose value was already destroyed (or never built).
+     */
+    static void delete_raw_node(node_pointer ptr) noexcept {
+        ptr->~node();
+        ::operator delete(ptr);
+    }
+
+    /**
+     * \brief Builds a node of `height` holding a value constructed from
+     * `args`, reusing a pooled node of that height when there is one.
+     */
+    template <typename... Args>
+    node_pointer create_node(size_type height, Args&&... args) {
+        node_pointer ptr = m_free[height - 1];
+        if (ptr != nullptr) {
+            m_free[height - 1] = ptr->pool_next;
+            for (size_type i = 0; i < height; ++i)
+                ptr->links()[i].store(nullptr, std::memory_order_relaxed);
+        } else {
+            ptr = new_raw_node(height);
+        }
+
+        //
+        try {
+            std::construct_at(&ptr->value, std::forward<Args>(args)...);
+        }
+        catch (...) {
+            ptr->pool_next = m_free[height - 1];
+            m_free[height - 1] = ptr;
+            throw;
+        }
+        return ptr;
+    }
+
+    /**
+     * \brief Destroys the value of an unlinked node and pools the node.
+     */
+    void destroy_node(node_pointer ptr) noexcept {
+        std::destroy_at(&ptr->value);
+        ptr->pool_next = m_free[ptr->height - 1];
+        m_free[ptr->height - 1] = ptr;
+    }
+
+    /**
+     * \brief Disposes of an unlinked node: pooled right away, or with
+     * `_Concurrent` retired until `reclaim()` since readers may still see it.
+     */
+    void release_node(node_pointer ptr) noexcept {
+        if constexpr (_Concurrent) {
+            ptr->pool_next = p_retired;
+            p_retired = ptr;
+        } else {
+            destroy_node(ptr);
+        }
+    }
+
+    /**
+     * \brief Draws a height from the geometric distribution with parameter
+     * `m_probability`, using xorshift64*.
+     */
+    size_type random_height() noexcept {
+        size_type height = 1;
+        while (height < MAX_LEVEL) {
+            m_rng ^= m_rng >> 12;
+            m_rng ^= m_rng << 25;
+            m_rng ^= m_rng >> 27;
+            if (m_rng * 0x2545F4914F6CDD1Dull >= m_threshold)
+                break;
+            ++height;
+        }
+        return height;
+    }
+
+    /**
+     * \brief Returns the first node whose key is not less than `key`, or null.
+     *
+     * \param update: If not null, receives the last node before it on every
+     *        level below the current height.
+     */
+    node_pointer find_greater_or_equal(const key_type& key, node_pointer* update) const {
+        node_pointer curr = p_head;
+        node_pointer next = nullptr;
+        for (size_type level = m_level.load(LOAD_ORDER); level-- > 0;) {
+            next = curr->next(level);
+            while (next != nullptr && m_comp(next->value.first, key)) {
+                curr = next;
+                next = curr->next(level);
+            }
+            if (update != nullptr)
+                update[level] = curr;
+        }
+        return next;   // not reloaded, a concurrent insertion may have linked a smaller key since
+    }
+
+    /**
+     * \brief Returns the first node whose key is greater than `key`, or null.
+     */
+    node_pointer find_greater(const key_type& key) const {
+        node_pointer curr = p_head;
+        node_pointer next = nullptr;
+        for (size_type level = m_level.load(LOAD_ORDER); level-- > 0;) {
+            next = curr->next(level);
+            while (next != nullptr && !m_comp(key, next->value.first)) {
+                curr = next;
+                next = curr->next(level);
+            }
+        }
+        return next;
+    }
+
+    /**
+     * \brief Returns the node with key `key`, or null.
+     */
+    node_pointer find_node(const key_type& key) const {
+        node_pointer found = find_greater_or_equal(key, nullptr);
+        if (found != nullptr && !m_comp(key, found->value.first))
+            return found;
+        return nullptr;
+    }
+
+    /**
+     */
+    template <typename _K, typename... Args>
+    std::pair<iterator, bool> try_emplace_impl(_K&& key, Args&&... args) {
+        node_pointer update[MAX_LEVEL];
+        node_pointer found = find_greater_or_equal(key, update);
+        if (found != nullptr && !m_comp(key, found->value.first))
+            return {iterator(found), false};
+
+        //
+        node_pointer newNode = create_node(random_height(), std::piecewise_construct,
+                                           std::forward_as_tuple(std::forward<_K>(key)),
+                                           std::forward_as_tuple(std::forward<Args>(args)...));
+        link_node(newNode, update);
+        return {iterator(newNode), true};
+    }
+
+    /**
+     * \brief Links a new node after `update[i]` on each of its levels, bottom
+     * up, so that a concurrent reader sees it either fully in a level or not.
+     */
+    void link_node(node_pointer ptr, node_pointer* update) noexcept {
+        size_type level = m_level.load(std::memory_order_relaxed);
+        for (size_type i = level; i < ptr->height; ++i)
+            update[i] = p_head;
+
+        // set the node's own links before publishing it
+        for (size_type i = 0; i < ptr->height; ++i)
+            ptr->links()[i].store(update[i]->next(i), std::memory_order_relaxed);
+        for (size_type i = 0; i < ptr->height; ++i)
+            update[i]->set_next(i, ptr);
+
+        //
+        if (ptr->height > level)
+            m_level.store(ptr->height, STORE_ORDER);
+        ++m_size;
+    }
+
+    /**
+     * \brief Unlinks a node top down; its own links are left intact so that a
+     * concurrent reader standing on it can still move forward.
+     */
+    void unlink_node(node_pointer ptr, node_pointer* update) noexcept {
+        for (size_type i = ptr->height; i-- > 0;)
+            update[i]->set_next(i, ptr->next(i));
+
+        //
+        size_type level = m_level.load(std::memory_order_relaxed);
+        while (level > 1 && p_head->next(level - 1) == nullptr)
+            --level;
+        m_level.store(level, STORE_ORDER);
+        --m_size;
+
+        //
+        release_node(ptr);
+    }
+
+
+private:
+    node_pointer             p_head;             // sentinel with MAX_LEVEL links
+    std::atomic<size_type>   m_level;            // number of levels in use
+    size_type                m_size;
+    [[no_unique_address]] key_compare m_comp;
+    double                   m_probability;
+    std::uint64_t            m_threshold;        // `m_probability` scaled to 2^64
+    std::uint64_t            m_rng;
+    node_pointer             m_free[MAX_LEVEL];  // pooled nodes, indexed by height - 1
+    node_pointer             p_retired;          // erased nodes awaiting `reclaim()`
+};
+
+
+/**
+ * \brief Specializes the std::swap algorithm for mystl::skiplist_map.
+ */
+template <typename K, typename T, typename C, bool Concurrent>
+void swap(skiplist_map<K, T, C, Concurrent>& lhs, skiplist_map<K, T, C, Concurrent>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+
+} // namespace mystl::
+
+
+#endif // SKIPLIST_MAP_HPP_
@@ -103,6 +103,36 @@ public:
      */
     size_type size() const { return m_container.size(); }
 
+
+/* Memory */
+public:
+    /**
+     * \brief Returns the bytes the underlying container allocated on the heap.
+     */
+    size_type allocated_bytes() const noexcept
+        requires requires (const container_type& c) { c.allocated_bytes(); }
+    {
+        return m_container.allocated_bytes();
+    }
+
+    /**
+     * \brief Returns the bytes used by the stack, its own object and `allocated_bytes()`.
+     */
+    size_type memory_footprint() const noexcept
+        requires requires (const container_type& c) { c.allocated_bytes(); }
+    {
+        return sizeof(*this) + allocated_bytes();
+    }
+
+    /**
+     * \brief Returns the bytes of `memory_footprint()` not holding elements.
+     */
+    size_type overhead_bytes() const noexcept
+        requires requires (const container_type& c) { c.allocated_bytes(); }
+    {
+        return memory_footprint() - size() * sizeof(value_type);
+    }
+
 /* Modifiers */
 public:
     /**
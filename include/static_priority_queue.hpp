@@ -0,0 +1,216 @@
+/**
+ * \file static_priority_queue.hpp
+ */
+
+#pragma once
+
+#ifndef STATIC_PRIORITY_QUEUE_HPP_
+#define STATIC_PRIORITY_QUEUE_HPP_
+
+#include <cstddef>      // std::size_t
+#include <functional>   // std::less
+#include <utility>      // std::move, std::forward
+#include <iterator>     // std::input_iterator
+
+#include "inplace_vector.hpp"
+#include "algorithm/push_heap.hpp"
+#include "algorithm/pop_heap.hpp"
+#include "algorithm/make_heap.hpp"
+
+namespace mystl {
+
+/**
+ * \class static_priority_queue
+ *
+ * \brief A `priority_queue` of at most `_N` elements whose heap lives inside
+ * the object, in an `inplace_vector`, so it never allocates and can be used
+ * in constant expressions.
+ *
+ * Growing beyond `_N` throws `std::bad_alloc` like `inplace_vector`;
+ * `try_push` and `try_emplace` report a full queue by returning `false`
+ * instead.
+ *
+ * \tparam _T: Type of the elements.
+ * \tparam _N: Maximum number of elements.
+ * \tparam _Compare: Comparison functor type, defaults to `std::less<>` for max heap.
+ */
+template <class _T, std::size_t _N, class _Compare = std::less<_T> >
+class static_priority_queue {
+public:
+    using container_type  = mystl::inplace_vector<_T, _N>;
+    using value_compare   = _Compare;
+    using value_type      = typename container_type::value_type;
+    using size_type       = typename container_type::size_type;
+    using reference       = typename container_type::reference;
+    using const_reference = typename container_type::const_reference;
+
+/* Constructor */
+public:
+    /**
+     * \brief Construct an empty static_priority_queue.
+     */
+    constexpr static_priority_queue()
+        : m_container(), m_comp(value_compare()) {}
+
+
+    /**
+     * \brief Construct an empty static_priority_queue with a custom comparison functor.
+     */
+    constexpr explicit static_priority_queue(const value_compare& comp)
+        : m_container(), m_comp(comp) {}
+
+
+    /**
+     * \brief Constructs the static_priority_queue from a range and an optional
+     *        comparison functor.
+     *
+     * \throws std::bad_alloc if the range holds more than `_N` elements.
+     */
+    template <std::input_iterator InputIt>
+    constexpr static_priority_queue(InputIt first, InputIt last, const value_compare& comp = value_compare())
+        : m_container(first, last), m_comp(comp)
+    {
+        mystl::make_heap(m_container.begin(), m_container.end(), m_comp);
+    }
+
+
+/* Element access */
+public:
+    /**
+     * \brief Access the top element, the highest priority element.
+     */
+    constexpr const_reference top() const { return m_container.front(); }
+
+
+/* Capacity */
+public:
+    /**
+     * \brief Checks whether the static_priority_queue is empty.
+     */
+    constexpr bool empty() const noexcept { return m_container.empty(); }
+
+
+    /**
+     * \brief Checks whether the static_priority_queue holds `_N` elements.
+     */
+    constexpr bool full() const noexcept { return m_container.full(); }
+
+
+    /**
+     * \brief Returns the number of elements.
+     */
+    constexpr size_type size() const noexcept { return m_container.size(); }
+
+
+    /**
+     * \brief Returns the maximum number of elements, `_N`.
+     */
+    static constexpr size_type capacity() noexcept { return _N; }
+
+
+/* Modifiers */
+public:
+    /**
+     * \brief Inserts an element and reorders the static_priority_queue.
+     *
+     * \throws std::bad_alloc if the queue is full.
+     */
+    constexpr void push(const_reference value) {
+        m_container.push_back(value);
+        mystl::push_heap(m_container.begin(), m_container.end(), m_comp);
+    }
+
+
+    constexpr void push(value_type&& value) {
+        m_container.push_back(std::move(value));
+        mystl::push_heap(m_container.begin(), m_container.end(), m_comp);
+    }
+
+
+    /**
+     * \brief Constructs an element in-place and reorders the static_priority_queue.
+     *
+     * \throws std::bad_alloc if the queue is full.
+     */
+    template <typename... Args>
+    constexpr void emplace(Args&&... args) {
+        m_container.emplace_back(std::forward<Args>(args)...);
+        mystl::push_heap(m_container.begin(), m_container.end(), m_comp);
+    }
+
+
+    /**
+     * \brief Inserts an element if there is room left.
+     *
+     * \return Whether the element was inserted; `value` is left untouched if not.
+     */
+    constexpr bool try_push(const_reference value) {
+        return try_emplace(value);
+    }
+
+
+    constexpr bool try_push(value_type&& value) {
+        return try_emplace(std::move(value));
+    }
+
+
+    /**
+     * \brief Constructs an element in-place if there is room left.
+     *
+     * \return Whether the element was inserted.
+     */
+    template <typename... Args>
+    constexpr bool try_emplace(Args&&... args) {
+        if (m_container.try_emplace_back(std::forward<Args>(args)...) == nullptr)
+            return false;
+        mystl::push_heap(m_container.begin(), m_container.end(), m_comp);
+        return true;
+    }
+
+
+    /**
+     * \brief Removes the top element of the static_priority_queue.
+     */
+    constexpr void pop() {
+        mystl::pop_heap(m_container.begin(), m_container.end(), m_comp);
+        m_container.pop_back();
+    }
+
+
+    /**
+     * \brief Removes the top element and returns it by move.
+     */
+    constexpr value_type pop_value() {
+        mystl::pop_heap(m_container.begin(), m_container.end(), m_comp);
+        value_type value = std::move(m_container.back());
+        m_container.pop_back();
+        return value;
+    }
+
+
+    /**
+     * \brief Removes all elements.
+     */
+    constexpr void clear() noexcept { m_container.clear(); }
+
+
+    /**
+     * \brief Swaps this static_priority_queue with another one, elementwise.
+     */
+    constexpr void swap(static_priority_queue& other) {
+        m_container.swap(other.m_container);
+        std::swap(m_comp, other.m_comp);
+    }
+
+
+/**/
+private:
+    container_type m_container;
+    value_compare  m_comp;
+};
+
+
+} // namespace mystl::
+
+
+#endif // STATIC_PRIORITY_QUEUE_HPP_
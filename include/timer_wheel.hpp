@@ -0,0 +1,498 @@
+/**
+ * \file timer_wheel.hpp
+ *
+ * \reference:
+ * - G. Varghese, T. Lauck: Hashed and Hierarchical Timing Wheels: Data
+ *   Structures for the Efficient Implementation of a Timer Facility
+ */
+
+#pragma once
+
+#ifndef TIMER_WHEEL_HPP_
+#define TIMER_WHEEL_HPP_
+
+#include <bit>              // countr_zero
+#include <cstddef>          // size_t
+#include <cstdint>          // uint64_t
+#include <memory>           // construct_at, destroy_at
+#include <utility>          // move, forward
+
+
+namespace mystl {
+
+
+namespace __detail {
+
+
+/**
+ * \brief The links of a timer, kept in the timer itself so that a slot is an
+ * intrusive circular list and cancelling is a plain unlink.
+ */
+struct __timer_link {
+    __timer_link* prev;
+    __timer_link* next;
+
+    /**
+     */
+    void init() noexcept { prev = next = this; }
+
+    /**
+     */
+    bool empty() const noexcept { return next == this; }
+
+    /**
+     */
+    void push_back(__timer_link* node) noexcept {
+        node->prev = prev;
+        node->next = this;
+        prev->next = node;
+        prev = node;
+    }
+
+    /**
+     */
+    void unlink() noexcept {
+        prev->next = next;
+        next->prev = prev;
+        prev = next = this;
+    }
+
+    /**
+     * \brief Moves all nodes of `other` to `*this`, which must be empty.
+     */
+    void take(__timer_link& other) noexcept {
+        if (other.empty())
+            return;
+        next = other.next;
+        prev = other.prev;
+        next->prev = this;
+        prev->next = this;
+        other.init();
+    }
+};
+
+
+} // namespace mystl::__detail
+
+
+/**
+ * \class timer_wheel
+ *
+ * \brief Timers keyed by an integer tick, with O(1) schedule and cancel.
+ *
+ * Level `k` of the hierarchy has 64 slots of 64^k ticks each, so four levels
+ * cover 2^24 ticks ahead of `now()`; timers further out wait in an overflow
+ * list. A timer is filed under the highest level at which its expiry and the
+ * current tick differ, and is moved down one or more levels when the clock
+ * reaches its slot. Each timer therefore moves at most `_Levels` times over
+ * its lifetime, independent of how many timers are pending.
+ *
+ * Each timer sits in a node that carries its own list links, and `schedule`
+ * returns a handle to that node, so `cancel` unlinks it directly without any
+ * search. Freed nodes are pooled and reused by later timers.
+ *
+ * \tparam _T: Payload handed to the expiry callback.
+ * \tparam _Levels: Number of wheels in the hierarchy.
+ */
+template <typename _T, std::size_t _Levels = 4>
+class timer_wheel {
+    static_assert(_Levels >= 1 && _Levels * 6 < 64, "timer_wheel: unsupported number of levels");
+
+private:
+    struct node : __detail::__timer_link {
+        std::uint64_t expiry;
+        std::uint64_t generation;
+        std::uint8_t  level;        // wheel the node was last filed under, `_Levels` for the overflow
+        bool          pending;
+        union {
+            _T        data;         // alive while the timer is scheduled or firing, not while pooled
+        };
+
+        node() noexcept : __detail::__timer_link(), expiry(0), generation(0), level(0), pending(false) {}
+        ~node() {}
+    };
+
+public:
+    using value_type = _T;
+    using size_type  = std::size_t;
+    using tick_type  = std::uint64_t;
+
+    static constexpr size_type SLOT_BITS = 6;
+    static constexpr size_type SLOTS     = size_type(1) << SLOT_BITS;
+    static constexpr size_type LEVELS    = _Levels;
+
+
+    /**
+     * \brief Refers to one scheduled timer. Stays safe to pass to `cancel`
+     * after the timer expired or was cancelled, as long as the wheel lives.
+     */
+    class handle {
+        friend class timer_wheel;
+
+    public:
+        /**
+         */
+        constexpr handle() noexcept : p_node(nullptr), m_generation(0) {}
+
+    private:
+        handle(node* n, std::uint64_t generation) noexcept : p_node(n), m_generation(generation) {}
+
+    private:
+        node*         p_node;
+        std::uint64_t m_generation;
+    };
+
+
+/* Constructor and Destructor */
+public:
+    /**
+     * \brief Constructs an empty wheel whose clock starts at `start`.
+     */
+    explicit timer_wheel(tick_type start = 0) : m_now(start), m_size(0), p_free(nullptr) {
+        for (size_type level = 0; level < _Levels; ++level) {
+            m_occupied[level] = 0;
+            for (size_type slot = 0; slot < SLOTS; ++slot)
+                m_slots[level][slot].init();
+        }
+        m_overflow.init();
+    }
+
+    timer_wheel(const timer_wheel&) = delete;
+    timer_wheel& operator=(const timer_wheel&) = delete;
+
+    /**
+     * \brief Destroys all pending timers and the node pool.
+     */
+    ~timer_wheel() {
+        clear();
+        while (p_free) {
+            node* next = static_cast<node*>(p_free->next);
+            delete p_free;
+            p_free = next;
+        }
+    }
+
+
+/* Capacity */
+public:
+    /**
+     * \brief Returns the number of pending timers.
+     */
+    size_type size() const noexcept { return m_size; }
+
+    /**
+     */
+    [[nodiscard]] bool empty() const noexcept { return m_size == 0; }
+
+    /**
+     * \brief Returns the current tick; every timer due at or before it has fired.
+     */
+    tick_type now() const noexcept { return m_now; }
+
+
+/* Modifiers */
+public:
+    /**
+     * \brief Schedules a timer at the absolute tick `expiry`, constructing its
+     * payload from `args`.
+     *
+     * \note A timer due at or before `now()` fires on the next tick.
+     */
+    template <typename... Args>
+    handle schedule(tick_type expiry, Args&&... args) {
+        node* n = acquire(std::forward<Args>(args)...);
+        n->expiry = expiry > m_now ? expiry : m_now + 1;
+        n->pending = true;
+        place(n);
+        ++m_size;
+        return handle(n, n->generation);
+    }
+
+    /**
+     * \brief Schedules a timer `delay` ticks after `now()`.
+     */
+    template <typename... Args>
+    handle schedule_after(tick_type delay, Args&&... args) {
+        return schedule(m_now + delay, std::forward<Args>(args)...);
+    }
+
+    /**
+     * \brief Cancels the timer of `h` without firing it.
+     *
+     * \return Whether the timer was still pending.
+     */
+    bool cancel(handle h) noexcept {
+        node* n = h.p_node;
+        if (n == nullptr || n->generation != h.m_generation || !n->pending)
+            return false;
+
+        //
+        unlink(n);
+        --m_size;
+        release(n);
+        return true;
+    }
+
+    /**
+     * \brief Advances the clock to `target`, calling `fn(value_type&)` for
+     * every timer due at or before it, in expiry order across ticks.
+     *
+     * Ticks without due timers are skipped using the occupancy masks of all
+     * levels, so a wheel holding only far timers jumps straight to the
+     * cascade that brings them down. All timers of a tick are detached from
+     * their slot together and fired as one batch. `fn` may schedule new
+     * timers and cancel pending ones, including ones of the batch being fired.
+     *
+     * If `fn` throws, the timer it was called for counts as fired, the rest
+     * of its batch is put back and fires first on the next `advance`, and
+     * the exception propagates.
+     *
+     * \return The number of timers fired.
+     */
+    template <typename _Fn>
+    size_type advance(tick_type target, _Fn&& fn) {
+        size_type fired = 0;
+
+        // timers left due at `now()` by a throwing `fn` come first
+        size_type current = m_now & (SLOTS - 1);
+        if ((m_occupied[0] >> current) & 1)
+            fired += fire(current, fn);
+
+        //
+        while (m_now < target) {
+            if (m_size == 0) {
+                m_now = target;
+                break;
+            }
+
+            //
+            tick_type next = next_event();
+            if (next > target) {
+                m_now = target;
+                break;
+            }
+
+            //
+            m_now = next;
+            if ((m_now & (SLOTS - 1)) == 0)
+                cascade();
+            fired += fire(m_now & (SLOTS - 1), fn);
+        }
+        return fired;
+    }
+
+    /**
+     * \brief Cancels all pending timers.
+     */
+    void clear() noexcept {
+        for (size_type level = 0; level < _Levels; ++level) {
+            for (size_type slot = 0; slot < SLOTS; ++slot)
+                release_all(m_slots[level][slot]);
+            m_occupied[level] = 0;
+        }
+        release_all(m_overflow);
+        m_size = 0;
+    }
+
+
+private:
+    /**
+     * \brief Takes a node from the pool, or allocates one, and constructs its
+     * payload in place.
+     */
+    template <typename... Args>
+    node* acquire(Args&&... args) {
+        node* n = p_free;
+        if (n == nullptr)
+            n = new node();
+        else
+            p_free = static_cast<node*>(n->next);
+
+        //
+        try {
+            std::construct_at(&n->data, std::forward<Args>(args)...);
+        }
+        catch (...) {
+            // the payload is not alive, pool the node as it is
+            n->next = p_free;
+            p_free = n;
+            throw;
+        }
+        return n;
+    }
+
+    /**
+     * \brief Destroys the payload of `n` and returns the node to the pool;
+     * bumping its generation turns every handle to it stale.
+     */
+    void release(node* n) noexcept {
+        std::destroy_at(&n->data);
+        ++n->generation;
+        n->pending = false;
+        n->next = p_free;
+        p_free = n;
+    }
+
+    /**
+     */
+    void release_all(__detail::__timer_link& list) noexcept {
+        while (!list.empty()) {
+            node* n = static_cast<node*>(list.next);
+            n->unlink();
+            release(n);
+        }
+    }
+
+    /**
+     * \brief Files `n` under the highest level at which its expiry differs
+     * from the current tick.
+     */
+    void place(node* n) noexcept {
+        tick_type diff = n->expiry ^ m_now;
+        size_type level = 0;
+        while (level < _Levels && (diff >> (SLOT_BITS * (level + 1))) != 0)
+            ++level;
+
+        //
+        n->level = static_cast<std::uint8_t>(level);
+        if (level == _Levels) {
+            m_overflow.push_back(n);
+            return;
+        }
+        size_type slot = (n->expiry >> (SLOT_BITS * level)) & (SLOTS - 1);
+        m_slots[level][slot].push_back(n);
+        m_occupied[level] |= std::uint64_t(1) << slot;
+    }
+
+    /**
+     * \brief Unlinks a pending node, clearing its slot's occupancy bit when
+     * the slot becomes empty.
+     */
+    void unlink(node* n) noexcept {
+        __detail::__timer_link* prev = n->prev;
+        n->unlink();
+        if (!prev->empty() || n->level == _Levels)
+            return;
+
+        // `prev` is not the slot head if the node sat in a batch being fired
+        size_type slot = (n->expiry >> (SLOT_BITS * n->level)) & (SLOTS - 1);
+        if (prev == &m_slots[n->level][slot])
+            m_occupied[n->level] &= ~(std::uint64_t(1) << slot);
+    }
+
+    /**
+     * \brief Returns the next tick at which a level-0 slot holds timers or an
+     * occupied slot of a higher level is due to cascade.
+     *
+     * Every timer of level `k` lies in a slot after the current one of that
+     * level, within the current slot of level `k + 1`, so the lowest level
+     * with an occupied later slot has the earliest event; with none, only the
+     * overflow is left, which cascades at the next wrap of the top level.
+     */
+    tick_type next_event() const noexcept {
+        for (size_type level = 0; level < _Levels; ++level) {
+            size_type shift = SLOT_BITS * level;
+            size_type slot = (m_now >> shift) & (SLOTS - 1);
+            std::uint64_t later = slot + 1 < SLOTS ? m_occupied[level] & (~std::uint64_t(0) << (slot + 1)) : 0;
+            if (later != 0) {
+                tick_type block = m_now >> (shift + SLOT_BITS) << (shift + SLOT_BITS);
+                return block + (static_cast<tick_type>(std::countr_zero(later)) << shift);
+            }
+        }
+        return ((m_now >> (SLOT_BITS * _Levels)) + 1) << (SLOT_BITS * _Levels);
+    }
+
+    /**
+     * \brief At a level-0 wrap, redistributes the slot each higher level has
+     * just reached, highest level first so that timers can fall through
+     * several levels within the same tick.
+     */
+    void cascade() noexcept {
+        size_type top = 1;
+        while (top < _Levels && (m_now & ((tick_type(1) << (SLOT_BITS * (top + 1))) - 1)) == 0)
+            ++top;
+
+        //
+        if (top == _Levels)
+            redistribute(m_overflow);
+        for (size_type level = (top == _Levels ? _Levels - 1 : top); level >= 1; --level) {
+            size_type slot = (m_now >> (SLOT_BITS * level)) & (SLOTS - 1);
+            m_occupied[level] &= ~(std::uint64_t(1) << slot);
+            redistribute(m_slots[level][slot]);
+        }
+    }
+
+    /**
+     */
+    void redistribute(__detail::__timer_link& list) noexcept {
+        __detail::__timer_link batch;
+        batch.init();
+        batch.take(list);
+        while (!batch.empty()) {
+            node* n = static_cast<node*>(batch.next);
+            n->unlink();
+            place(n);
+        }
+    }
+
+    /**
+     * \brief Detaches the timers of a level-0 slot and fires them one by one.
+     */
+    template <typename _Fn>
+    size_type fire(size_type slot, _Fn& fn) {
+        __detail::__timer_link batch;
+        batch.init();
+        batch.take(m_slots[0][slot]);
+        m_occupied[0] &= ~(std::uint64_t(1) << slot);
+
+        //
+        size_type fired = 0;
+        while (!batch.empty()) {
+            node* n = static_cast<node*>(batch.next);
+            n->unlink();
+            n->pending = false;
+            --m_size;
+            try {
+                fn(n->data);
+            }
+            catch (...) {
+                // `batch` dies with this frame, the unfired rest goes back to the slot
+                release(n);
+                requeue(batch, slot);
+                throw;
+            }
+            release(n);
+            ++fired;
+        }
+        return fired;
+    }
+
+    /**
+     * \brief Moves the timers of `batch` back to the level-0 `slot`.
+     */
+    void requeue(__detail::__timer_link& batch, size_type slot) noexcept {
+        __detail::__timer_link& head = m_slots[0][slot];
+        while (!batch.empty()) {
+            node* n = static_cast<node*>(batch.next);
+            n->unlink();
+            head.push_back(n);
+        }
+        if (!head.empty())
+            m_occupied[0] |= std::uint64_t(1) << slot;
+    }
+
+
+private:
+    tick_type             m_now;
+    size_type             m_size;
+    std::uint64_t         m_occupied[_Levels];   // bit s set when slot s holds timers
+    __detail::__timer_link m_slots[_Levels][SLOTS];
+    __detail::__timer_link m_overflow;           // timers beyond the top level's span
+    node*                 p_free;                // pool of released nodes, linked by `next`
+};
+
+
+} // namespace mystl::
+
+
+#endif // TIMER_WHEEL_HPP_
@@ -0,0 +1,310 @@
+/**
+ * \file trace.hpp
+ *
+ * \brief Opt-in timeline events of the containers' expensive operations,
+ * dumped in the Chrome trace event format (chrome://tracing, Perfetto).
+ *
+ * Compiled in only when `MYSTL_TRACE` is defined to a non-zero value before
+ * any mystl header is included, e.g. with `-DMYSTL_TRACE=1`; it must then be
+ * the same in every translation unit of a program. Otherwise `scope` and
+ * `start()` do nothing, and the buffers and exporters are left out, along
+ * with the headers they need.
+ *
+ * Each thread appends to its own fixed-size buffer without locking. The
+ * buffer is allocated and registered by `start()`, which a thread calls
+ * before the operations it wants traced, so that recording never allocates
+ * inside them; the scopes of a thread that has not called `start()` are not
+ * recorded. A scope that would not fit, together with the end events of the
+ * scopes still open, is dropped whole, so the recorded begin and end events
+ * always pair up.
+ */
+
+#pragma once
+
+#ifndef TRACE_HPP_
+#define TRACE_HPP_
+
+#ifndef MYSTL_TRACE
+#define MYSTL_TRACE 0
+#endif
+
+#include <cstddef>      // size_t
+#include <cstdint>      // uint64_t
+
+#if MYSTL_TRACE
+#include <atomic>       // atomic
+#include <chrono>       // steady_clock
+#include <cstdio>       // FILE, fopen, fwrite
+#include <memory>       // unique_ptr
+#include <mutex>        // mutex, lock_guard
+#include <string>       // string, to_string
+#include <type_traits>  // is_constant_evaluated
+#include <vector>       // vector
+#endif
+
+
+namespace mystl::trace {
+
+
+/**
+ * \brief Whether the tracing is compiled in.
+ */
+inline constexpr bool enabled = MYSTL_TRACE != 0;
+
+
+/**
+ * \brief Number of events one thread can hold until the next `clear()`.
+ */
+inline constexpr std::size_t buffer_events = std::size_t(1) << 16;
+
+
+#if MYSTL_TRACE
+
+
+/**
+ * \brief A recorded begin ('B') or end ('E') event.
+ */
+struct event {
+    const char*   name;     // a string literal, not copied
+    std::uint64_t ts_ns;    // steady clock
+    std::uint64_t size;
+    char          phase;
+};
+
+
+namespace __detail {
+
+
+/**
+ * \brief The events of one thread. Only the owning thread appends; `size` is
+ * published with release order so readers see complete events.
+ */
+struct __thread_buffer {
+    std::unique_ptr<event[]>  events = std::make_unique<event[]>(buffer_events);
+    std::atomic<std::size_t>  size{0};
+    std::size_t               open = 0;       // begun and not yet ended scopes
+    std::atomic<std::size_t>  dropped{0};
+    std::size_t               tid = 0;
+};
+
+
+/**
+ * \brief All thread buffers, kept until the end of the program so that the
+ * events of finished threads can still be dumped.
+ */
+struct __registry {
+    std::mutex                                     mutex;
+    std::vector<std::unique_ptr<__thread_buffer>>  buffers;
+};
+
+inline __registry& __the_registry() {
+    static __registry registry;
+    return registry;
+}
+
+
+/**
+ * \brief The calling thread's buffer, null until it called `start()`.
+ */
+inline thread_local __thread_buffer* __local_buffer = nullptr;
+
+
+/**
+ */
+inline std::uint64_t __now_ns() noexcept {
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+
+/**
+ * \brief Records the begin event of a scope; returns false if it was dropped.
+ */
+inline bool __begin(const char* name, std::uint64_t size) noexcept {
+    if (__local_buffer == nullptr)
+        return false;
+
+    //
+    __thread_buffer& buffer = *__local_buffer;
+    std::size_t n = buffer.size.load(std::memory_order_relaxed);
+
+    // room for this scope's two events and the end events of the open ones
+    if (n + buffer.open + 2 > buffer_events) {
+        buffer.dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    buffer.events[n] = event{name, __now_ns(), size, 'B'};
+    buffer.size.store(n + 1, std::memory_order_release);
+    ++buffer.open;
+    return true;
+}
+
+
+/**
+ */
+inline void __end(const char* name, std::uint64_t size) noexcept {
+    __thread_buffer& buffer = *__local_buffer;
+    std::size_t n = buffer.size.load(std::memory_order_relaxed);
+    buffer.events[n] = event{name, __now_ns(), size, 'E'};
+    buffer.size.store(n + 1, std::memory_order_release);
+    --buffer.open;
+}
+
+
+} // namespace mystl::trace::__detail
+
+
+#endif // MYSTL_TRACE
+
+
+/**
+ * \brief Records a begin event on construction and the matching end event on
+ * destruction. Does nothing when disabled or during constant evaluation.
+ */
+class scope {
+public:
+    constexpr scope(const char* name, std::uint64_t size) noexcept
+        : m_name(name), m_size(size)
+    {
+#if MYSTL_TRACE
+        if (!std::is_constant_evaluated())
+            m_active = __detail::__begin(name, size);
+#endif
+    }
+
+    constexpr ~scope() {
+#if MYSTL_TRACE
+        if (m_active)
+            __detail::__end(m_name, m_size);
+#endif
+    }
+
+    scope(const scope&) = delete;
+    scope& operator=(const scope&) = delete;
+
+private:
+    const char*   m_name;
+    std::uint64_t m_size;
+    bool          m_active = false;
+};
+
+
+/**
+ * \brief Allocates and registers the calling thread's buffer, after which its
+ * scopes are recorded. Further calls on the same thread do nothing.
+ *
+ * \note Does nothing when disabled.
+ */
+inline void start() {
+#if MYSTL_TRACE
+    if (__detail::__local_buffer != nullptr)
+        return;
+
+    //
+    __detail::__registry& registry = __detail::__the_registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.buffers.push_back(std::make_unique<__detail::__thread_buffer>());
+    registry.buffers.back()->tid = registry.buffers.size();
+    __detail::__local_buffer = registry.buffers.back().get();
+#endif
+}
+
+
+#if MYSTL_TRACE
+
+
+/**
+ * \brief Number of scopes dropped because a buffer was full, over all threads.
+ */
+inline std::size_t dropped() {
+    __detail::__registry& registry = __detail::__the_registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    std::size_t total = 0;
+    for (const auto& buffer : registry.buffers)
+        total += buffer->dropped.load(std::memory_order_relaxed);
+    return total;
+}
+
+
+/**
+ * \brief Discards the recorded events of all threads.
+ *
+ * \note No thread may be inside a traced operation meanwhile.
+ */
+inline void clear() {
+    __detail::__registry& registry = __detail::__the_registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    for (const auto& buffer : registry.buffers) {
+        buffer->size.store(0, std::memory_order_relaxed);
+        buffer->dropped.store(0, std::memory_order_relaxed);
+    }
+}
+
+
+/**
+ * \brief Returns the events recorded so far by all threads as a Chrome trace
+ * JSON document, with timestamps in microseconds and the size as argument.
+ *
+ * Safe to call while other threads are recording; their scopes still open
+ * show up without an end event.
+ */
+inline std::string to_chrome_json() {
+    __detail::__registry& registry = __detail::__the_registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    //
+    std::string out = "{\"traceEvents\":[";
+    bool first = true;
+    for (const auto& buffer : registry.buffers) {
+        std::size_t n = buffer->size.load(std::memory_order_acquire);
+        for (std::size_t i = 0; i < n; ++i) {
+            const event& e = buffer->events[i];
+            if (!first)
+                out += ',';
+            first = false;
+
+            //
+            out += "\n{\"name\":\"";
+            out += e.name;
+            out += "\",\"cat\":\"mystl\",\"ph\":\"";
+            out += e.phase;
+            out += "\",\"ts\":";
+            out += std::to_string(e.ts_ns / 1000);
+            out += '.';
+            std::string frac = std::to_string(e.ts_ns % 1000);
+            out.append(3 - frac.size(), '0');
+            out += frac;
+            out += ",\"pid\":1,\"tid\":";
+            out += std::to_string(buffer->tid);
+            out += ",\"args\":{\"size\":";
+            out += std::to_string(e.size);
+            out += "}}";
+        }
+    }
+    out += "\n]}\n";
+    return out;
+}
+
+
+/**
+ * \brief Writes `to_chrome_json()` to the file at `path`.
+ *
+ * \return Whether the file was written.
+ */
+inline bool write_chrome_json(const char* path) {
+    std::string json = to_chrome_json();
+    std::FILE* file = std::fopen(path, "w");
+    if (file == nullptr)
+        return false;
+    bool ok = std::fwrite(json.data(), 1, json.size(), file) == json.size();
+    return std::fclose(file) == 0 && ok;
+}
+
+
+#endif // MYSTL_TRACE
+
+
+} // namespace mystl::trace::
+
+
+#endif // TRACE_HPP_
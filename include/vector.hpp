@@ -21,6 +21,12 @@
 #include <stdexcept>        // out_of_range
 #include <iterator>         // random_access_iterator_tag, distance
 #include <memory>           // allocator
+#include <new>              // placement new
+#include <cstring>          // memcpy
+#include <type_traits>      // is_trivially_copyable_v
+
+#include "instrument.hpp"   // instrument::add
+#include "trace.hpp"        // trace::scope
 
 
 namespace mystl {
@@ -183,14 +189,23 @@ public:
 
     /**
      * \brief Copy constructor
+     *
+     * Allocates exactly `other.size()` elements, the spare capacity of `other`
+     * is not copied.
      */
-    vector(const vector<value_type>& other)
-        : m_alloc(other.m_alloc), m_size(other.m_size), m_capacity(other.m_capacity), p_elem(nullptr)
+    vector(const vector& other)
+        : m_alloc(other.m_alloc), m_size(0), m_capacity(other.m_size), p_elem(nullptr)
     {
-        if (other.p_elem != nullptr) {
+        if (m_capacity != 0) {
             p_elem = std::allocator_traits<allocator_type>::allocate(m_alloc, m_capacity);
-            for (size_type i = 0; i < m_size; ++i)
-                std::allocator_traits<allocator_type>::construct(m_alloc, p_elem + i, other.p_elem[i]);
+            try {
+                copy_construct_from(other);
+            }
+            catch (...) {
+                // the destructor will not run, release what was built so far
+                destroy_vector();
+                throw;
+            }
         }
     }
 
@@ -198,7 +213,7 @@ public:
     /**
      * \brief Move constructor
      */
-    vector(vector<value_type>&& other) noexcept
+    vector(vector&& other) noexcept
         : m_alloc(other.m_alloc), m_size(other.m_size), m_capacity(other.m_capacity), p_elem(other.p_elem)
     {
         other.m_size = 0;
@@ -253,11 +268,11 @@ public:
             m_alloc = other.m_alloc;
 
             // 
-            if (m_capacity < other.m_capacity) {
-                // old capaacity is not enough
+            if (m_capacity < other.m_size) {
+                // old capaacity is not enough, allocate exactly what is needed
                 clear();
                 destroy_vector();
-                m_capacity = other.m_capacity;
+                m_capacity = other.m_size;
                 p_elem = std::allocator_traits<allocator_type>::allocate(m_alloc, m_capacity);
             }
             else {
@@ -266,9 +281,7 @@ public:
             }
 
             // 
-            m_size = other.m_size;
-            for (size_type i = 0; i < other.m_size; ++i) 
-                std::allocator_traits<allocator_type>::construct(m_alloc, p_elem + i, other.p_elem[i]);
+            copy_construct_from(other);
         }
         return *this;
     }
@@ -425,6 +438,26 @@ public:
     }
 
 
+/* Memory */
+public:
+    /**
+     * \brief Returns the bytes allocated on the heap, the unused capacity included.
+     */
+    size_type allocated_bytes() const noexcept { return m_capacity * sizeof(value_type); }
+
+    /**
+     * \brief Returns the bytes used by the vector, its own object and `allocated_bytes()`.
+     *
+     * \note The allocator's own bookkeeping of each block is not included.
+     */
+    size_type memory_footprint() const noexcept { return sizeof(*this) + allocated_bytes(); }
+
+    /**
+     * \brief Returns the bytes of `memory_footprint()` not holding elements.
+     */
+    size_type overhead_bytes() const noexcept { return memory_footprint() - m_size * sizeof(value_type); }
+
+
 /* Modifiers */
 public:
     /**
@@ -450,12 +483,13 @@ public:
      */
     iterator erase(const_iterator pos) {
         // 
-        if (pos < cbegin() || pos > cbegin())
+        if (pos < cbegin() || pos >= cend())
             throw std::out_of_range("vector::erase() - Iterator out of range");
 
         // Convert const_iterator to iterator
         difference_type dist = std::distance(cbegin(), pos);
         iterator nonConstPos = begin() + dist;
+        instrument::add(instrument::event::vector_shifted, m_size - dist - 1);
 
         // Move elements
         iterator it;
@@ -467,8 +501,8 @@ public:
         std::allocator_traits<allocator_type>::destroy(m_alloc, it.base());
         m_size--;
 
-        // 
-        return it;
+        // the element that followed the erased one now sits at `pos`
+        return nonConstPos;
     }
 
 
@@ -495,6 +529,7 @@ public:
             return nonConstLast;
 
         // Move elements
+        instrument::add(instrument::event::vector_shifted, m_size - dist2last);
         iterator itLeft = nonConstFirst, itRight = nonConstLast;
         while (itRight != end()) {
             *itLeft = std::move(*itRight);
@@ -534,6 +569,7 @@ public:
             realloc(m_capacity == 0 ? 1 : REALLOC_RATE * m_capacity);
 
         // shift elements after pos
+        instrument::add(instrument::event::vector_shifted, m_size - tarIndex);
         for (size_type i = m_size; i > tarIndex; --i) {
             std::allocator_traits<allocator_type>::construct(m_alloc, p_elem + i, std::move(p_elem[i-1]));
             std::allocator_traits<allocator_type>::destroy(m_alloc, p_elem + i - 1);
@@ -602,8 +638,8 @@ public:
      */
     void pop_back() {
         if (m_size > 0) {
-            std::allocator_traits<allocator_type>::destroy(m_alloc, p_elem + m_size);
             --m_size;
+            std::allocator_traits<allocator_type>::destroy(m_alloc, p_elem + m_size);
         }
         else {
             throw std::length_error("vector::pop_back(): the vector is empty");
@@ -636,6 +672,70 @@ public:
     }
 
 
+    /**
+     * \brief Changes the number of elements stored, default-initializing the
+     * new elements.
+     *
+     * Unlike `resize`, trivial types such as `char` are left uninitialized, so
+     * growing a buffer that is about to be overwritten (e.g. by `read()`)
+     * costs no memory writes.
+     *
+     * \param count: new size of the container
+     */
+    void resize_for_overwrite(size_type count) {
+        //
+        if (m_size > count) {
+            erase(cbegin() + count, cend());
+            return;
+        }
+
+        //
+        if (count > m_capacity)
+            reserve(count);
+        size_type i = m_size;
+        try {
+            for (; i < count; ++i)
+                ::new (static_cast<void*>(p_elem + i)) value_type;
+        }
+        catch (...) {
+            // the new elements are not counted in `m_size` yet, destroy them here
+            while (i-- > m_size)
+                std::allocator_traits<allocator_type>::destroy(m_alloc, p_elem + i);
+            throw;
+        }
+        m_size = count;
+    }
+
+
+    /**
+     * \brief Resizes to at most `count` elements, letting `op` write them in place.
+     *
+     * Grows the container to `count` default-initialized elements (see
+     * `resize_for_overwrite`), then calls `op(data(), count)`, which writes the
+     * contents and returns how many of the `count` elements to keep.
+     *
+     * \param count: maximum new size of the container
+     * \param op: callable as `size_type op(pointer, size_type)`
+     *
+     * \throws std::length_error if `op` returns a size greater than `count`.
+     */
+    template <typename Operation>
+    void resize_and_overwrite(size_type count, Operation op) {
+        //
+        if (count > m_size)
+            resize_for_overwrite(count);
+
+        //
+        size_type newSize = std::move(op)(p_elem, count);
+        if (newSize > count)
+            throw std::length_error("vector::resize_and_overwrite(): operation returned a size greater than count");
+
+        //
+        if (newSize < m_size)
+            erase(cbegin() + newSize, cend());
+    }
+
+
     /**
      * \brief swaps the contents
      *
@@ -648,12 +748,43 @@ public:
     }
 
 private:
+    /**
+     * \brief Whether elements can be copied as raw bytes.
+     *
+     * Only with the default allocator, a custom allocator may rely on its
+     * `construct` being called.
+     */
+    static constexpr bool BITWISE_COPYABLE = std::is_trivially_copyable_v<value_type>
+                                          && std::is_same_v<allocator_type, std::allocator<value_type>>;
+
+
+    /**
+     * \brief Copy-constructs the elements of `other` into the (empty) storage.
+     *
+     * \note The capacity must be at least `other.size()`.
+     */
+    void copy_construct_from(const vector& other) {
+        if constexpr (BITWISE_COPYABLE) {
+            if (other.m_size != 0)
+                std::memcpy(p_elem, other.p_elem, other.m_size * sizeof(value_type));
+            m_size = other.m_size;
+        }
+        else {
+            for (; m_size < other.m_size; ++m_size)
+                std::allocator_traits<allocator_type>::construct(m_alloc, p_elem + m_size, other.p_elem[m_size]);
+        }
+    }
+
+
     /**
      * \brief Reallocates the storage of the vector
      *
      * \param newCapacity
      */
     void realloc(size_type newCapacity) {
+        instrument::add(instrument::event::vector_reallocs);
+        trace::scope span("vector::realloc", newCapacity);
+
         // allocate a new block of memory
         pointer newBlock = std::allocator_traits<allocator_type>::allocate(m_alloc, newCapacity);
 
@@ -661,10 +792,9 @@ private:
         size_type elemNum = newCapacity > m_size ? m_size : newCapacity;
         for (size_type i = 0; i < elemNum; ++i) {
             std::allocator_traits<allocator_type>::construct(m_alloc, newBlock + i, std::move(p_elem[i]));
-            std::allocator_traits<allocator_type>::destroy(m_alloc, p_elem + i);
         }
 
-        // 
+        // destroys every old element exactly once, including the moved-from ones
         destroy_vector();
         p_elem = newBlock;
         m_size = elemNum;
@@ -675,8 +805,8 @@ private:
     /**
      * \brief Deallocate all memory allocated in vector.
      *
-     * Deallocate the memory block allocated for the vector's storage without
-     * calling the contained elements' destructors.
+     * Destroys the contained elements through `clear()`, then deallocates the
+     * memory block allocated for the vector's storage.
      */
     void destroy_vector() {
         clear();
@@ -0,0 +1,709 @@
+/**
+ * \file views.hpp
+ *
+ * \brief Lazy, composable views over mystl containers and iterator pairs.
+ *
+ * A view never owns or copies the elements it refers to, adapting a range
+ * only changes how its iterators walk the underlying elements. Adaptors can
+ * be called directly (`views::filter(vec, pred)`) or chained with `|`:
+ *
+ *     for (int x : vec | views::filter(is_even) | views::transform(square))
+ *         ...
+ *
+ * Containers are referenced, so they must outlive the views built on them.
+ *
+ * \ref cppreference.com (Ranges library)
+ */
+
+#pragma once
+
+#ifndef VIEWS_HPP_
+#define VIEWS_HPP_
+
+#include <cstddef>      // size_t, ptrdiff_t
+#include <iterator>     // default_sentinel_t, forward_iterator_tag, iter_value_t
+#include <stdexcept>    // invalid_argument
+#include <tuple>        // tuple, apply
+#include <type_traits>  // is_base_of_v, remove_cvref_t, invoke_result_t
+#include <utility>      // pair, move, forward, declval, index_sequence
+
+
+namespace mystl {
+
+
+/**
+ * \brief Tag base class of every view, used by `views::all` to tell views
+ * (copied by value) apart from containers (referenced).
+ */
+struct view_base {};
+
+
+namespace __detail {
+
+
+/**
+ * \brief Returns `r.begin()`, or `r.cbegin()` for the const mystl containers
+ * which only provide the latter.
+ */
+template <typename _Range>
+constexpr auto __begin(_Range& r) {
+    if constexpr (requires { r.begin(); })
+        return r.begin();
+    else
+        return r.cbegin();
+}
+
+/**
+ * \brief Returns `r.end()`, or `r.cend()` for the const mystl containers
+ * which only provide the latter.
+ */
+template <typename _Range>
+constexpr auto __end(_Range& r) {
+    if constexpr (requires { r.end(); })
+        return r.end();
+    else
+        return r.cend();
+}
+
+template <typename _Range>
+using iterator_t = decltype(__begin(std::declval<_Range&>()));
+
+template <typename _Range>
+using sentinel_t = decltype(__end(std::declval<_Range&>()));
+
+template <typename _Range>
+using range_reference_t = std::iter_reference_t<iterator_t<_Range>>;
+
+template <typename _Range>
+using range_value_t = std::iter_value_t<iterator_t<_Range>>;
+
+
+/**
+ * \brief Tag base class of the objects that can appear on the right-hand side of `|`.
+ */
+struct __adaptor_closure {};
+
+/**
+ * \brief Adaptor closure holding the trailing arguments of an adaptor call,
+ * e.g. the predicate of `views::filter(pred)`.
+ */
+template <typename _Fn>
+struct __partial : __adaptor_closure {
+    _Fn fn;
+
+    constexpr explicit __partial(_Fn f) : fn(std::move(f)) {}
+
+    template <typename _Range>
+    constexpr auto operator()(_Range&& r) const { return fn(std::forward<_Range>(r)); }
+};
+
+/**
+ * \brief Applies the adaptor closure `closure` to the range `r`.
+ */
+template <typename _Range, typename _Closure>
+    requires std::is_base_of_v<__adaptor_closure, std::remove_cvref_t<_Closure>>
+constexpr auto operator|(_Range&& r, const _Closure& closure) {
+    return closure(std::forward<_Range>(r));
+}
+
+
+} // namespace __detail
+
+
+/**
+ * \class subrange
+ *
+ * \brief A view over an iterator-sentinel pair.
+ */
+template <typename _Iter, typename _Sent = _Iter>
+class subrange : public view_base {
+public:
+    subrange() = default;
+    constexpr subrange(_Iter first, _Sent last) : m_first(first), m_last(last) {}
+
+    constexpr _Iter begin() const { return m_first; }
+    constexpr _Sent end()   const { return m_last; }
+
+    constexpr bool empty() const { return m_first == m_last; }
+
+private:
+    _Iter m_first{};
+    _Sent m_last{};
+};
+
+
+/**
+ * \class ref_view
+ *
+ * \brief A view referring to all elements of a container.
+ */
+template <typename _Container>
+class ref_view : public view_base {
+public:
+    constexpr explicit ref_view(_Container& c) : p_container(&c) {}
+
+    constexpr auto begin() const { return __detail::__begin(*p_container); }
+    constexpr auto end()   const { return __detail::__end(*p_container); }
+
+    constexpr bool empty() const { return begin() == end(); }
+
+private:
+    _Container* p_container;
+};
+
+
+/**
+ * \class filter_view
+ *
+ * \brief A view of the elements of `_View` that satisfy the predicate.
+ */
+template <typename _View, typename _Pred>
+class filter_view : public view_base {
+private:
+    using base_iterator = __detail::iterator_t<const _View>;
+    using base_sentinel = __detail::sentinel_t<const _View>;
+
+public:
+    class iterator {
+    public:
+        using value_type        = std::iter_value_t<base_iterator>;
+        using reference         = std::iter_reference_t<base_iterator>;
+        using difference_type   = std::ptrdiff_t;
+        using iterator_concept  = std::forward_iterator_tag;
+        using iterator_category = std::forward_iterator_tag;
+
+    public:
+        iterator() = default;
+        iterator(base_iterator it, base_sentinel end, const _Pred* pred)
+            : m_it(it), m_end(end), p_pred(pred)
+        {
+            satisfy();
+        }
+
+    public:
+        reference operator*() const { return *m_it; }
+
+        iterator& operator++()    { ++m_it; satisfy(); return *this; }
+        iterator  operator++(int) { iterator old = *this; ++(*this); return old; }
+
+        bool operator==(const iterator& other) const { return m_it == other.m_it; }
+        bool operator==(std::default_sentinel_t) const { return m_it == m_end; }
+
+        base_iterator base() const { return m_it; }
+
+    private:
+        /**
+         * \brief Skips forward to the first element satisfying the predicate.
+         */
+        void satisfy() {
+            while (m_it != m_end && !(*p_pred)(*m_it))
+                ++m_it;
+        }
+
+    private:
+        base_iterator m_it{};
+        base_sentinel m_end{};
+        const _Pred*  p_pred = nullptr;
+    };
+
+public:
+    constexpr filter_view(_View base, _Pred pred) : m_base(std::move(base)), m_pred(std::move(pred)) {}
+
+    /**
+     * \note The first matching element is searched on every call, which is O(n).
+     */
+    iterator begin() const { return iterator(__detail::__begin(m_base), __detail::__end(m_base), &m_pred); }
+    std::default_sentinel_t end() const { return std::default_sentinel; }
+
+private:
+    _View m_base;
+    _Pred m_pred;
+};
+
+
+/**
+ * \class transform_view
+ *
+ * \brief A view applying a function to each element of `_View`.
+ */
+template <typename _View, typename _Fn>
+class transform_view : public view_base {
+private:
+    using base_iterator = __detail::iterator_t<const _View>;
+    using base_sentinel = __detail::sentinel_t<const _View>;
+
+public:
+    class iterator {
+    public:
+        using reference         = std::invoke_result_t<const _Fn&, std::iter_reference_t<base_iterator>>;
+        using value_type        = std::remove_cvref_t<reference>;
+        using difference_type   = std::ptrdiff_t;
+        using iterator_concept  = std::forward_iterator_tag;
+        using iterator_category = std::input_iterator_tag;
+
+    public:
+        iterator() = default;
+        iterator(base_iterator it, base_sentinel end, const _Fn* fn)
+            : m_it(it), m_end(end), p_fn(fn) {}
+
+    public:
+        reference operator*() const { return (*p_fn)(*m_it); }
+
+        iterator& operator++()    { ++m_it; return *this; }
+        iterator  operator++(int) { iterator old = *this; ++m_it; return old; }
+
+        bool operator==(const iterator& other) const { return m_it == other.m_it; }
+        bool operator==(std::default_sentinel_t) const { return m_it == m_end; }
+
+        base_iterator base() const { return m_it; }
+
+    private:
+        base_iterator m_it{};
+        base_sentinel m_end{};
+        const _Fn*    p_fn = nullptr;
+    };
+
+public:
+    constexpr transform_view(_View base, _Fn fn) : m_base(std::move(base)), m_fn(std::move(fn)) {}
+
+    iterator begin() const { return iterator(__detail::__begin(m_base), __detail::__end(m_base), &m_fn); }
+    std::default_sentinel_t end() const { return std::default_sentinel; }
+
+private:
+    _View m_base;
+    _Fn   m_fn;
+};
+
+
+/**
+ * \class take_view
+ *
+ * \brief A view of the first `count` elements of `_View` (or all of them if
+ * there are fewer).
+ */
+template <typename _View>
+class take_view : public view_base {
+private:
+    using base_iterator = __detail::iterator_t<const _View>;
+    using base_sentinel = __detail::sentinel_t<const _View>;
+
+public:
+    class iterator {
+    public:
+        using value_type        = std::iter_value_t<base_iterator>;
+        using reference         = std::iter_reference_t<base_iterator>;
+        using difference_type   = std::ptrdiff_t;
+        using iterator_concept  = std::forward_iterator_tag;
+        using iterator_category = std::forward_iterator_tag;
+
+    public:
+        iterator() = default;
+        iterator(base_iterator it, base_sentinel end, difference_type count)
+            : m_it(it), m_end(end), m_count(count) {}
+
+    public:
+        reference operator*() const { return *m_it; }
+
+        iterator& operator++()    { ++m_it; --m_count; return *this; }
+        iterator  operator++(int) { iterator old = *this; ++(*this); return old; }
+
+        bool operator==(const iterator& other) const { return m_it == other.m_it; }
+        bool operator==(std::default_sentinel_t) const { return m_count <= 0 || m_it == m_end; }
+
+        base_iterator base() const { return m_it; }
+
+    private:
+        base_iterator   m_it{};
+        base_sentinel   m_end{};
+        difference_type m_count = 0;
+    };
+
+public:
+    constexpr take_view(_View base, std::ptrdiff_t count) : m_base(std::move(base)), m_count(count) {}
+
+    iterator begin() const { return iterator(__detail::__begin(m_base), __detail::__end(m_base), m_count); }
+    std::default_sentinel_t end() const { return std::default_sentinel; }
+
+private:
+    _View          m_base;
+    std::ptrdiff_t m_count;
+};
+
+
+/**
+ * \class drop_view
+ *
+ * \brief A view of the elements of `_View` after skipping the first `count`.
+ *
+ * \note Iterates with the iterators of `_View` directly. Random access bases
+ * are advanced in O(1), others in O(count) on each `begin()`.
+ */
+template <typename _View>
+class drop_view : public view_base {
+private:
+    using base_iterator = __detail::iterator_t<const _View>;
+    using base_sentinel = __detail::sentinel_t<const _View>;
+
+public:
+    constexpr drop_view(_View base, std::ptrdiff_t count) : m_base(std::move(base)), m_count(count) {}
+
+    base_iterator begin() const {
+        base_iterator it = __detail::__begin(m_base);
+        base_sentinel last = __detail::__end(m_base);
+
+        if constexpr (std::random_access_iterator<base_iterator> && std::sized_sentinel_for<base_sentinel, base_iterator>) {
+            std::ptrdiff_t len = last - it;
+            return it + (m_count < len ? m_count : len);
+        }
+        else {
+            for (std::ptrdiff_t i = 0; i < m_count && it != last; ++i)
+                ++it;
+            return it;
+        }
+    }
+
+    base_sentinel end() const { return __detail::__end(m_base); }
+
+private:
+    _View          m_base;
+    std::ptrdiff_t m_count;
+};
+
+
+namespace __detail {
+
+
+/**
+ * \brief Returns `size` if it is a valid chunk size.
+ *
+ * \throws std::invalid_argument if `size <= 0`.
+ */
+constexpr std::ptrdiff_t __check_chunk_size(std::ptrdiff_t size) {
+    if (size <= 0)
+        throw std::invalid_argument("views::chunk: the chunk size must be positive");
+    return size;
+}
+
+
+} // namespace __detail
+
+
+/**
+ * \class chunk_view
+ *
+ * \brief A view of consecutive, non-overlapping chunks of `size` elements of
+ * `_View`. The last chunk may be shorter.
+ *
+ * Each chunk is itself a view (`take_view` over the remaining elements), so no
+ * element is ever copied.
+ *
+ * \note `size` must be positive, a chunk of zero elements would never advance.
+ */
+template <typename _View>
+class chunk_view : public view_base {
+private:
+    using base_iterator = __detail::iterator_t<const _View>;
+    using base_sentinel = __detail::sentinel_t<const _View>;
+
+public:
+    class iterator {
+    public:
+        using value_type        = take_view<subrange<base_iterator, base_sentinel>>;
+        using reference         = value_type;
+        using difference_type   = std::ptrdiff_t;
+        using iterator_concept  = std::forward_iterator_tag;
+        using iterator_category = std::input_iterator_tag;
+
+    public:
+        iterator() = default;
+        iterator(base_iterator it, base_sentinel end, difference_type size)
+            : m_it(it), m_end(end), m_size(size) {}
+
+    public:
+        reference operator*() const { return value_type(subrange<base_iterator, base_sentinel>(m_it, m_end), m_size); }
+
+        iterator& operator++() {
+            for (difference_type i = 0; i < m_size && m_it != m_end; ++i)
+                ++m_it;
+            return *this;
+        }
+        iterator operator++(int) { iterator old = *this; ++(*this); return old; }
+
+        bool operator==(const iterator& other) const { return m_it == other.m_it; }
+        bool operator==(std::default_sentinel_t) const { return m_it == m_end; }
+
+    private:
+        base_iterator   m_it{};
+        base_sentinel   m_end{};
+        difference_type m_size = 0;
+    };
+
+public:
+    /**
+     * \throws std::invalid_argument if `size <= 0`.
+     */
+    constexpr chunk_view(_View base, std::ptrdiff_t size) : m_base(std::move(base)), m_size(__detail::__check_chunk_size(size)) {}
+
+    iterator begin() const { return iterator(__detail::__begin(m_base), __detail::__end(m_base), m_size); }
+    std::default_sentinel_t end() const { return std::default_sentinel; }
+
+private:
+    _View          m_base;
+    std::ptrdiff_t m_size;
+};
+
+
+/**
+ * \class zip_view
+ *
+ * \brief A view of tuples of references to the corresponding elements of
+ * each `_Views`. Its length is the length of the shortest view.
+ */
+template <typename... _Views>
+class zip_view : public view_base {
+public:
+    class iterator {
+    private:
+        using iterators = std::tuple<__detail::iterator_t<const _Views>...>;
+        using sentinels = std::tuple<__detail::sentinel_t<const _Views>...>;
+
+    public:
+        using value_type        = std::tuple<__detail::range_value_t<const _Views>...>;
+        using reference         = std::tuple<__detail::range_reference_t<const _Views>...>;
+        using difference_type   = std::ptrdiff_t;
+        using iterator_concept  = std::forward_iterator_tag;
+        using iterator_category = std::input_iterator_tag;
+
+    public:
+        iterator() = default;
+        iterator(iterators its, sentinels ends) : m_its(its), m_ends(ends) {}
+
+    public:
+        reference operator*() const {
+            return std::apply([](const auto&... it) { return reference(*it...); }, m_its);
+        }
+
+        iterator& operator++() {
+            std::apply([](auto&... it) { (++it, ...); }, m_its);
+            return *this;
+        }
+        iterator operator++(int) { iterator old = *this; ++(*this); return old; }
+
+        bool operator==(const iterator& other) const { return m_its == other.m_its; }
+        bool operator==(std::default_sentinel_t) const { return at_end(std::index_sequence_for<_Views...>()); }
+
+    private:
+        /**
+         * \brief Returns true when any of the zipped iterators reached its end.
+         */
+        template <std::size_t... _Is>
+        bool at_end(std::index_sequence<_Is...>) const {
+            return ((std::get<_Is>(m_its) == std::get<_Is>(m_ends)) || ...);
+        }
+
+    private:
+        iterators m_its{};
+        sentinels m_ends{};
+    };
+
+public:
+    constexpr explicit zip_view(_Views... views) : m_views(std::move(views)...) {}
+
+    iterator begin() const {
+        return iterator(
+            std::apply([](const auto&... v) { return std::make_tuple(__detail::__begin(v)...); }, m_views),
+            std::apply([](const auto&... v) { return std::make_tuple(__detail::__end(v)...); }, m_views));
+    }
+    std::default_sentinel_t end() const { return std::default_sentinel; }
+
+private:
+    std::tuple<_Views...> m_views;
+};
+
+
+/**
+ * \class enumerate_view
+ *
+ * \brief A view of `(index, element)` pairs of `_View`.
+ */
+template <typename _View>
+class enumerate_view : public view_base {
+private:
+    using base_iterator = __detail::iterator_t<const _View>;
+    using base_sentinel = __detail::sentinel_t<const _View>;
+
+public:
+    class iterator {
+    public:
+        using value_type        = std::pair<std::size_t, std::iter_value_t<base_iterator>>;
+        using reference         = std::pair<std::size_t, std::iter_reference_t<base_iterator>>;
+        using difference_type   = std::ptrdiff_t;
+        using iterator_concept  = std::forward_iterator_tag;
+        using iterator_category = std::input_iterator_tag;
+
+    public:
+        iterator() = default;
+        iterator(base_iterator it, base_sentinel end) : m_it(it), m_end(end) {}
+
+    public:
+        reference operator*() const { return reference(m_index, *m_it); }
+
+        iterator& operator++()    { ++m_it; ++m_index; return *this; }
+        iterator  operator++(int) { iterator old = *this; ++(*this); return old; }
+
+        bool operator==(const iterator& other) const { return m_it == other.m_it; }
+        bool operator==(std::default_sentinel_t) const { return m_it == m_end; }
+
+    private:
+        base_iterator m_it{};
+        base_sentinel m_end{};
+        std::size_t   m_index = 0;
+    };
+
+public:
+    constexpr explicit enumerate_view(_View base) : m_base(std::move(base)) {}
+
+    iterator begin() const { return iterator(__detail::__begin(m_base), __detail::__end(m_base)); }
+    std::default_sentinel_t end() const { return std::default_sentinel; }
+
+private:
+    _View m_base;
+};
+
+
+namespace views {
+
+
+/**
+ * \brief Turns a range into a view.
+ *
+ * Views are returned as-is (copied), containers are wrapped in a `ref_view`.
+ * Temporary containers are rejected since the view would dangle.
+ */
+template <typename _Range>
+constexpr auto all(_Range&& r) {
+    if constexpr (std::is_base_of_v<view_base, std::remove_cvref_t<_Range>>) {
+        return std::remove_cvref_t<_Range>(std::forward<_Range>(r));
+    }
+    else {
+        static_assert(std::is_lvalue_reference_v<_Range>, "views::all(): cannot view a temporary container");
+        return ref_view<std::remove_reference_t<_Range>>(r);
+    }
+}
+
+/**
+ * \brief Turns the iterator pair `[first, last)` into a view.
+ */
+template <typename _Iter, typename _Sent>
+constexpr auto all(_Iter first, _Sent last) {
+    return subrange<_Iter, _Sent>(first, last);
+}
+
+template <typename _Range>
+using all_t = decltype(views::all(std::declval<_Range>()));
+
+
+/**
+ */
+struct __filter_fn {
+    template <typename _Range, typename _Pred>
+    constexpr auto operator()(_Range&& r, _Pred pred) const {
+        return filter_view<all_t<_Range>, _Pred>(views::all(std::forward<_Range>(r)), std::move(pred));
+    }
+
+    template <typename _Pred>
+    constexpr auto operator()(_Pred pred) const {
+        return __detail::__partial([pred](auto&& r) { return __filter_fn()(std::forward<decltype(r)>(r), pred); });
+    }
+};
+
+/**
+ */
+struct __transform_fn {
+    template <typename _Range, typename _Fn>
+    constexpr auto operator()(_Range&& r, _Fn fn) const {
+        return transform_view<all_t<_Range>, _Fn>(views::all(std::forward<_Range>(r)), std::move(fn));
+    }
+
+    template <typename _Fn>
+    constexpr auto operator()(_Fn fn) const {
+        return __detail::__partial([fn](auto&& r) { return __transform_fn()(std::forward<decltype(r)>(r), fn); });
+    }
+};
+
+/**
+ */
+struct __take_fn {
+    template <typename _Range>
+    constexpr auto operator()(_Range&& r, std::ptrdiff_t count) const {
+        return take_view<all_t<_Range>>(views::all(std::forward<_Range>(r)), count);
+    }
+
+    constexpr auto operator()(std::ptrdiff_t count) const {
+        return __detail::__partial([count](auto&& r) { return __take_fn()(std::forward<decltype(r)>(r), count); });
+    }
+};
+
+/**
+ */
+struct __drop_fn {
+    template <typename _Range>
+    constexpr auto operator()(_Range&& r, std::ptrdiff_t count) const {
+        return drop_view<all_t<_Range>>(views::all(std::forward<_Range>(r)), count);
+    }
+
+    constexpr auto operator()(std::ptrdiff_t count) const {
+        return __detail::__partial([count](auto&& r) { return __drop_fn()(std::forward<decltype(r)>(r), count); });
+    }
+};
+
+/**
+ */
+struct __chunk_fn {
+    template <typename _Range>
+    constexpr auto operator()(_Range&& r, std::ptrdiff_t size) const {
+        return chunk_view<all_t<_Range>>(views::all(std::forward<_Range>(r)), size);
+    }
+
+    // rejects a bad size here already, not only once the adaptor is applied
+    constexpr auto operator()(std::ptrdiff_t size) const {
+        __detail::__check_chunk_size(size);
+        return __detail::__partial([size](auto&& r) { return __chunk_fn()(std::forward<decltype(r)>(r), size); });
+    }
+};
+
+/**
+ */
+struct __zip_fn {
+    template <typename... _Ranges>
+    constexpr auto operator()(_Ranges&&... rs) const {
+        return zip_view<all_t<_Ranges>...>(views::all(std::forward<_Ranges>(rs))...);
+    }
+};
+
+/**
+ */
+struct __enumerate_fn : __detail::__adaptor_closure {
+    template <typename _Range>
+    constexpr auto operator()(_Range&& r) const {
+        return enumerate_view<all_t<_Range>>(views::all(std::forward<_Range>(r)));
+    }
+};
+
+
+inline constexpr __filter_fn    filter{};
+inline constexpr __transform_fn transform{};
+inline constexpr __take_fn      take{};
+inline constexpr __drop_fn      drop{};
+inline constexpr __chunk_fn     chunk{};
+inline constexpr __zip_fn       zip{};
+inline constexpr __enumerate_fn enumerate{};
+
+
+} // namespace views
+
+
+} // namespace mystl::
+
+
+#endif // VIEWS_HPP_
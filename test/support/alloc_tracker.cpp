@@ -0,0 +1,108 @@
+/**
+ * \file test/support/alloc_tracker.cpp
+ *
+ * \brief Replacements of the global allocation functions that count into
+ * thread-local totals, see `alloc_tracker.hpp`.
+ */
+
+#include <cstdlib>  // malloc, aligned_alloc, free
+#include <new>      // bad_alloc, align_val_t, nothrow_t, get_new_handler
+
+#include "alloc_tracker.hpp"
+
+
+namespace {
+
+// plain zero-initialized data, usable before and during static initialization
+thread_local alloc_tracker::counts totals;
+
+
+void* allocate(std::size_t size) noexcept {
+    void* p = std::malloc(size == 0 ? 1 : size);
+    if (p != nullptr) {
+        ++totals.allocations;
+        totals.bytes += size;
+    }
+    return p;
+}
+
+
+void* allocate(std::size_t size, std::align_val_t align) noexcept {
+    std::size_t alignment = static_cast<std::size_t>(align);
+    std::size_t rounded = (size + alignment - 1) / alignment * alignment;   // as aligned_alloc requires
+    void* p = std::aligned_alloc(alignment, rounded == 0 ? alignment : rounded);
+    if (p != nullptr) {
+        ++totals.allocations;
+        totals.bytes += size;
+    }
+    return p;
+}
+
+
+void deallocate(void* p) noexcept {
+    if (p == nullptr)
+        return;
+    ++totals.deallocations;
+    std::free(p);
+}
+
+}
+
+
+alloc_tracker::counts alloc_tracker::current() noexcept {
+    return totals;
+}
+
+
+/* Allocation */
+// like the default operator new, calls the new-handler until the allocation
+// succeeds or no handler is installed
+void* operator new(std::size_t size) {
+    for (;;) {
+        if (void* p = allocate(size))
+            return p;
+        std::new_handler handler = std::get_new_handler();
+        if (handler == nullptr)
+            throw std::bad_alloc();
+        handler();
+    }
+}
+
+void* operator new[](std::size_t size) {
+    return ::operator new(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t align) {
+    for (;;) {
+        if (void* p = allocate(size, align))
+            return p;
+        std::new_handler handler = std::get_new_handler();
+        if (handler == nullptr)
+            throw std::bad_alloc();
+        handler();
+    }
+}
+
+void* operator new[](std::size_t size, std::align_val_t align) {
+    return ::operator new(size, align);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept { return allocate(size); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return allocate(size); }
+void* operator new(std::size_t size, std::align_val_t align, const std::nothrow_t&) noexcept { return allocate(size, align); }
+void* operator new[](std::size_t size, std::align_val_t align, const std::nothrow_t&) noexcept { return allocate(size, align); }
+
+
+/* Deallocation */
+void operator delete(void* p) noexcept { deallocate(p); }
+void operator delete[](void* p) noexcept { deallocate(p); }
+void operator delete(void* p, std::size_t) noexcept { deallocate(p); }
+void operator delete[](void* p, std::size_t) noexcept { deallocate(p); }
+void operator delete(void* p, std::align_val_t) noexcept { deallocate(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { deallocate(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { deallocate(p); }
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept { deallocate(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { deallocate(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { deallocate(p); }
+void operator delete(void* p, std::align_val_t, const std::nothrow_t&) noexcept { deallocate(p); }
+void operator delete[](void* p, std::align_val_t, const std::nothrow_t&) noexcept { deallocate(p); }
@@ -0,0 +1,67 @@
+/**
+ * \file test/support/alloc_tracker.hpp
+ *
+ * \brief Counts the calls of the global `operator new` and `operator delete`
+ * made by the calling thread, for tests asserting how often an operation
+ * allocates.
+ *
+ * The replacement operators live in `alloc_tracker.cpp`, which only the
+ * `test_allocations` executable links; `std::allocator` and every `new`
+ * expression go through them.
+ */
+
+#pragma once
+
+#ifndef TEST_SUPPORT_ALLOC_TRACKER_HPP_
+#define TEST_SUPPORT_ALLOC_TRACKER_HPP_
+
+#include <cstddef>  // size_t
+
+
+namespace alloc_tracker {
+
+
+/**
+ * \brief Totals of the calling thread since it started.
+ */
+struct counts {
+    std::size_t allocations   = 0;
+    std::size_t deallocations = 0;
+    std::size_t bytes         = 0;   // requested by the allocations
+};
+
+
+/**
+ * \brief Returns the calling thread's totals.
+ */
+counts current() noexcept;
+
+
+/**
+ * \class scope
+ *
+ * \brief Counts the calling thread's allocations from its construction on;
+ * scopes may nest.
+ */
+class scope {
+public:
+    scope() noexcept : m_start(current()) {}
+
+    scope(const scope&) = delete;
+    scope& operator=(const scope&) = delete;
+
+    /**
+     */
+    std::size_t allocations() const noexcept { return current().allocations - m_start.allocations; }
+    std::size_t deallocations() const noexcept { return current().deallocations - m_start.deallocations; }
+    std::size_t bytes() const noexcept { return current().bytes - m_start.bytes; }
+
+private:
+    counts m_start;
+};
+
+
+} // namespace alloc_tracker::
+
+
+#endif // TEST_SUPPORT_ALLOC_TRACKER_HPP_
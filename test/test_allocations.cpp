@@ -0,0 +1,279 @@
+/**
+ * \file test/test_allocations.cpp
+ *
+ * \brief Exact counts of the heap allocations the containers make, so that a
+ * hot path which starts allocating fails here.
+ */
+
+#include <cstddef>
+#include <limits>
+#include <new>
+#include <gtest/gtest.h>
+
+#include "support/alloc_tracker.hpp"
+#include "vector.hpp"
+#include "list.hpp"
+#include "forward_list.hpp"
+#include "stack.hpp"
+#include "queue.hpp"
+#include "priority_queue.hpp"
+
+
+TEST(AllocTrackerTest, CountsNewAndDelete) {
+    alloc_tracker::scope scope;
+    int* volatile p = new int(42);
+    EXPECT_EQ(scope.allocations(), 1u);
+    EXPECT_EQ(scope.bytes(), sizeof(int));
+    delete p;
+    EXPECT_EQ(scope.deallocations(), 1u);
+
+    // nested scopes count from their own start
+    alloc_tracker::scope inner;
+    int* volatile q = new int[4];
+    delete[] q;
+    EXPECT_EQ(inner.allocations(), 1u);
+    EXPECT_EQ(scope.allocations(), 2u);
+}
+
+
+namespace {
+
+int handler_calls = 0;
+
+void give_up_handler() {
+    ++handler_calls;
+    std::set_new_handler(nullptr);
+}
+
+}
+
+
+TEST(AllocTrackerTest, CallsNewHandlerBeforeThrowing) {
+    handler_calls = 0;
+    std::new_handler previous = std::set_new_handler(give_up_handler);
+    EXPECT_THROW(static_cast<void>(::operator new(std::numeric_limits<std::size_t>::max() / 2)), std::bad_alloc);
+    EXPECT_EQ(handler_calls, 1);
+    std::set_new_handler(previous);
+}
+
+
+/* vector */
+TEST(AllocationTest, VectorDefaultConstructor) {
+    alloc_tracker::scope scope;
+    mystl::vector<int> vec;
+    EXPECT_EQ(scope.allocations(), 1u);
+    EXPECT_EQ(scope.bytes(), vec.capacity() * sizeof(int));
+}
+
+
+TEST(AllocationTest, VectorReservedHotPathNeverAllocates) {
+    mystl::vector<int> vec;
+    vec.reserve(100);
+
+    //
+    alloc_tracker::scope scope;
+    for (int i = 0; i < 90; ++i)
+        vec.push_back(i);
+    vec.emplace_back(90);
+    vec.insert(vec.cbegin(), -1);
+    vec.emplace(vec.cbegin() + 50, -2);
+    vec.erase(vec.cbegin() + 3);
+    vec.erase(vec.cbegin(), vec.cbegin() + 10);
+    vec.pop_back();
+    vec.resize(95);
+    vec.clear();
+    EXPECT_EQ(scope.allocations(), 0u);
+    EXPECT_EQ(scope.deallocations(), 0u);
+}
+
+
+TEST(AllocationTest, VectorGrowthReallocatesOnce) {
+    mystl::vector<int> vec;
+    for (std::size_t i = 0; i < vec.capacity(); ++i)
+        vec.push_back(0);
+
+    //
+    alloc_tracker::scope scope;
+    vec.push_back(1);
+    EXPECT_EQ(scope.allocations(), 1u);
+    EXPECT_EQ(scope.deallocations(), 1u);
+}
+
+
+TEST(AllocationTest, VectorCopyMoveAndShrink) {
+    mystl::vector<int> vec(20, 1);
+    vec.reserve(40);
+
+    //
+    alloc_tracker::scope copy;
+    mystl::vector<int> copied(vec);
+    EXPECT_EQ(copy.allocations(), 1u);
+    EXPECT_EQ(copy.bytes(), 20 * sizeof(int));   // the spare capacity is not copied
+
+    //
+    alloc_tracker::scope move;
+    mystl::vector<int> moved(std::move(vec));
+    EXPECT_EQ(move.allocations(), 0u);
+
+    //
+    alloc_tracker::scope shrink;
+    moved.shrink_to_fit();
+    copied.shrink_to_fit();   // already exact
+    EXPECT_EQ(shrink.allocations(), 1u);
+    EXPECT_EQ(shrink.deallocations(), 1u);
+}
+
+
+/* list */
+TEST(AllocationTest, ListOneNodePerElement) {
+    alloc_tracker::scope scope;
+    mystl::list<int> list;
+    EXPECT_EQ(scope.allocations(), 1u);   // the sentinel
+
+    //
+    alloc_tracker::scope nodes;
+    list.push_back(1);
+    list.push_front(0);
+    list.emplace_back(2);
+    list.insert(list.cend(), 3);
+    EXPECT_EQ(nodes.allocations(), 4u);
+
+    //
+    alloc_tracker::scope frees;
+    list.pop_back();
+    list.pop_front();
+    list.erase(list.cbegin());
+    EXPECT_EQ(frees.allocations(), 0u);
+    EXPECT_EQ(frees.deallocations(), 3u);
+}
+
+
+TEST(AllocationTest, ListRelinkingNeverAllocates) {
+    mystl::list<int> list = {5, 3, 1};
+    mystl::list<int> other = {4, 2, 0};
+
+    //
+    alloc_tracker::scope scope;
+    list.sort();
+    other.sort();
+    list.merge(other);
+    list.reverse();
+    other.splice(other.cbegin(), list, list.cbegin());
+    list.splice(list.cbegin(), other);
+    list.swap(other);
+    EXPECT_EQ(scope.allocations(), 0u);
+    EXPECT_EQ(scope.deallocations(), 0u);
+}
+
+
+TEST(AllocationTest, ListMoveLeavesNewSentinel) {
+    mystl::list<int> list = {1, 2, 3};
+
+    //
+    alloc_tracker::scope scope;
+    mystl::list<int> moved(std::move(list));
+    EXPECT_EQ(scope.allocations(), 1u);
+}
+
+
+/* forward_list */
+TEST(AllocationTest, ForwardListOneNodePerElement) {
+    alloc_tracker::scope scope;
+    mystl::forward_list<int> list;
+    EXPECT_EQ(scope.allocations(), 1u);   // the sentinel
+
+    //
+    alloc_tracker::scope nodes;
+    list.push_front(1);
+    list.emplace_front(0);
+    EXPECT_EQ(nodes.allocations(), 2u);
+
+    //
+    alloc_tracker::scope frees;
+    list.pop_front();
+    EXPECT_EQ(frees.allocations(), 0u);
+    EXPECT_EQ(frees.deallocations(), 1u);
+}
+
+
+TEST(AllocationTest, ForwardListRelinkingNeverAllocates) {
+    mystl::forward_list<int> list = {5, 3, 1};
+    mystl::forward_list<int> other = {4, 2, 0};
+
+    //
+    alloc_tracker::scope scope;
+    list.sort();
+    other.sort();
+    list.merge(other);
+    list.reverse();
+    other.splice_after(other.cbefore_begin(), list);
+    list.swap(other);
+    EXPECT_EQ(scope.allocations(), 0u);
+    EXPECT_EQ(scope.deallocations(), 0u);
+}
+
+
+/* adaptors */
+TEST(AllocationTest, StackGrowsLikeVector) {
+    mystl::stack<int> stk;
+    for (int i = 0; i < 10; ++i)
+        stk.push(i);
+
+    //
+    alloc_tracker::scope pops;
+    stk.pop();
+    stk.emplace(9);
+    EXPECT_EQ(pops.allocations(), 0u);
+
+    //
+    alloc_tracker::scope growth;
+    stk.push(10);
+    EXPECT_EQ(growth.allocations(), 1u);
+    EXPECT_EQ(growth.deallocations(), 1u);
+}
+
+
+TEST(AllocationTest, QueueOneNodePerElement) {
+    mystl::queue<int> que;
+
+    //
+    alloc_tracker::scope scope;
+    for (int i = 0; i < 5; ++i)
+        que.push(i);
+    que.emplace(5);
+    EXPECT_EQ(scope.allocations(), 6u);
+
+    //
+    alloc_tracker::scope pops;
+    que.pop();
+    que.pop();
+    EXPECT_EQ(pops.allocations(), 0u);
+    EXPECT_EQ(pops.deallocations(), 2u);
+}
+
+
+TEST(AllocationTest, PriorityQueueReservedHotPathNeverAllocates) {
+    alloc_tracker::scope construct;
+    mystl::priority_queue<int> queue;
+    queue.reserve(64);
+    EXPECT_EQ(construct.allocations(), 2u);   // the default capacity, then the reserve
+
+    //
+    int out[8];
+    alloc_tracker::scope scope;
+    for (int i = 0; i < 64; ++i)
+        queue.push((i * 37) % 64);
+    queue.pop();
+    int top = queue.pop_value();
+    queue.pop_n(8, out);
+    queue.emplace(top);
+    EXPECT_EQ(scope.allocations(), 0u);
+    EXPECT_EQ(scope.deallocations(), 0u);
+    EXPECT_EQ(out[0], 61);
+}
+
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -133,6 +133,14 @@ TEST(ArrayTest, RandomAccessIteratorCategoryTest) {
     EXPECT_TRUE(is_random_access) << "mystl::array::iterator must satisfy the random_access_iterator concept";
 }
 
+
+TEST(ArrayTest, MemoryFootprint) {
+    constexpr mystl::array<int, 5> arr = {1, 2, 3, 4, 5};
+    static_assert(arr.allocated_bytes() == 0);
+    static_assert(arr.memory_footprint() == 5 * sizeof(int));
+    static_assert(arr.overhead_bytes() == 0);
+}
+
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
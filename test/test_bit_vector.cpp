@@ -0,0 +1,175 @@
+/**
+ * \file test/test_bit_vector.cpp
+ */
+
+#include <algorithm>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "bit_vector.hpp"
+
+
+/* Constructors */
+TEST(BitVectorTest, DefaultConstructor) {
+    mystl::bit_vector bits;
+    EXPECT_TRUE(bits.empty());
+    EXPECT_EQ(bits.count(), 0);
+    EXPECT_EQ(bits.find_first(), 0);
+}
+
+
+TEST(BitVectorTest, ConstructByCount) {
+    mystl::bit_vector zeros(100);
+    EXPECT_EQ(zeros.size(), 100);
+    EXPECT_EQ(zeros.word_count(), 2);
+    EXPECT_TRUE(zeros.none());
+
+    mystl::bit_vector ones(100, true);
+    EXPECT_EQ(ones.count(), 100) << "Bits past size() must not be counted";
+    EXPECT_TRUE(ones.all());
+}
+
+
+TEST(BitVectorTest, InitializerList) {
+    mystl::bit_vector bits = {true, false, true, true};
+    ASSERT_EQ(bits.size(), 4);
+    EXPECT_TRUE(bits[0]);
+    EXPECT_FALSE(bits[1]);
+    EXPECT_TRUE(bits[2]);
+    EXPECT_TRUE(bits[3]);
+}
+
+
+/* Element access */
+TEST(BitVectorTest, ProxyReference) {
+    mystl::bit_vector bits(130);
+    bits[0] = true;
+    bits[64] = true;
+    bits[129] = bits[0];
+    EXPECT_TRUE(bits.test(0));
+    EXPECT_TRUE(bits.test(64));
+    EXPECT_TRUE(bits.test(129));
+    EXPECT_EQ(bits.count(), 3);
+
+    bits[64].flip();
+    EXPECT_FALSE(bits[64]);
+    EXPECT_TRUE(~bits[64]);
+
+    EXPECT_THROW(bits.test(130), std::out_of_range);
+    EXPECT_THROW(bits.set(130), std::out_of_range);
+}
+
+
+TEST(BitVectorTest, Iterators) {
+    mystl::bit_vector bits = {true, false, false, true, true};
+    std::vector<bool> seen;
+    for (auto it = bits.cbegin(); it != bits.cend(); ++it)
+        seen.push_back(*it);
+    EXPECT_EQ(seen, (std::vector<bool>{true, false, false, true, true}));
+
+    // write through the proxy
+    for (auto bit : bits)
+        bit = !bit;
+    EXPECT_EQ(bits.count(), 2);
+    EXPECT_TRUE(bits[1]);
+    EXPECT_TRUE(bits[2]);
+
+    EXPECT_EQ(bits.end() - bits.begin(), 5);
+    EXPECT_EQ(std::count(bits.cbegin(), bits.cend(), true), 2);
+}
+
+
+/* Modifiers */
+TEST(BitVectorTest, PushBackAndPopBack) {
+    mystl::bit_vector bits;
+    for (int i = 0; i < 200; ++i)
+        bits.push_back(i % 3 == 0);
+    EXPECT_EQ(bits.size(), 200);
+    EXPECT_EQ(bits.count(), 67);
+
+    for (int i = 0; i < 100; ++i)
+        bits.pop_back();
+    EXPECT_EQ(bits.size(), 100);
+    EXPECT_EQ(bits.count(), 34);
+
+    mystl::bit_vector empty;
+    EXPECT_THROW(empty.pop_back(), std::length_error);
+}
+
+
+TEST(BitVectorTest, Resize) {
+    mystl::bit_vector bits(10);
+    bits.resize(70, true);
+    EXPECT_EQ(bits.count(), 60);
+    EXPECT_FALSE(bits[9]);
+    EXPECT_TRUE(bits[10]);
+
+    bits.resize(5);
+    EXPECT_EQ(bits.count(), 0);
+
+    bits.resize(64, false);
+    EXPECT_EQ(bits.count(), 0) << "Shrinking must not leave stale bits behind";
+}
+
+
+TEST(BitVectorTest, SetResetFlipAll) {
+    mystl::bit_vector bits(77);
+    bits.set();
+    EXPECT_EQ(bits.count(), 77);
+    bits.flip();
+    EXPECT_EQ(bits.count(), 0);
+    bits.flip(3);
+    EXPECT_EQ(bits.count(), 1);
+    bits.reset();
+    EXPECT_TRUE(bits.none());
+}
+
+
+/* Bitwise operations */
+TEST(BitVectorTest, BitwiseOperators) {
+    mystl::bit_vector a = {true, true, false, false};
+    mystl::bit_vector b = {true, false, true, false};
+
+    EXPECT_EQ(a & b, (mystl::bit_vector{true, false, false, false}));
+    EXPECT_EQ(a | b, (mystl::bit_vector{true, true, true, false}));
+    EXPECT_EQ(a ^ b, (mystl::bit_vector{false, true, true, false}));
+    EXPECT_EQ(~a, (mystl::bit_vector{false, false, true, true}));
+    EXPECT_EQ((~a).count(), 2);
+
+    mystl::bit_vector c(5);
+    EXPECT_THROW(a &= c, std::invalid_argument);
+}
+
+
+/* Search, rank and select */
+TEST(BitVectorTest, FindFirstAndNext) {
+    mystl::bit_vector bits(300);
+    std::vector<std::size_t> positions = {3, 63, 64, 128, 299};
+    for (std::size_t pos : positions)
+        bits.set(pos);
+
+    std::vector<std::size_t> found;
+    for (std::size_t i = bits.find_first(); i < bits.size(); i = bits.find_next(i))
+        found.push_back(i);
+    EXPECT_EQ(found, positions);
+    EXPECT_EQ(bits.find_next(299), 300);
+}
+
+
+TEST(BitVectorTest, RankAndSelect) {
+    mystl::bit_vector bits(500);
+    for (std::size_t i = 0; i < 500; i += 7)
+        bits.set(i);
+
+    std::size_t expected = 0;
+    for (std::size_t pos = 0; pos <= 500; ++pos) {
+        ASSERT_EQ(bits.rank(pos), expected) << "rank mismatch at " << pos;
+        if (pos < 500 && bits[pos])
+            ++expected;
+    }
+
+    for (std::size_t k = 0; k < bits.count(); ++k)
+        EXPECT_EQ(bits.select(k), k * 7);
+    EXPECT_EQ(bits.select(bits.count()), bits.size());
+    EXPECT_THROW(bits.rank(501), std::out_of_range);
+}
@@ -0,0 +1,100 @@
+/**
+ * \file test/test_bitset.cpp
+ */
+
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "bitset.hpp"
+
+
+namespace {
+
+constexpr std::size_t constexpr_count() {
+    mystl::bitset<100> bits;
+    bits.set(1).set(50).set(99);
+    bits.flip(50);
+    return bits.count() + bits.find_next(1);
+}
+
+}
+
+
+TEST(BitsetTest, Constexpr) {
+    static_assert(constexpr_count() == 2 + 99);
+    static_assert(mystl::bitset<100>::size() == 100);
+    static_assert(mystl::bitset<0b1011>(0b1011).count() == 3);
+}
+
+
+TEST(BitsetTest, ConstructFromValue) {
+    mystl::bitset<4> bits(0xFF);
+    EXPECT_EQ(bits.count(), 4) << "Bits past N must be dropped";
+    EXPECT_TRUE(bits.all());
+
+    mystl::bitset<8> small(0b1010);
+    EXPECT_FALSE(small[0]);
+    EXPECT_TRUE(small[1]);
+    EXPECT_TRUE(small[3]);
+}
+
+
+TEST(BitsetTest, SetResetFlip) {
+    mystl::bitset<130> bits;
+    EXPECT_TRUE(bits.none());
+    bits.set();
+    EXPECT_EQ(bits.count(), 130);
+    bits.reset(129);
+    EXPECT_FALSE(bits.test(129));
+    bits.flip();
+    EXPECT_EQ(bits.count(), 1);
+    EXPECT_EQ(bits.find_first(), 129);
+
+    EXPECT_THROW(bits.test(130), std::out_of_range);
+    EXPECT_THROW(bits.set(130), std::out_of_range);
+}
+
+
+TEST(BitsetTest, BitwiseOperators) {
+    mystl::bitset<70> a, b;
+    a.set(0).set(65);
+    b.set(65).set(69);
+
+    EXPECT_EQ((a & b).count(), 1);
+    EXPECT_EQ((a | b).count(), 3);
+    EXPECT_EQ((a ^ b).count(), 2);
+    EXPECT_EQ((~a).count(), 68);
+    EXPECT_TRUE((a & b)[65]);
+}
+
+
+TEST(BitsetTest, FindRankSelect) {
+    mystl::bitset<200> bits;
+    std::vector<std::size_t> positions = {0, 64, 65, 127, 199};
+    for (std::size_t pos : positions)
+        bits.set(pos);
+
+    std::vector<std::size_t> found;
+    for (std::size_t i = bits.find_first(); i < bits.size(); i = bits.find_next(i))
+        found.push_back(i);
+    EXPECT_EQ(found, positions);
+
+    EXPECT_EQ(bits.rank(65), 2);
+    EXPECT_EQ(bits.rank(200), 5);
+    for (std::size_t k = 0; k < positions.size(); ++k)
+        EXPECT_EQ(bits.select(k), positions[k]);
+    EXPECT_EQ(bits.select(5), 200);
+}
+
+
+TEST(BitsetTest, ProxyIteration) {
+    mystl::bitset<10> bits;
+    for (auto bit : bits)
+        bit = true;
+    EXPECT_TRUE(bits.all());
+
+    int count = 0;
+    for (auto it = bits.cbegin(); it != bits.cend(); ++it)
+        count += *it;
+    EXPECT_EQ(count, 10);
+}
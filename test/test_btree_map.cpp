@@ -0,0 +1,290 @@
+/**
+ * \file test/test_btree_map.cpp
+ */
+
+#include <functional>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "btree_map.hpp"
+#include "vector.hpp"
+
+
+namespace {
+
+// Counts live instances to check that construction and destruction are balanced.
+struct Tracked {
+    static inline int alive = 0;
+
+    Tracked(int v = 0) : value(v) { ++alive; }
+    Tracked(const Tracked& other) : value(other.value) { ++alive; }
+    Tracked(Tracked&& other) noexcept : value(other.value) { ++alive; }
+    Tracked& operator=(const Tracked&) = default;
+    ~Tracked() { --alive; }
+
+    int value;
+};
+
+// Small nodes give deep trees, so that splits and merges happen early.
+template <typename _Key, typename _T, typename _Compare = std::less<_Key>>
+using small_btree_map = mystl::btree_map<_Key, _T, _Compare, 64>;
+
+template <typename _Map, typename _Ref>
+void expect_same(const _Map& map, const _Ref& reference) {
+    ASSERT_EQ(map.size(), reference.size());
+    auto ref = reference.begin();
+    for (auto it = map.begin(); it != map.end(); ++it, ++ref) {
+        ASSERT_EQ(it->first, ref->first);
+        ASSERT_EQ(it->second, ref->second);
+    }
+}
+
+}
+
+
+/* Constructors */
+TEST(BtreeMapTest, DefaultConstructor) {
+    mystl::btree_map<int, int> map;
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.size(), 0);
+    EXPECT_EQ(map.height(), 0);
+    EXPECT_EQ(map.begin(), map.end());
+    EXPECT_EQ(map.find(1), map.end());
+    EXPECT_EQ(map.lower_bound(1), map.end());
+}
+
+
+TEST(BtreeMapTest, NodesSpanCacheLines) {
+    // pair<int, int> in 256-byte nodes: about 28 elements per leaf
+    EXPECT_GE((mystl::btree_map<int, int>::LEAF_SLOTS), 24);
+    EXPECT_GE((mystl::btree_map<int, int>::INNER_SLOTS), 16);
+    EXPECT_GE((small_btree_map<int, int>::LEAF_SLOTS), 4);
+}
+
+
+TEST(BtreeMapTest, InitializerListKeepsFirstOfDuplicates) {
+    mystl::btree_map<int, std::string> map = {{3, "c"}, {1, "a"}, {2, "b"}, {1, "z"}};
+    ASSERT_EQ(map.size(), 3);
+    EXPECT_EQ(map.at(1), "a");
+    std::vector<int> keys;
+    for (const auto& kv : map)
+        keys.push_back(kv.first);
+    EXPECT_EQ(keys, (std::vector<int>{1, 2, 3}));
+}
+
+
+TEST(BtreeMapTest, BulkLoadFromSortedVector) {
+    for (int n : {0, 1, 5, 6, 100, 1000, 12345}) {
+        mystl::vector<std::pair<const int, int>> sorted;
+        std::map<int, int> reference;
+        for (int i = 0; i < n; ++i) {
+            sorted.push_back({i * 2, i});
+            reference[i * 2] = i;
+        }
+
+        small_btree_map<int, int> map(mystl::sorted_unique, sorted);
+        expect_same(map, reference);
+
+        // the bulk-loaded tree stays valid under further modification
+        for (int i = 0; i < n; i += 3) {
+            map.erase(i * 2);
+            reference.erase(i * 2);
+            map[i * 2 + 1] = -i;
+            reference[i * 2 + 1] = -i;
+        }
+        expect_same(map, reference);
+    }
+}
+
+
+TEST(BtreeMapTest, CopyAndMove) {
+    small_btree_map<int, std::string> map;
+    for (int i = 0; i < 200; ++i)
+        map[i] = std::to_string(i);
+
+    small_btree_map<int, std::string> copied(map);
+    EXPECT_TRUE(copied == map);
+    copied[5] = "changed";
+    EXPECT_EQ(map.at(5), "5");
+    EXPECT_FALSE(copied == map);
+
+    small_btree_map<int, std::string> moved(std::move(copied));
+    EXPECT_EQ(moved.size(), 200);
+    EXPECT_TRUE(copied.empty());
+
+    small_btree_map<int, std::string> assigned;
+    assigned = map;
+    EXPECT_TRUE(assigned == map);
+    assigned = std::move(moved);
+    EXPECT_EQ(assigned.at(5), "changed");
+}
+
+
+/* Element access */
+TEST(BtreeMapTest, SubscriptAndAt) {
+    mystl::btree_map<std::string, int> map;
+    map["b"] = 2;
+    map["a"] += 1;
+    EXPECT_EQ(map.at("a"), 1);
+    EXPECT_EQ(map.at("b"), 2);
+    EXPECT_THROW(map.at("c"), std::out_of_range);
+
+    const auto& cmap = map;
+    EXPECT_EQ(cmap.at("b"), 2);
+    EXPECT_THROW(cmap.at("c"), std::out_of_range);
+}
+
+
+/* Modifiers */
+TEST(BtreeMapTest, InsertAndEmplace) {
+    mystl::btree_map<int, std::string> map;
+    auto [it, inserted] = map.insert({5, "five"});
+    EXPECT_TRUE(inserted);
+    EXPECT_EQ(it->second, "five");
+
+    auto [dup, again] = map.insert({5, "FIVE"});
+    EXPECT_FALSE(again);
+    EXPECT_EQ(dup->second, "five");
+
+    EXPECT_TRUE(map.emplace(3, "three").second);
+    EXPECT_FALSE(map.emplace(3, "THREE").second);
+    EXPECT_TRUE(map.try_emplace(4, 3, 'x').second);
+    EXPECT_EQ(map.at(4), "xxx");
+
+    auto result = map.insert_or_assign(3, "drei");
+    EXPECT_FALSE(result.second);
+    EXPECT_EQ(map.at(3), "drei");
+    EXPECT_EQ(map.size(), 3);
+}
+
+
+TEST(BtreeMapTest, InsertReturnsIteratorAcrossSplits) {
+    small_btree_map<int, int> map;
+    for (int i = 0; i < 500; ++i) {
+        int key = (i * 7919) % 500;
+        auto [it, inserted] = map.insert({key, i});
+        ASSERT_TRUE(inserted);
+        ASSERT_EQ(it->first, key);
+        ASSERT_EQ(it->second, i);
+    }
+    EXPECT_GT(map.height(), 2);
+}
+
+
+TEST(BtreeMapTest, EraseByIterator) {
+    small_btree_map<int, int> map;
+    for (int i = 0; i < 100; ++i)
+        map[i] = i;
+
+    // erasing through the returned iterators empties every other key
+    for (auto it = map.begin(); it != map.end();) {
+        it = map.erase(it);
+        if (it != map.end())
+            ++it;
+    }
+    EXPECT_EQ(map.size(), 50);
+    for (const auto& kv : map)
+        EXPECT_EQ(kv.first % 2, 1);
+}
+
+
+TEST(BtreeMapTest, MatchesStdMapUnderRandomOperations) {
+    small_btree_map<int, int> map;
+    std::map<int, int> reference;
+    std::mt19937 rng(42);
+
+    for (int i = 0; i < 50000; ++i) {
+        int key = int(rng() % 3000);
+        if (rng() % 5 < 2) {
+            ASSERT_EQ(map.erase(key), reference.erase(key));
+        } else {
+            map[key] = i;
+            reference[key] = i;
+        }
+    }
+    expect_same(map, reference);
+
+    // drain completely, the root must collapse back to nothing
+    for (int key = 0; key < 3000; ++key)
+        map.erase(key);
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.height(), 0);
+    map[1] = 1;
+    EXPECT_EQ(map.size(), 1);
+}
+
+
+TEST(BtreeMapTest, LifetimesAreBalanced) {
+    Tracked::alive = 0;
+    {
+        small_btree_map<int, Tracked> map;
+        for (int i = 0; i < 300; ++i)
+            map.try_emplace(i, i);
+        EXPECT_EQ(Tracked::alive, 300);
+
+        for (int i = 0; i < 300; i += 2)
+            map.erase(i);
+        EXPECT_EQ(Tracked::alive, 150);
+
+        small_btree_map<int, Tracked> copied(map);
+        EXPECT_EQ(Tracked::alive, 300);
+        copied.clear();
+        EXPECT_EQ(Tracked::alive, 150);
+    }
+    EXPECT_EQ(Tracked::alive, 0);
+}
+
+
+/* Lookup */
+TEST(BtreeMapTest, BoundsAndIteration) {
+    small_btree_map<int, int> map;
+    for (int i = 0; i < 1000; ++i)
+        map[i * 10] = i;
+
+    EXPECT_EQ(map.lower_bound(200)->first, 200);
+    EXPECT_EQ(map.upper_bound(200)->first, 210);
+    EXPECT_EQ(map.lower_bound(205)->first, 210);
+    EXPECT_EQ(map.upper_bound(205)->first, 210);
+    EXPECT_EQ(map.lower_bound(-1)->first, 0);
+    EXPECT_EQ(map.lower_bound(9991), map.end());
+    EXPECT_EQ(map.upper_bound(9990), map.end());
+
+    auto [first, last] = map.equal_range(500);
+    EXPECT_EQ(first->first, 500);
+    EXPECT_EQ(last->first, 510);
+
+    // range scan [1000, 2000)
+    int count = 0;
+    for (auto it = map.lower_bound(1000); it != map.lower_bound(2000); ++it)
+        ++count;
+    EXPECT_EQ(count, 100);
+
+    // backwards from end
+    auto it = map.end();
+    for (int i = 999; i >= 0; --i) {
+        --it;
+        ASSERT_EQ(it->second, i);
+    }
+    EXPECT_EQ(it, map.begin());
+}
+
+
+TEST(BtreeMapTest, CustomCompareUsesBinarySearch) {
+    small_btree_map<int, int, std::greater<int>> map;
+    for (int i = 0; i < 100; ++i)
+        map[i] = i;
+    EXPECT_EQ(map.begin()->first, 99);
+    EXPECT_EQ(map.lower_bound(50)->first, 50);
+    EXPECT_EQ(map.upper_bound(50)->first, 49);
+
+    small_btree_map<std::string, int> strings;
+    for (int i = 0; i < 100; ++i)
+        strings[std::to_string(i)] = i;
+    EXPECT_EQ(strings.at("42"), 42);
+    EXPECT_EQ(strings.begin()->first, "0");
+}
@@ -0,0 +1,72 @@
+/**
+ * \file test/test_btree_set.cpp
+ */
+
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "btree_set.hpp"
+#include "vector.hpp"
+
+
+/* Constructors */
+TEST(BtreeSetTest, InitializerList) {
+    mystl::btree_set<int> set = {5, 1, 3, 1};
+    EXPECT_EQ(set.size(), 3);
+    EXPECT_EQ(std::vector<int>(set.begin(), set.end()), (std::vector<int>{1, 3, 5}));
+}
+
+
+TEST(BtreeSetTest, BulkLoad) {
+    mystl::vector<int> sorted;
+    for (int i = 0; i < 10000; ++i)
+        sorted.push_back(i * 3);
+
+    mystl::btree_set<int> set(mystl::sorted_unique, sorted);
+    EXPECT_EQ(set.size(), 10000);
+    EXPECT_TRUE(set.contains(2997));
+    EXPECT_FALSE(set.contains(2998));
+    EXPECT_EQ(*set.lower_bound(2998), 3000);
+
+    mystl::btree_set<int> copied(set);
+    EXPECT_TRUE(copied == set);
+}
+
+
+/* Modifiers */
+TEST(BtreeSetTest, InsertAndErase) {
+    mystl::btree_set<std::string> set;
+    EXPECT_TRUE(set.insert("b").second);
+    EXPECT_TRUE(set.emplace(3, 'a').second);
+    EXPECT_FALSE(set.insert("b").second);
+    EXPECT_EQ(*set.begin(), "aaa");
+
+    EXPECT_EQ(set.erase("b"), 1);
+    EXPECT_EQ(set.erase("b"), 0);
+    auto it = set.erase(set.find("aaa"));
+    EXPECT_EQ(it, set.end());
+    EXPECT_TRUE(set.empty());
+}
+
+
+TEST(BtreeSetTest, MatchesStdSetUnderRandomOperations) {
+    mystl::btree_set<long, std::less<long>, 64> set;
+    std::set<long> reference;
+    std::mt19937 rng(3);
+
+    for (int i = 0; i < 50000; ++i) {
+        long key = long(rng() % 5000);
+        if (rng() % 2 == 0)
+            ASSERT_EQ(set.erase(key), reference.erase(key));
+        else
+            ASSERT_EQ(set.insert(key).second, reference.insert(key).second);
+    }
+    ASSERT_EQ(set.size(), reference.size());
+    EXPECT_TRUE(std::equal(set.begin(), set.end(), reference.begin()));
+
+    for (long key = 0; key < 5000; key += 37)
+        ASSERT_EQ(set.count(key), reference.count(key));
+}
@@ -0,0 +1,136 @@
+/**
+ * \file test/test_clock_cache.cpp
+ */
+
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <gtest/gtest.h>
+
+#include "clock_cache.hpp"
+
+
+/* Lookup */
+TEST(ClockCacheTest, GetAndPeek) {
+    mystl::clock_cache<int, std::string> cache(2);
+    EXPECT_TRUE(cache.empty());
+    EXPECT_EQ(cache.get(1), nullptr);
+
+    cache.put(1, "one");
+    cache.put(2, "two");
+    ASSERT_NE(cache.get(1), nullptr);
+    EXPECT_EQ(*cache.get(1), "one");
+    EXPECT_EQ(*cache.peek(2), "two");
+    EXPECT_FALSE(cache.contains(3));
+}
+
+
+/* Eviction */
+TEST(ClockCacheTest, SecondChance) {
+    mystl::clock_cache<int, int> cache(3);
+    cache.put(1, 10);
+    cache.put(2, 20);
+    cache.put(3, 30);
+
+    // 1 is referenced, so the hand spares it and takes 2
+    cache.get(1);
+    cache.put(4, 40);
+    EXPECT_EQ(cache.size(), 3);
+    EXPECT_TRUE(cache.contains(1));
+    EXPECT_FALSE(cache.contains(2));
+    EXPECT_TRUE(cache.contains(3));
+    EXPECT_TRUE(cache.contains(4));
+
+    // everything referenced: a full lap clears the bits, then the hand's slot goes
+    cache.get(1);
+    cache.get(3);
+    cache.get(4);
+    cache.put(5, 50);
+    EXPECT_EQ(cache.size(), 3);
+    EXPECT_TRUE(cache.contains(5));
+}
+
+
+TEST(ClockCacheTest, ZeroCapacity) {
+    mystl::clock_cache<int, int> cache(0);
+    EXPECT_FALSE(cache.put(1, 1));
+    EXPECT_TRUE(cache.empty());
+}
+
+
+/* Modifiers */
+TEST(ClockCacheTest, PointerStability) {
+    mystl::clock_cache<int, std::string> cache(3);
+    cache.put(1, "one");
+    std::string* one = cache.get(1);
+
+    // neither filling, updating nor evicting other entries moves the entry
+    cache.put(2, "two");
+    cache.put(3, "three");
+    cache.put(2, "TWO");
+    cache.put(4, "four");   // evicts 3, the only unreferenced entry
+    ASSERT_TRUE(cache.contains(1));
+    EXPECT_EQ(cache.get(1), one);
+    EXPECT_EQ(*one, "one");
+
+    // erase moves the last entry into the freed slot, so pointers must be fetched again
+    cache.erase(1);
+    ASSERT_NE(cache.get(4), nullptr);
+    EXPECT_EQ(*cache.get(4), "four");
+    ASSERT_NE(cache.get(2), nullptr);
+    EXPECT_EQ(*cache.get(2), "TWO");
+}
+
+
+TEST(ClockCacheTest, EraseKeepsIndexConsistent) {
+    mystl::clock_cache<int, int> cache(8);
+    for (int i = 0; i < 8; ++i)
+        cache.put(i, i * 10);
+
+    EXPECT_TRUE(cache.erase(0));
+    EXPECT_FALSE(cache.erase(0));
+    EXPECT_TRUE(cache.erase(5));
+    EXPECT_EQ(cache.size(), 6);
+    for (int i : {1, 2, 3, 4, 6, 7})
+        EXPECT_EQ(*cache.peek(i), i * 10);
+
+    cache.put(8, 80);
+    cache.put(9, 90);
+    cache.put(10, 100);
+    EXPECT_EQ(cache.size(), 8);
+    EXPECT_EQ(*cache.peek(10), 100);
+
+    cache.clear();
+    EXPECT_TRUE(cache.empty());
+}
+
+
+TEST(ClockCacheTest, RandomOperations) {
+    const int capacity = 32;
+    mystl::clock_cache<int, int> cache(capacity);
+    std::unordered_map<int, int> last;
+
+    std::mt19937 rng(11);
+    std::uniform_int_distribution<int> key(0, 127);
+    for (int step = 0; step < 20000; ++step) {
+        int k = key(rng);
+        switch (rng() % 3) {
+        case 0: {
+            int* value = cache.get(k);
+            if (value) {
+                EXPECT_EQ(*value, last[k]);
+            }
+            break;
+        }
+        case 1:
+            cache.put(k, step);
+            last[k] = step;
+            EXPECT_EQ(*cache.peek(k), step);
+            break;
+        default:
+            cache.erase(k);
+            EXPECT_FALSE(cache.contains(k));
+        }
+        ASSERT_LE(cache.size(), static_cast<std::size_t>(capacity));
+    }
+}
@@ -0,0 +1,120 @@
+/**
+ * \brief test_double_ended_priority_queue.cpp
+ */
+
+#include <functional>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <gtest/gtest.h>
+
+#include "vector.hpp"
+#include "double_ended_priority_queue.hpp"
+
+// 
+class DoubleEndedPriorityQueueTests : public ::testing::Test {
+protected:
+    // 
+    mystl::double_ended_priority_queue<int> depq;
+    mystl::vector<int> random_vec;
+
+    // 
+    void SetUp() {
+        random_vec = {74, -42, 48, -44, 14, 5, 96, -98, -80, 18, 64, -38, -31, -36, 73, 25, -18, -45, -42, 30};
+    }
+};
+
+
+// 
+TEST_F(DoubleEndedPriorityQueueTests, PushAndCheckBothEnds) {
+    // 
+    depq.push(5);
+    EXPECT_EQ(5, depq.min());
+    EXPECT_EQ(5, depq.max());
+
+    // 
+    depq.push(10);
+    depq.emplace(1);
+    EXPECT_EQ(1, depq.min());
+    EXPECT_EQ(10, depq.max());
+    EXPECT_EQ(3, depq.size());
+}
+
+
+// 
+TEST_F(DoubleEndedPriorityQueueTests, ConstructFromRange) {
+    // 
+    mystl::double_ended_priority_queue<int> q(random_vec.begin(), random_vec.end());
+    EXPECT_EQ(20, q.size());
+    EXPECT_EQ(-98, q.min());
+    EXPECT_EQ(96, q.max());
+
+    // 
+    q.pop_min();
+    q.pop_max();
+    EXPECT_EQ(-80, q.min());
+    EXPECT_EQ(74, q.max());
+}
+
+
+// 
+TEST_F(DoubleEndedPriorityQueueTests, CustomCompare) {
+    // 
+    mystl::double_ended_priority_queue<int, mystl::vector<int>, std::greater<int>> q(std::greater<int>(), random_vec);
+    EXPECT_EQ(96, q.min());
+    EXPECT_EQ(-98, q.max());
+}
+
+
+// 
+TEST_F(DoubleEndedPriorityQueueTests, MatchesMultiset) {
+    // 
+    std::multiset<int> reference;
+    std::mt19937 rng(1);
+    for (int step = 0; step < 20000; ++step) {
+        int op = rng() % 4;
+        if (reference.empty() || op < 2) {
+            int v = int(rng() % 1000);
+            depq.push(v);
+            reference.insert(v);
+        } else if (op == 2) {
+            depq.pop_min();
+            reference.erase(reference.begin());
+        } else {
+            depq.pop_max();
+            reference.erase(std::prev(reference.end()));
+        }
+
+        // 
+        ASSERT_EQ(reference.size(), depq.size());
+        if (!reference.empty()) {
+            ASSERT_EQ(*reference.begin(), depq.min());
+            ASSERT_EQ(*reference.rbegin(), depq.max());
+        }
+    }
+}
+
+
+// 
+TEST_F(DoubleEndedPriorityQueueTests, EmptyQueueThrows) {
+    EXPECT_THROW(depq.min(), std::out_of_range);
+    EXPECT_THROW(depq.max(), std::out_of_range);
+    EXPECT_THROW(depq.pop_min(), std::length_error);
+    EXPECT_THROW(depq.pop_max(), std::length_error);
+
+    // 
+    depq.push(1);
+    depq.pop_max();
+    EXPECT_THROW(depq.max(), std::out_of_range);
+}
+
+
+// 
+TEST_F(DoubleEndedPriorityQueueTests, Swap) {
+    // 
+    mystl::double_ended_priority_queue<int> other(random_vec.begin(), random_vec.end());
+    depq.push(7);
+    depq.swap(other);
+    EXPECT_EQ(20, depq.size());
+    EXPECT_EQ(7, other.max());
+}
@@ -1,9 +1,11 @@
 /**
  */
 
+#include <cstddef>
 #include <iterator>
 #include <stdexcept>
 #include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -451,6 +453,155 @@ TEST(ForwardListTest, SpliceAfter) {
 }
 
 
+TEST(ForwardListTest, SpliceAfterBeforeBeginAndEmpty) {
+    mystl::forward_list<int> list1 = {1, 2};
+    mystl::forward_list<int> list2 = {3, 4};
+    mystl::forward_list<int> empty;
+
+    list1.splice_after(list1.cbefore_begin(), list2);
+    EXPECT_EQ(std::vector<int>(list1.begin(), list1.end()), (std::vector<int>{3, 4, 1, 2}));
+    EXPECT_EQ(list1.size(), 4);
+
+    list1.splice_after(list1.cbegin(), empty);
+    EXPECT_EQ(std::vector<int>(list1.begin(), list1.end()), (std::vector<int>{3, 4, 1, 2}));
+    EXPECT_THROW(list1.splice_after(list1.cend(), list2), std::logic_error);
+}
+
+
+TEST(ForwardListTest, SpliceAfterSingleElement) {
+    mystl::forward_list<int> list1 = {1, 2, 3};
+    mystl::forward_list<int> list2 = {4, 5, 6};
+
+    // move '5' (the element after '4') after '1'
+    list1.splice_after(list1.cbegin(), list2, list2.cbegin());
+    EXPECT_EQ(std::vector<int>(list1.begin(), list1.end()), (std::vector<int>{1, 5, 2, 3}));
+    EXPECT_EQ(std::vector<int>(list2.begin(), list2.end()), (std::vector<int>{4, 6}));
+    EXPECT_EQ(list1.size(), 4);
+    EXPECT_EQ(list2.size(), 2);
+
+    // within the same list: move the front to after '2'
+    list1.splice_after(std::next(list1.cbegin(), 2), list1, list1.cbefore_begin());
+    EXPECT_EQ(std::vector<int>(list1.begin(), list1.end()), (std::vector<int>{5, 2, 1, 3}));
+    EXPECT_EQ(list1.size(), 4);
+}
+
+
+TEST(ForwardListTest, SpliceAfterRange) {
+    mystl::forward_list<int> list1 = {1, 2, 3};
+    mystl::forward_list<int> list2 = {4, 5, 6, 7};
+
+    // move the open range (4, 7) = {5, 6} after '1'
+    list1.splice_after(list1.cbegin(), list2, list2.cbegin(), std::next(list2.cbegin(), 3));
+    EXPECT_EQ(std::vector<int>(list1.begin(), list1.end()), (std::vector<int>{1, 5, 6, 2, 3}));
+    EXPECT_EQ(std::vector<int>(list2.begin(), list2.end()), (std::vector<int>{4, 7}));
+    EXPECT_EQ(list1.size(), 5);
+    EXPECT_EQ(list2.size(), 2);
+
+    // everything after '4' up to the end
+    list1.splice_after(list1.cbefore_begin(), list2, list2.cbegin(), list2.cend());
+    EXPECT_EQ(std::vector<int>(list1.begin(), list1.end()), (std::vector<int>{7, 1, 5, 6, 2, 3}));
+    EXPECT_EQ(list2.size(), 1);
+
+    // empty range
+    list1.splice_after(list1.cbegin(), list2, list2.cbegin(), list2.cend());
+    EXPECT_EQ(list1.size(), 6);
+}
+
+
+/* Cached tail */
+TEST(ForwardListTest, CachedTailPushBack) {
+    mystl::forward_list<int, true> list;
+    list.push_back(2);
+    list.push_front(1);
+    list.emplace_back(3);
+    EXPECT_EQ(list.back(), 3);
+    EXPECT_EQ(std::vector<int>(list.begin(), list.end()), (std::vector<int>{1, 2, 3}));
+
+    list.pop_front();
+    list.pop_front();
+    list.pop_front();
+    EXPECT_THROW(list.back(), std::out_of_range);
+    list.push_back(4);
+    EXPECT_EQ(list.front(), 4);
+    EXPECT_EQ(list.back(), 4);
+}
+
+
+TEST(ForwardListTest, CachedTailFollowsModifiers) {
+    mystl::forward_list<int, true> list = {5, 3, 3, 1};
+    EXPECT_EQ(list.back(), 1);
+
+    list.insert_after(std::next(list.cbegin(), 3), 9);
+    EXPECT_EQ(list.back(), 9);
+    list.erase_after(std::next(list.cbegin(), 3));
+    EXPECT_EQ(list.back(), 1);
+
+    list.remove(1);
+    EXPECT_EQ(list.back(), 3);
+    list.unique();
+    EXPECT_EQ(list.back(), 3);
+    list.reverse();
+    EXPECT_EQ(list.back(), 5);
+    list.sort();
+    EXPECT_EQ(list.back(), 5);
+
+    mystl::forward_list<int, true> other = {4, 8};
+    list.merge(other);
+    EXPECT_EQ(list.back(), 8);
+    EXPECT_EQ(std::vector<int>(list.begin(), list.end()), (std::vector<int>{3, 4, 5, 8}));
+
+    list.erase_after(list.cbegin(), list.cend());
+    EXPECT_EQ(list.back(), 3);
+
+    mystl::forward_list<int, true> copied(list);
+    copied.push_back(6);
+    EXPECT_EQ(copied.back(), 6);
+    mystl::forward_list<int, true> moved(std::move(copied));
+    EXPECT_EQ(moved.back(), 6);
+    copied.push_back(7);
+    EXPECT_EQ(copied.front(), 7);
+    EXPECT_EQ(copied.back(), 7);
+}
+
+
+TEST(ForwardListTest, CachedTailAfterSort) {
+    mystl::forward_list<int, true> list = {5, 1, 4, 2};
+    list.sort();
+    EXPECT_EQ(list.back(), 5);
+    list.push_back(6);
+    EXPECT_EQ(std::vector<int>(list.begin(), list.end()), (std::vector<int>{1, 2, 4, 5, 6}));
+}
+
+
+TEST(ForwardListTest, CachedTailSize) {
+    // the non-caching list holds only its size and sentinel
+    struct baseline { std::size_t size; void* before_head; };
+    EXPECT_EQ(sizeof(mystl::forward_list<int>), sizeof(baseline));
+    EXPECT_EQ(sizeof(mystl::forward_list<int, true>), sizeof(baseline) + sizeof(void*));
+}
+
+
+TEST(ForwardListTest, CachedTailSplice) {
+    mystl::forward_list<int, true> list1 = {1, 2};
+    mystl::forward_list<int, true> list2 = {3, 4, 5};
+
+    list1.splice_after(std::next(list1.cbegin()), list2, list2.cbegin(), list2.cend());
+    EXPECT_EQ(list1.back(), 5);
+    EXPECT_EQ(list2.back(), 3);
+
+    list2.splice_after(list2.cbegin(), list1);
+    EXPECT_EQ(list2.back(), 5);
+    EXPECT_TRUE(list1.empty());
+    list1.push_back(0);
+    EXPECT_EQ(list1.back(), 0);
+
+    list1.splice_after(list1.cbegin(), list2, std::next(list2.cbegin(), 3));
+    EXPECT_EQ(list1.back(), 5);
+    EXPECT_EQ(list2.back(), 4);
+    EXPECT_EQ(std::vector<int>(list2.begin(), list2.end()), (std::vector<int>{3, 1, 2, 4}));
+}
+
+
 TEST(ForwardListTest, Unique) {
     // 
     mystl::forward_list<int> list = {1, 1, 2, 2, 3, 3, 3, 4, 4, 5};
@@ -496,7 +647,65 @@ TEST(ForwardListTest, ForwardIteratorCategoryTest) {
 
 
 /**/
+
+TEST(ForwardListTest, MemoryFootprint) {
+    mystl::forward_list<int> list;
+    std::size_t node_bytes = list.allocated_bytes();   // the sentinel
+    EXPECT_GE(node_bytes, sizeof(int) + sizeof(void*));
+
+    //
+    for (int i = 0; i < 10; ++i)
+        list.push_front(i);
+    EXPECT_EQ(list.allocated_bytes(), 11 * node_bytes);
+    EXPECT_EQ(list.memory_footprint(), sizeof(list) + 11 * node_bytes);
+    EXPECT_EQ(list.overhead_bytes(), list.memory_footprint() - 10 * sizeof(int));
+}
+
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
 }
+
+
+/* Node handles */
+TEST(ForwardListTest, ExtractAndInsertNode) {
+    mystl::forward_list<int> list1 = {1, 2, 3};
+    mystl::forward_list<int> list2 = {9};
+
+    const int* addr = &*std::next(list1.begin());
+    auto nh = list1.extract_after(list1.cbegin());
+    ASSERT_FALSE(nh.empty());
+    EXPECT_EQ(nh.value(), 2);
+    EXPECT_EQ(list1.size(), 2);
+    EXPECT_EQ(std::vector<int>(list1.begin(), list1.end()), (std::vector<int>{1, 3}));
+
+    auto it = list2.insert_after(list2.cbefore_begin(), std::move(nh));
+    EXPECT_TRUE(nh.empty());
+    EXPECT_EQ(&*it, addr);
+    EXPECT_EQ(list2.size(), 2);
+    EXPECT_EQ(std::vector<int>(list2.begin(), list2.end()), (std::vector<int>{2, 9}));
+
+    // empty handle
+    it = list2.insert_after(list2.cbegin(), decltype(list2)::node_type());
+    EXPECT_EQ(*it, 2);
+    EXPECT_EQ(list2.size(), 2);
+
+    EXPECT_THROW(list2.extract_after(std::next(list2.cbegin())), std::logic_error);
+    EXPECT_THROW(list2.insert_after(list2.cend(), list1.extract_after(list1.cbegin())), std::logic_error);
+}
+
+
+TEST(ForwardListTest, CachedTailExtractAndInsertNode) {
+    mystl::forward_list<int, true> list1 = {1, 2};
+    mystl::forward_list<int, true> list2;
+
+    list2.insert_after(list2.cbefore_begin(), list1.extract_after(list1.cbegin()));
+    EXPECT_EQ(list1.back(), 1);
+    EXPECT_EQ(list2.back(), 2);
+
+    list2.insert_after(list2.cbegin(), list1.extract_after(list1.cbefore_begin()));
+    EXPECT_TRUE(list1.empty());
+    EXPECT_EQ(list2.back(), 1);
+    list1.push_back(5);
+    EXPECT_EQ(list1.back(), 5);
+}
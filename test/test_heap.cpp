@@ -11,6 +11,9 @@
 #include "algorithm/pop_heap.hpp"
 #include "algorithm/make_heap.hpp"
 #include "algorithm/sort_heap.hpp"
+#include "algorithm/minmax_heap.hpp"
+#include "algorithm/b_heap.hpp"
+#include "algorithm/pop_heap_n.hpp"
 
 
 // 
@@ -298,6 +301,178 @@ TEST_F(HeapFunctionTests, SingleElementSortHeap) {
 }
 
 
+// Test `make_minmax_heap` and the min-max heap accessors
+TEST_F(HeapFunctionTests, MakeMinmaxHeap) {
+    // 
+    mystl::make_minmax_heap(random_array.begin(), random_array.end());
+    EXPECT_TRUE(mystl::is_minmax_heap(random_array.begin(), random_array.end()));
+    EXPECT_EQ(random_array[0], -98);
+    EXPECT_EQ(*mystl::minmax_heap_max(random_array.begin(), random_array.end()), 96);
+
+    // 
+    mystl::make_minmax_heap(dup_elems.begin(), dup_elems.end());
+    EXPECT_TRUE(mystl::is_minmax_heap(dup_elems.begin(), dup_elems.end()));
+
+    // 
+    mystl::vector<int> not_heap = {5, 1, 9};
+    EXPECT_FALSE(mystl::is_minmax_heap(not_heap.begin(), not_heap.end()));
+}
+
+
+// Test `push_minmax_heap` against the minimum and maximum seen so far
+TEST_F(HeapFunctionTests, PushMinmaxHeap) {
+    // 
+    mystl::vector<int> heap;
+    for (size_t i = 0; i < random_array.size(); ++i) {
+        heap.push_back(random_array[i]);
+        mystl::push_minmax_heap(heap.begin(), heap.end());
+        ASSERT_TRUE(mystl::is_minmax_heap(heap.begin(), heap.end()));
+        EXPECT_EQ(heap[0], *std::min_element(random_array.begin(), random_array.begin() + i + 1));
+        EXPECT_EQ(*mystl::minmax_heap_max(heap.begin(), heap.end()),
+                  *std::max_element(random_array.begin(), random_array.begin() + i + 1));
+    }
+}
+
+
+// Test `pop_min` and `pop_max` from both ends until empty
+TEST_F(HeapFunctionTests, PopMinAndPopMax) {
+    // 
+    mystl::vector<int> sorted = random_array;
+    std::sort(sorted.begin(), sorted.end());
+    mystl::make_minmax_heap(random_array.begin(), random_array.end(), std::less<>());
+
+    // 
+    auto first = random_array.begin();
+    auto last = random_array.end();
+    size_t lo = 0, hi = sorted.size();
+    while (first != last) {
+        if ((hi - lo) % 2 == 0) {
+            mystl::pop_min(first, last, std::less<>());
+            EXPECT_EQ(*(--last), sorted[lo++]);
+        } else {
+            mystl::pop_max(first, last, std::less<>());
+            EXPECT_EQ(*(--last), sorted[--hi]);
+        }
+        ASSERT_TRUE(mystl::is_minmax_heap(first, last, std::less<>()));
+    }
+}
+
+
+// Test min-max heap with `std::greater` swapping the roles of both ends
+TEST_F(HeapFunctionTests, MinmaxHeapGreater) {
+    // 
+    mystl::make_minmax_heap(random_array.begin(), random_array.end(), std::greater<>());
+    EXPECT_TRUE(mystl::is_minmax_heap(random_array.begin(), random_array.end(), std::greater<>()));
+    EXPECT_EQ(random_array[0], 96);
+    EXPECT_EQ(*mystl::minmax_heap_max(random_array.begin(), random_array.end(), std::greater<>()), -98);
+}
+
+
+// Test that the B-heap page shape links every child back to its parent
+TEST_F(HeapFunctionTests, BHeapPageShape) {
+    // 7 ints per page, 8 child pages per page
+    using page = mystl::__b_heap_page<sizeof(int), 32>;
+    EXPECT_EQ(page::SIZE, 7u);
+    EXPECT_EQ(page::FANOUT, 8u);
+
+    // 
+    for (long pos = 0; pos < 1000; ++pos) {
+        long stride = 0;
+        long child = page::first_child(pos, stride);
+        EXPECT_EQ(page::parent(child), pos);
+        EXPECT_EQ(page::parent(child + stride), pos);
+        if (pos > 0) {
+            EXPECT_LT(page::parent(pos), pos);
+        }
+    }
+
+    // elements larger than a page degrade to one node per page, a binary heap
+    using tiny = mystl::__b_heap_page<64, 32>;
+    EXPECT_EQ(tiny::SIZE, 1u);
+    long stride = 0;
+    EXPECT_EQ(tiny::first_child(5L, stride), 11L);
+    EXPECT_EQ(stride, 1L);
+    EXPECT_EQ(tiny::parent(12L), 5L);
+}
+
+
+// Test `make_b_heap`, `push_b_heap` and `pop_b_heap` over several pages
+TEST_F(HeapFunctionTests, BHeapPushAndPop) {
+    // 
+    mystl::vector<int> heap;
+    for (size_t i = 0; i < random_array.size(); ++i) {
+        heap.push_back(random_array[i]);
+        mystl::push_b_heap<32>(heap.begin(), heap.end());
+        ASSERT_TRUE(mystl::is_b_heap<32>(heap.begin(), heap.end()));
+        EXPECT_EQ(heap[0], *std::max_element(random_array.begin(), random_array.begin() + i + 1));
+    }
+
+    // 
+    mystl::vector<int> sorted = random_array;
+    std::sort(sorted.begin(), sorted.end(), std::greater<>());
+    for (size_t i = 0; i < sorted.size(); ++i) {
+        mystl::pop_b_heap<32>(heap.begin(), heap.end());
+        EXPECT_EQ(heap.back(), sorted[i]);
+        heap.pop_back();
+        ASSERT_TRUE(mystl::is_b_heap<32>(heap.begin(), heap.end()));
+    }
+}
+
+
+// Test `make_b_heap` with `std::greater` on a heap of many pages
+TEST_F(HeapFunctionTests, MakeBHeapGreater) {
+    // 
+    mystl::vector<int> heap;
+    for (int i = 0; i < 5000; ++i)
+        heap.push_back((i * 7919) % 5003);
+    mystl::make_b_heap<64>(heap.begin(), heap.end(), std::greater<>());
+    EXPECT_TRUE(mystl::is_b_heap<64>(heap.begin(), heap.end(), std::greater<>()));
+    EXPECT_FALSE(mystl::is_heap(heap.begin(), heap.end(), std::greater<>()));
+
+    // 
+    auto last = heap.end();
+    int prev = heap[0];
+    while (last != heap.begin()) {
+        mystl::pop_b_heap<64>(heap.begin(), last, std::greater<>());
+        --last;
+        ASSERT_LE(prev, *last);
+        prev = *last;
+    }
+
+    // 
+    mystl::make_b_heap(dup_elems.begin(), dup_elems.end());
+    EXPECT_TRUE(mystl::is_b_heap(dup_elems.begin(), dup_elems.end()));
+}
+
+
+// Test `pop_heap_n` against repeated `pop_heap`
+TEST_F(HeapFunctionTests, PopHeapN) {
+    // 
+    mystl::vector<int> expected = max_heap;
+    for (int n = 0; n <= 20; ++n) {
+        mystl::vector<int> heap = max_heap;
+        mystl::pop_heap_n(heap.begin(), heap.end(), n);
+        EXPECT_TRUE(mystl::is_heap(heap.begin(), heap.end() - n));
+        EXPECT_TRUE(std::is_sorted(heap.end() - n, heap.end()));
+
+        // the same elements as `n` pops, in the same places
+        mystl::vector<int> popped = max_heap;
+        for (int i = 0; i < n; ++i)
+            std::pop_heap(popped.begin(), popped.end() - i);
+        EXPECT_TRUE(std::equal(heap.end() - n, heap.end(), popped.end() - n));
+    }
+
+    // 
+    mystl::pop_heap_n(min_heap.begin(), min_heap.end(), 5, std::greater<>());
+    EXPECT_TRUE(mystl::is_heap(min_heap.begin(), min_heap.end() - 5, std::greater<>()));
+    EXPECT_EQ(min_heap.back(), -98);
+
+    // 
+    mystl::pop_heap_n(dup_elems.begin(), dup_elems.end(), 20);
+    EXPECT_EQ(std::count(dup_elems.begin(), dup_elems.end(), 1), 20);
+}
+
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
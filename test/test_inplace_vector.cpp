@@ -0,0 +1,282 @@
+/**
+ * \file test/test_inplace_vector.cpp
+ */
+
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "inplace_vector.hpp"
+
+
+namespace {
+
+// Counts live instances to check that construction and destruction are
+// balanced. The value and copy constructors throw once `constructions_left`
+// (when not negative) of them succeeded.
+struct Tracked {
+    static inline int alive = 0;
+    static inline int constructions_left = -1;
+
+    Tracked(int v = 0) : value(v) { count_construction(); }
+    Tracked(const Tracked& other) : value(other.value) { count_construction(); }
+    Tracked(Tracked&& other) noexcept : value(other.value) { other.value = -1; ++alive; }
+    Tracked& operator=(const Tracked&) = default;
+    Tracked& operator=(Tracked&&) = default;
+    ~Tracked() { --alive; }
+
+    static void count_construction() {
+        if (constructions_left >= 0 && constructions_left-- == 0)
+            throw std::runtime_error("construction failed");
+        ++alive;
+    }
+
+    int value;
+};
+
+constexpr int constexpr_sum() {
+    mystl::inplace_vector<int, 8> vec = {1, 2, 3};
+    vec.push_back(4);
+    vec.erase(vec.begin());
+    vec.insert(vec.begin(), 10);
+
+    int sum = 0;
+    for (int x : vec)
+        sum += x;
+    return sum;
+}
+
+}
+
+
+/* Traits */
+TEST(InplaceVectorTest, TriviallyCopyableWhenElementIs) {
+    static_assert(std::is_trivially_copyable_v<mystl::inplace_vector<int, 4>>);
+    static_assert(std::is_trivially_destructible_v<mystl::inplace_vector<int, 4>>);
+    static_assert(!std::is_trivially_copyable_v<mystl::inplace_vector<std::string, 4>>);
+    static_assert(mystl::inplace_vector<int, 4>::capacity() == 4);
+}
+
+
+TEST(InplaceVectorTest, Constexpr) {
+    static_assert(constexpr_sum() == 19);
+    EXPECT_EQ(constexpr_sum(), 19);
+}
+
+
+TEST(InplaceVectorTest, StorageIsInline) {
+    mystl::inplace_vector<int, 16> vec;
+    const char* obj = reinterpret_cast<const char*>(&vec);
+    const char* data = reinterpret_cast<const char*>(vec.data());
+    EXPECT_GE(data, obj);
+    EXPECT_LT(data, obj + sizeof(vec));
+}
+
+
+/* Constructors */
+TEST(InplaceVectorTest, DefaultConstructorConstructsNothing) {
+    Tracked::alive = 0;
+    {
+        mystl::inplace_vector<Tracked, 32> vec;
+        EXPECT_EQ(vec.size(), 0);
+        EXPECT_EQ(Tracked::alive, 0);
+    }
+    EXPECT_EQ(Tracked::alive, 0);
+}
+
+
+TEST(InplaceVectorTest, ConstructByCount) {
+    mystl::inplace_vector<int, 8> vec(5, 7);
+    ASSERT_EQ(vec.size(), 5);
+    for (int x : vec)
+        EXPECT_EQ(x, 7);
+
+    mystl::inplace_vector<int, 8> zeros(3);
+    ASSERT_EQ(zeros.size(), 3);
+    for (int x : zeros)
+        EXPECT_EQ(x, 0);
+
+    EXPECT_THROW((mystl::inplace_vector<int, 8>(9, 1)), std::bad_alloc);
+}
+
+
+TEST(InplaceVectorTest, ConstructByRange) {
+    std::vector<std::string> src = {"a", "b", "c"};
+    mystl::inplace_vector<std::string, 4> vec(src.begin(), src.end());
+    ASSERT_EQ(vec.size(), 3);
+    for (size_t i = 0; i < src.size(); ++i)
+        EXPECT_EQ(vec[i], src[i]);
+
+    EXPECT_THROW((mystl::inplace_vector<std::string, 2>(src.begin(), src.end())), std::bad_alloc);
+}
+
+
+TEST(InplaceVectorTest, CopyAndMove) {
+    mystl::inplace_vector<std::string, 4> vec = {"one", "two"};
+
+    mystl::inplace_vector<std::string, 4> copied(vec);
+    ASSERT_EQ(copied.size(), 2);
+    EXPECT_EQ(copied[1], "two");
+    copied[1] = "changed";
+    EXPECT_EQ(vec[1], "two");
+
+    mystl::inplace_vector<std::string, 4> moved(std::move(copied));
+    ASSERT_EQ(moved.size(), 2);
+    EXPECT_EQ(moved[1], "changed");
+
+    mystl::inplace_vector<std::string, 4> assigned;
+    assigned = vec;
+    EXPECT_EQ(assigned[0], "one");
+    assigned = std::move(moved);
+    EXPECT_EQ(assigned[1], "changed");
+}
+
+
+/* Element access */
+TEST(InplaceVectorTest, ElementAccess) {
+    mystl::inplace_vector<int, 4> vec = {1, 2, 3};
+    EXPECT_EQ(vec.front(), 1);
+    EXPECT_EQ(vec.back(), 3);
+    EXPECT_EQ(vec.at(1), 2);
+    EXPECT_THROW(vec.at(3), std::out_of_range);
+
+    mystl::inplace_vector<int, 4> empty;
+    EXPECT_THROW(empty.front(), std::out_of_range);
+    EXPECT_THROW(empty.back(), std::out_of_range);
+}
+
+
+/* Modifiers */
+TEST(InplaceVectorTest, PushBackOverflowThrows) {
+    mystl::inplace_vector<int, 2> vec;
+    vec.push_back(1);
+    vec.push_back(2);
+    EXPECT_TRUE(vec.full());
+    EXPECT_THROW(vec.push_back(3), std::bad_alloc);
+    EXPECT_EQ(vec.size(), 2);
+}
+
+
+TEST(InplaceVectorTest, TryPushBack) {
+    mystl::inplace_vector<std::string, 2> vec;
+    std::string* p = vec.try_push_back("a");
+    ASSERT_NE(p, nullptr);
+    EXPECT_EQ(*p, "a");
+    EXPECT_NE(vec.try_emplace_back(3, 'b'), nullptr);
+
+    // full: the argument must not be moved from
+    std::string value = "c";
+    EXPECT_EQ(vec.try_push_back(std::move(value)), nullptr);
+    EXPECT_EQ(value, "c");
+    EXPECT_EQ(vec.size(), 2);
+    EXPECT_EQ(vec[1], "bbb");
+}
+
+
+TEST(InplaceVectorTest, InsertAndErase) {
+    mystl::inplace_vector<int, 8> vec = {1, 2, 4};
+    auto it = vec.insert(vec.begin() + 2, 3);
+    EXPECT_EQ(*it, 3);
+    vec.emplace(vec.begin(), 0);
+    vec.insert(vec.end(), 5);
+    EXPECT_EQ(vec.size(), 6);
+    for (int i = 0; i < 6; ++i)
+        EXPECT_EQ(vec[i], i);
+
+    it = vec.erase(vec.begin() + 1);
+    EXPECT_EQ(*it, 2);
+    it = vec.erase(vec.begin() + 1, vec.begin() + 3);
+    EXPECT_EQ(*it, 4);
+    ASSERT_EQ(vec.size(), 3);
+    EXPECT_EQ(vec[0], 0);
+    EXPECT_EQ(vec[1], 4);
+    EXPECT_EQ(vec[2], 5);
+
+    mystl::inplace_vector<int, 1> full = {1};
+    EXPECT_THROW(full.insert(full.begin(), 0), std::bad_alloc);
+}
+
+
+TEST(InplaceVectorTest, LifetimesAreBalanced) {
+    Tracked::alive = 0;
+    {
+        mystl::inplace_vector<Tracked, 8> vec;
+        for (int i = 0; i < 6; ++i)
+            vec.emplace_back(i);
+        EXPECT_EQ(Tracked::alive, 6);
+
+        vec.insert(vec.begin(), Tracked(100));
+        EXPECT_EQ(Tracked::alive, 7);
+        EXPECT_EQ(vec[0].value, 100);
+        EXPECT_EQ(vec[1].value, 0);
+
+        vec.erase(vec.begin(), vec.begin() + 3);
+        vec.pop_back();
+        EXPECT_EQ(Tracked::alive, 3);
+
+        vec.resize(5);
+        EXPECT_EQ(Tracked::alive, 5);
+        vec.resize(1);
+        EXPECT_EQ(Tracked::alive, 1);
+    }
+    EXPECT_EQ(Tracked::alive, 0);
+}
+
+
+TEST(InplaceVectorTest, ThrowingConstructionReleasesBuiltElements) {
+    Tracked::alive = 0;
+    const std::vector<Tracked> source = {1, 2, 3, 4, 5};
+    mystl::inplace_vector<Tracked, 8> full(source.begin(), source.end());
+    ASSERT_EQ(Tracked::alive, 10);
+
+    // an element constructor throws partway
+    Tracked::constructions_left = 2;
+    EXPECT_THROW((mystl::inplace_vector<Tracked, 8>(4)), std::runtime_error);
+    Tracked::constructions_left = 2;
+    EXPECT_THROW((mystl::inplace_vector<Tracked, 8>(4, Tracked(7))), std::runtime_error);
+    Tracked::constructions_left = 2;
+    EXPECT_THROW((mystl::inplace_vector<Tracked, 8>(source.begin(), source.end())), std::runtime_error);
+    Tracked::constructions_left = 2;
+    EXPECT_THROW((mystl::inplace_vector<Tracked, 8>(full)), std::runtime_error);
+    Tracked::constructions_left = -1;
+    EXPECT_EQ(Tracked::alive, 10);
+
+    // the range is longer than the capacity
+    EXPECT_THROW((mystl::inplace_vector<Tracked, 3>(source.begin(), source.end())), std::bad_alloc);
+    EXPECT_EQ(Tracked::alive, 10);
+
+    // the assignment keeps the elements built so far
+    mystl::inplace_vector<Tracked, 8> target = {Tracked(0)};
+    Tracked::constructions_left = 2;
+    EXPECT_THROW(target = full, std::runtime_error);
+    Tracked::constructions_left = -1;
+    EXPECT_EQ(target.size(), 2);
+    EXPECT_EQ(Tracked::alive, 12);
+}
+
+
+TEST(InplaceVectorTest, PopBackEmptyThrows) {
+    mystl::inplace_vector<int, 2> vec;
+    EXPECT_THROW(vec.pop_back(), std::length_error);
+}
+
+
+TEST(InplaceVectorTest, Swap) {
+    mystl::inplace_vector<std::string, 4> a = {"a", "b", "c"};
+    mystl::inplace_vector<std::string, 4> b = {"x"};
+    swap(a, b);
+    ASSERT_EQ(a.size(), 1);
+    ASSERT_EQ(b.size(), 3);
+    EXPECT_EQ(a[0], "x");
+    EXPECT_EQ(b[2], "c");
+}
+
+
+TEST(InplaceVectorTest, ReserveBeyondCapacityThrows) {
+    mystl::inplace_vector<int, 4> vec;
+    EXPECT_NO_THROW(vec.reserve(4));
+    EXPECT_THROW(vec.reserve(5), std::bad_alloc);
+}
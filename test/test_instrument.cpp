@@ -0,0 +1,160 @@
+/**
+ * \file test/test_instrument.cpp
+ */
+
+#define MYSTL_INSTRUMENT 1
+
+#include <string>
+#include <thread>
+#include <gtest/gtest.h>
+
+#include "instrument.hpp"
+#include "vector.hpp"
+#include "inplace_vector.hpp"
+#include "list.hpp"
+#include "forward_list.hpp"
+#include "algorithm/push_heap.hpp"
+#include "algorithm/pop_heap.hpp"
+
+using mystl::instrument::event;
+
+
+namespace {
+
+// The hooks must stay usable in constant expressions.
+constexpr int constexpr_heap_top() {
+    mystl::inplace_vector<int, 4> heap;
+    for (int v : {1, 3, 2}) {
+        heap.push_back(v);
+        mystl::push_heap(heap.begin(), heap.end());
+    }
+    heap.emplace(heap.begin(), 0);
+    return heap[1];
+}
+
+}
+
+static_assert(mystl::instrument::enabled);
+static_assert(constexpr_heap_top() == 3);
+
+
+TEST(InstrumentTest, VectorReallocsAndShifts) {
+    mystl::vector<int> vec;
+    mystl::instrument::reset();
+
+    // the default capacity is 10, the 11th element reallocates
+    for (int i = 0; i < 11; ++i)
+        vec.push_back(i);
+    EXPECT_EQ(mystl::instrument::snapshot()[event::vector_reallocs], 1u);
+
+    //
+    vec.emplace(vec.cbegin() + 1, 42);
+    EXPECT_EQ(mystl::instrument::snapshot()[event::vector_shifted], 10u);
+    vec.erase(vec.cbegin() + 2);
+    EXPECT_EQ(mystl::instrument::snapshot()[event::vector_shifted], 19u);
+    vec.erase(vec.cbegin(), vec.cbegin() + 4);
+    EXPECT_EQ(mystl::instrument::snapshot()[event::vector_shifted], 26u);
+    EXPECT_EQ(vec.size(), 7u);
+    EXPECT_EQ(vec[0], 4);
+}
+
+
+TEST(InstrumentTest, InplaceVectorShifts) {
+    mystl::inplace_vector<int, 8> vec = {1, 2, 3, 4};
+    mystl::instrument::reset();
+
+    vec.emplace(vec.cbegin(), 0);
+    vec.erase(vec.cbegin() + 1, vec.cbegin() + 3);
+    EXPECT_EQ(mystl::instrument::snapshot()[event::inplace_vector_shifted], 4u + 2u);
+    EXPECT_EQ(mystl::instrument::snapshot()[event::vector_shifted], 0u);
+}
+
+
+TEST(InstrumentTest, ListNodeAllocs) {
+    mystl::instrument::reset();
+    {
+        mystl::list<int> list;
+        list.push_back(1);
+        list.push_front(0);
+        list.emplace_back(2);
+        list.pop_front();
+
+        // the sentinel is a node too
+        mystl::instrument::counters counts = mystl::instrument::snapshot();
+        EXPECT_EQ(counts[event::list_node_allocs], 4u);
+        EXPECT_EQ(counts[event::list_node_frees], 1u);
+    }
+    mystl::instrument::counters counts = mystl::instrument::snapshot();
+    EXPECT_EQ(counts[event::list_node_frees], 4u);
+    EXPECT_EQ(counts[event::forward_list_node_allocs], 0u);
+}
+
+
+TEST(InstrumentTest, ForwardListNodeAllocs) {
+    mystl::instrument::reset();
+    {
+        mystl::forward_list<int> list;
+        list.push_front(1);
+        list.push_front(2);
+    }
+    mystl::instrument::counters counts = mystl::instrument::snapshot();
+    EXPECT_EQ(counts[event::forward_list_node_allocs], counts[event::forward_list_node_frees]);
+    EXPECT_GE(counts[event::forward_list_node_allocs], 2u);
+    EXPECT_EQ(counts[event::list_node_allocs], 0u);
+}
+
+
+TEST(InstrumentTest, HeapSiftLevels) {
+    mystl::vector<int> heap;
+    heap.reserve(16);
+    mystl::instrument::reset();
+
+    // each push climbs to the root
+    for (int v : {1, 2, 3, 4}) {
+        heap.push_back(v);
+        mystl::push_heap(heap.begin(), heap.end());
+    }
+    EXPECT_EQ(mystl::instrument::snapshot()[event::heap_sift_levels], 0u + 1u + 1u + 2u);
+
+    //
+    mystl::instrument::reset();
+    mystl::pop_heap(heap.begin(), heap.end());
+    EXPECT_GE(mystl::instrument::snapshot()[event::heap_sift_levels], 1u);
+}
+
+
+TEST(InstrumentTest, ThreadLocal) {
+    mystl::instrument::reset();
+    std::thread([] {
+        mystl::instrument::add(event::vector_reallocs, 5);
+        EXPECT_EQ(mystl::instrument::snapshot()[event::vector_reallocs], 5u);
+    }).join();
+    EXPECT_EQ(mystl::instrument::snapshot()[event::vector_reallocs], 0u);
+}
+
+
+TEST(InstrumentTest, Exporters) {
+    mystl::instrument::reset();
+    mystl::instrument::add(event::vector_reallocs, 3);
+    mystl::instrument::add(event::heap_sift_levels, 7);
+    mystl::instrument::counters counts = mystl::instrument::snapshot();
+
+    //
+    std::string text = mystl::instrument::to_text(counts);
+    EXPECT_NE(text.find("vector.reallocs 3\n"), std::string::npos);
+    EXPECT_NE(text.find("heap.sift_levels 7\n"), std::string::npos);
+
+    //
+    EXPECT_EQ(mystl::instrument::to_json(counts),
+              "{\"vector\":{\"reallocs\":3,\"shifted\":0},"
+              "\"inplace_vector\":{\"shifted\":0},"
+              "\"list\":{\"node_allocs\":0,\"node_frees\":0},"
+              "\"forward_list\":{\"node_allocs\":0,\"node_frees\":0},"
+              "\"heap\":{\"sift_levels\":7}}");
+}
+
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
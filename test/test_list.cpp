@@ -11,6 +11,27 @@
 
 #include "list.hpp"
 
+
+namespace {
+
+// Element whose copy constructor throws once `copies_left` copies were made.
+struct ThrowingCopy {
+    static inline int alive = 0;
+    static inline int copies_left = 0;
+
+    ThrowingCopy(int v = 0) : value(v) { ++alive; }
+    ThrowingCopy(const ThrowingCopy& other) : value(other.value) {
+        if (copies_left-- == 0)
+            throw std::runtime_error("copy failed");
+        ++alive;
+    }
+    ~ThrowingCopy() { --alive; }
+
+    int value;
+};
+
+}
+
 /* Constructors and Destructors */
 TEST(ListTest, DefaultConstructorAndDestructor) {
     mystl::list<int> list;
@@ -396,6 +417,67 @@ TEST(ListTest, InsertByInitializerList) {
 }
 
 
+TEST(ListTest, InsertEmptyRange) {
+    // 
+    mystl::list<int> list = {1, 2};
+    std::vector<int> empty;
+
+    // 
+    auto it = list.insert(list.cend(), empty.begin(), empty.end());
+    EXPECT_TRUE(it == list.end());
+    it = list.insert(list.cbegin(), 0, 5);
+    EXPECT_EQ(*it, 1);
+    EXPECT_EQ(list.size(), 2);
+}
+
+
+TEST(ListTest, InsertByCountLinksBothDirections) {
+    // 
+    mystl::list<int> list = {1, 5};
+    auto pos = list.cbegin();
+    ++pos;
+
+    // 
+    auto it = list.insert(pos, 3, 7);
+    EXPECT_EQ(*it, 7);
+    EXPECT_EQ(list.size(), 5);
+    EXPECT_EQ(std::vector<int>(list.begin(), list.end()), (std::vector<int>{1, 7, 7, 7, 5}));
+    EXPECT_EQ(std::vector<int>(list.rbegin(), list.rend()), (std::vector<int>{5, 7, 7, 7, 1}));
+}
+
+
+TEST(ListTest, InsertByRangeStrongGuarantee) {
+    // 
+    ThrowingCopy::alive = 0;
+    {
+        mystl::list<ThrowingCopy> list;
+        list.emplace_back(1);
+        list.emplace_back(2);
+        std::vector<ThrowingCopy> src(5);
+        int alive = ThrowingCopy::alive;
+
+        // the third copy throws: nothing must be inserted nor leaked
+        ThrowingCopy::copies_left = 2;
+        EXPECT_THROW(list.insert(list.cbegin(), src.begin(), src.end()), std::runtime_error);
+        EXPECT_EQ(list.size(), 2);
+        EXPECT_EQ(list.front().value, 1);
+        EXPECT_EQ(list.back().value, 2);
+        EXPECT_EQ(ThrowingCopy::alive, alive);
+
+        ThrowingCopy::copies_left = 1;
+        EXPECT_THROW(list.insert(list.cend(), 4, src[0]), std::runtime_error);
+        EXPECT_EQ(list.size(), 2);
+        EXPECT_EQ(ThrowingCopy::alive, alive);
+
+        // a throwing copy constructor must not leak the copied nodes either
+        ThrowingCopy::copies_left = 1;
+        EXPECT_THROW(mystl::list<ThrowingCopy> copy(list), std::runtime_error);
+        EXPECT_EQ(ThrowingCopy::alive, alive);
+    }
+    EXPECT_EQ(ThrowingCopy::alive, 0);
+}
+
+
 TEST(ListTest, Emplace) {
     // 
     mystl::list<std::pair<int, int>> list;
@@ -839,6 +921,57 @@ TEST(ListTest, Splice) {
 }
 
 
+TEST(ListTest, SpliceSingleElement) {
+    mystl::list<int> list1 = {1, 2, 3};
+    mystl::list<int> list2 = {4, 5, 6};
+
+    // move '5' after '1'
+    list1.splice(list1.cbegin(), list2, std::next(list2.cbegin()));
+    EXPECT_EQ(std::vector<int>(list1.begin(), list1.end()), (std::vector<int>{1, 5, 2, 3}));
+    EXPECT_EQ(std::vector<int>(list2.begin(), list2.end()), (std::vector<int>{4, 6}));
+    EXPECT_EQ(list1.size(), 4);
+    EXPECT_EQ(list2.size(), 2);
+
+    // within the same list: move '3' after '1'
+    list1.splice(list1.cbegin(), list1, std::prev(list1.cend()));
+    EXPECT_EQ(std::vector<int>(list1.begin(), list1.end()), (std::vector<int>{1, 3, 5, 2}));
+    EXPECT_EQ(list1.size(), 4);
+
+    // splicing an element after itself or after its predecessor is a no-op
+    list1.splice(list1.cbegin(), list1, list1.cbegin());
+    list1.splice(list1.cbegin(), list1, std::next(list1.cbegin()));
+    EXPECT_EQ(std::vector<int>(list1.begin(), list1.end()), (std::vector<int>{1, 3, 5, 2}));
+}
+
+
+TEST(ListTest, SpliceRange) {
+    mystl::list<int> list1 = {1, 2, 3};
+    mystl::list<int> list2 = {4, 5, 6, 7};
+
+    // move [5, 7) after '2'
+    auto first = std::next(list2.cbegin());
+    auto last = std::prev(list2.cend());
+    auto moved = first;
+    list1.splice(std::next(list1.cbegin()), list2, first, last);
+    EXPECT_EQ(std::vector<int>(list1.begin(), list1.end()), (std::vector<int>{1, 2, 5, 6, 3}));
+    EXPECT_EQ(std::vector<int>(list2.begin(), list2.end()), (std::vector<int>{4, 7}));
+    EXPECT_EQ(list1.size(), 5);
+    EXPECT_EQ(list2.size(), 2);
+    EXPECT_EQ(*moved, 5);   // iterators stay valid
+
+    // within the same list: move [1, 2] to the back
+    list1.splice(std::prev(list1.cend()), list1, list1.cbegin(), std::next(list1.cbegin(), 2));
+    EXPECT_EQ(std::vector<int>(list1.begin(), list1.end()), (std::vector<int>{5, 6, 3, 1, 2}));
+    EXPECT_EQ(list1.size(), 5);
+    EXPECT_EQ(std::vector<int>(list1.rbegin(), list1.rend()), (std::vector<int>{2, 1, 3, 6, 5}));
+
+    // empty range
+    list1.splice(list1.cbegin(), list2, list2.cbegin(), list2.cbegin());
+    EXPECT_EQ(list1.size(), 5);
+    EXPECT_EQ(list2.size(), 2);
+}
+
+
 TEST(ListTest, Remove) {
     // 
     mystl::list<int> list = {1, 2, 3, 2, 4, 2, 5};
@@ -976,6 +1109,17 @@ TEST(ListTest, Sort) {
 }
 
 
+TEST(ListTest, SortStrings) {
+    mystl::list<std::string> list = {"pear", "apple", "fig", "banana"};
+    list.sort();
+
+    //
+    std::vector<std::string> sorted = {"apple", "banana", "fig", "pear"};
+    EXPECT_EQ(std::vector<std::string>(list.cbegin(), list.cend()), sorted);
+    EXPECT_EQ(list.back(), "pear");
+}
+
+
 /**
  * Test Case: Test for bidirectional_iterator concept in C++20
  */
@@ -986,7 +1130,77 @@ TEST(ListTest, BidirectionalIteratorCategoryTest) {
 
 
 /**/
+
+TEST(ListTest, MemoryFootprint) {
+    mystl::list<int> list;
+    std::size_t node_bytes = list.allocated_bytes();   // the sentinel
+    EXPECT_GE(node_bytes, sizeof(int) + 2 * sizeof(void*));
+    EXPECT_EQ(list.overhead_bytes(), sizeof(list) + node_bytes);
+
+    //
+    for (int i = 0; i < 10; ++i)
+        list.push_back(i);
+    EXPECT_EQ(list.allocated_bytes(), 11 * node_bytes);
+    EXPECT_EQ(list.memory_footprint(), sizeof(list) + 11 * node_bytes);
+    EXPECT_EQ(list.overhead_bytes(), list.memory_footprint() - 10 * sizeof(int));
+}
+
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
 }
+
+
+/* Node handles */
+TEST(ListTest, ExtractAndInsertNode) {
+    mystl::list<std::string> list1 = {"a", "b", "c"};
+    mystl::list<std::string> list2 = {"x"};
+
+    // references survive the move between lists
+    const std::string* addr = &*std::next(list1.begin());
+    auto nh = list1.extract(std::next(list1.cbegin()));
+    ASSERT_FALSE(nh.empty());
+    EXPECT_TRUE(static_cast<bool>(nh));
+    EXPECT_EQ(nh.value(), "b");
+    EXPECT_EQ(&nh.value(), addr);
+    EXPECT_EQ(list1.size(), 2);
+    EXPECT_EQ(std::vector<std::string>(list1.begin(), list1.end()), (std::vector<std::string>{"a", "c"}));
+
+    nh.value() = "B";
+    auto it = list2.insert(list2.cbegin(), std::move(nh));
+    EXPECT_TRUE(nh.empty());
+    EXPECT_EQ(&*it, addr);
+    EXPECT_EQ(list2.size(), 2);
+    EXPECT_EQ(std::vector<std::string>(list2.begin(), list2.end()), (std::vector<std::string>{"B", "x"}));
+    EXPECT_EQ(std::vector<std::string>(list2.rbegin(), list2.rend()), (std::vector<std::string>{"x", "B"}));
+
+    // inserting an empty handle is a no-op
+    it = list2.insert(list2.cend(), decltype(list2)::node_type());
+    EXPECT_EQ(it, list2.end());
+    EXPECT_EQ(list2.size(), 2);
+
+    EXPECT_THROW(list2.extract(list2.cend()), std::out_of_range);
+}
+
+
+TEST(ListTest, NodeHandleOwnsNode) {
+    ThrowingCopy::alive = 0;
+    {
+        mystl::list<ThrowingCopy> list;
+        list.emplace_back(1);
+        list.emplace_back(2);
+        int before = ThrowingCopy::alive;
+
+        // a handle that is dropped frees its element
+        {
+            auto nh = list.extract(list.cbegin());
+            EXPECT_EQ(ThrowingCopy::alive, before);
+            decltype(nh) other;
+            other = std::move(nh);
+            EXPECT_TRUE(nh.empty());
+            EXPECT_FALSE(other.empty());
+        }
+        EXPECT_EQ(ThrowingCopy::alive, before - 1);
+        EXPECT_EQ(list.size(), 1);
+    }
+}
@@ -0,0 +1,152 @@
+/**
+ * \file test/test_lru_cache.cpp
+ */
+
+#include <list>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <gtest/gtest.h>
+
+#include "lru_cache.hpp"
+
+
+/* Lookup */
+TEST(LruCacheTest, GetAndPeek) {
+    mystl::lru_cache<int, std::string> cache(2);
+    EXPECT_TRUE(cache.empty());
+    EXPECT_EQ(cache.get(1), nullptr);
+
+    cache.put(1, "one");
+    cache.put(2, "two");
+    ASSERT_NE(cache.get(1), nullptr);
+    EXPECT_EQ(*cache.get(1), "one");
+    EXPECT_EQ(*cache.peek(2), "two");
+    EXPECT_TRUE(cache.contains(2));
+    EXPECT_FALSE(cache.contains(3));
+}
+
+
+/* Eviction */
+TEST(LruCacheTest, EvictsLeastRecentlyUsed) {
+    mystl::lru_cache<int, int> cache(3);
+    cache.put(1, 10);
+    cache.put(2, 20);
+    cache.put(3, 30);
+
+    // 1 becomes most recent, 2 is now the oldest
+    cache.get(1);
+    cache.put(4, 40);
+    EXPECT_EQ(cache.size(), 3);
+    EXPECT_FALSE(cache.contains(2));
+    EXPECT_TRUE(cache.contains(1));
+
+    // peek does not refresh 3
+    cache.peek(3);
+    cache.put(5, 50);
+    EXPECT_FALSE(cache.contains(3));
+    EXPECT_TRUE(cache.contains(4));
+    EXPECT_TRUE(cache.contains(5));
+}
+
+
+TEST(LruCacheTest, PutUpdatesAndRefreshes) {
+    mystl::lru_cache<int, int> cache(2);
+    cache.put(1, 10);
+    cache.put(2, 20);
+    cache.put(1, 11);
+    cache.put(3, 30);
+    EXPECT_EQ(*cache.peek(1), 11);
+    EXPECT_FALSE(cache.contains(2));
+}
+
+
+TEST(LruCacheTest, WeightedCapacity) {
+    auto weigher = [](int, const std::string& s) { return s.size(); };
+    mystl::lru_cache<int, std::string, std::hash<int>, std::equal_to<int>, decltype(weigher)> cache(10, {}, {}, weigher);
+
+    EXPECT_TRUE(cache.put(1, "aaaa"));
+    EXPECT_TRUE(cache.put(2, "bbbb"));
+    EXPECT_EQ(cache.weight(), 8);
+
+    // needs both older entries gone
+    EXPECT_TRUE(cache.put(3, "cccccccc"));
+    EXPECT_EQ(cache.size(), 1);
+    EXPECT_EQ(cache.weight(), 8);
+
+    // too heavy on its own
+    EXPECT_FALSE(cache.put(4, "ddddddddddd"));
+    EXPECT_FALSE(cache.contains(4));
+    EXPECT_FALSE(cache.put(3, "ddddddddddd"));
+    EXPECT_TRUE(cache.empty());
+    EXPECT_EQ(cache.weight(), 0);
+}
+
+
+/* Modifiers */
+TEST(LruCacheTest, EraseAndClear) {
+    mystl::lru_cache<int, int> cache(4);
+    for (int i = 0; i < 4; ++i)
+        cache.put(i, i);
+    EXPECT_TRUE(cache.erase(2));
+    EXPECT_FALSE(cache.erase(2));
+    EXPECT_EQ(cache.size(), 3);
+    EXPECT_FALSE(cache.contains(2));
+    EXPECT_TRUE(cache.contains(3));
+
+    cache.clear();
+    EXPECT_TRUE(cache.empty());
+    cache.put(7, 7);
+    EXPECT_EQ(*cache.get(7), 7);
+}
+
+
+TEST(LruCacheTest, MatchesReferenceModel) {
+    const int capacity = 64;
+    mystl::lru_cache<int, int> cache(capacity);
+    std::list<std::pair<int, int>> order;
+    std::unordered_map<int, std::list<std::pair<int, int>>::iterator> model;
+
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> key(0, 255);
+    for (int step = 0; step < 20000; ++step) {
+        int k = key(rng);
+        switch (rng() % 3) {
+        case 0: {
+            auto found = model.find(k);
+            int* value = cache.get(k);
+            ASSERT_EQ(value != nullptr, found != model.end());
+            if (value) {
+                EXPECT_EQ(*value, found->second->second);
+                order.splice(order.begin(), order, found->second);
+            }
+            break;
+        }
+        case 1: {
+            cache.put(k, step);
+            auto found = model.find(k);
+            if (found != model.end()) {
+                found->second->second = step;
+                order.splice(order.begin(), order, found->second);
+            } else {
+                if (static_cast<int>(order.size()) == capacity) {
+                    model.erase(order.back().first);
+                    order.pop_back();
+                }
+                order.emplace_front(k, step);
+                model[k] = order.begin();
+            }
+            break;
+        }
+        default: {
+            auto found = model.find(k);
+            ASSERT_EQ(cache.erase(k), found != model.end());
+            if (found != model.end()) {
+                order.erase(found->second);
+                model.erase(found);
+            }
+        }
+        }
+        ASSERT_EQ(cache.size(), order.size());
+    }
+}
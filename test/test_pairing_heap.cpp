@@ -0,0 +1,225 @@
+/**
+ * \file test/test_pairing_heap.cpp
+ */
+
+#include <functional>
+#include <memory>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "pairing_heap.hpp"
+
+
+/* Basics */
+TEST(PairingHeapTest, MaxHeapByDefault) {
+    mystl::pairing_heap<int> heap;
+    EXPECT_TRUE(heap.empty());
+    for (int v : {5, 1, 9, 3, 9, 7})
+        heap.push(v);
+    EXPECT_EQ(heap.size(), 6);
+
+    std::vector<int> popped;
+    while (!heap.empty()) {
+        popped.push_back(heap.top());
+        heap.pop();
+    }
+    EXPECT_EQ(popped, (std::vector<int>{9, 9, 7, 5, 3, 1}));
+}
+
+
+TEST(PairingHeapTest, EmplaceReturnsHandle) {
+    mystl::pairing_heap<std::string, std::greater<std::string>> heap;
+    auto h = heap.emplace(3, 'b');
+    heap.push("c");
+    EXPECT_EQ(*h, "bbb");
+    EXPECT_EQ(h->size(), 3);
+    EXPECT_EQ(heap.top(), "bbb");
+}
+
+
+/* Meld */
+TEST(PairingHeapTest, Meld) {
+    mystl::pairing_heap<int, std::greater<int>> a, b;
+    for (int i = 0; i < 10; i += 2)
+        a.push(i);
+    auto h = b.push(100);
+    for (int i = 1; i < 10; i += 2)
+        b.push(i);
+
+    a.meld(b);
+    EXPECT_TRUE(b.empty());
+    EXPECT_EQ(a.size(), 11);
+
+    // handles follow their elements into the melded heap
+    a.decrease_key(h, -1);
+    EXPECT_EQ(a.top(), -1);
+    a.pop();
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_EQ(a.top(), i);
+        a.pop();
+    }
+    EXPECT_TRUE(a.empty());
+
+    // the emptied heap is still usable
+    b.push(4);
+    EXPECT_EQ(b.top(), 4);
+}
+
+
+/* Handles */
+TEST(PairingHeapTest, DecreaseKeyAndErase) {
+    mystl::pairing_heap<int, std::greater<int>> heap;
+    std::vector<mystl::pairing_heap<int, std::greater<int>>::handle> handles;
+    for (int i = 0; i < 20; ++i)
+        handles.push_back(heap.push(100 + i));
+    heap.pop();   // forces some structure below the root
+
+    heap.decrease_key(handles[15], 1);
+    EXPECT_EQ(heap.top(), 1);
+    heap.erase(handles[15]);
+    heap.erase(handles[7]);
+    heap.erase(handles[19]);
+    EXPECT_EQ(heap.size(), 16);
+
+    std::vector<int> popped;
+    while (!heap.empty()) {
+        popped.push_back(heap.top());
+        heap.pop();
+    }
+    std::vector<int> expected;
+    for (int i = 1; i < 20; ++i)
+        if (i != 7 && i != 15 && i != 19)
+            expected.push_back(100 + i);
+    EXPECT_EQ(popped, expected);
+}
+
+
+TEST(PairingHeapTest, MoveAndSwap) {
+    mystl::pairing_heap<int> a;
+    a.push(1);
+    a.push(2);
+    mystl::pairing_heap<int> b(std::move(a));
+    EXPECT_TRUE(a.empty());
+    EXPECT_EQ(b.top(), 2);
+
+    a.push(10);
+    swap(a, b);
+    EXPECT_EQ(a.size(), 2);
+    EXPECT_EQ(b.top(), 10);
+
+    a = std::move(b);
+    EXPECT_EQ(a.top(), 10);
+    a.clear();
+    EXPECT_TRUE(a.empty());
+    a.push(3);
+    EXPECT_EQ(a.top(), 3);
+}
+
+
+TEST(PairingHeapTest, EmptyHeapThrows) {
+    mystl::pairing_heap<int> heap;
+    EXPECT_THROW(heap.top(), std::out_of_range);
+    EXPECT_THROW(heap.pop(), std::length_error);
+    heap.push(1);
+    heap.pop();
+    EXPECT_THROW(heap.top(), std::out_of_range);
+    EXPECT_THROW(heap.pop(), std::length_error);
+}
+
+
+TEST(PairingHeapTest, PooledNodesReleaseTheirElements) {
+    auto payload = std::make_shared<int>(7);
+    mystl::pairing_heap<std::shared_ptr<int>> heap;
+    heap.push(payload);
+    auto h = heap.push(payload);
+    heap.push(payload);
+    EXPECT_EQ(payload.use_count(), 4);
+
+    // popped, erased and cleared elements are destroyed right away
+    heap.pop();
+    EXPECT_EQ(payload.use_count(), 3);
+    heap.erase(h);
+    EXPECT_EQ(payload.use_count(), 2);
+    heap.clear();
+    EXPECT_EQ(payload.use_count(), 1);
+
+    // and pooled nodes are reused
+    heap.push(payload);
+    EXPECT_EQ(payload.use_count(), 2);
+}
+
+
+TEST(PairingHeapTest, NonAssignableElements) {
+    struct key {
+        const int value;
+        bool operator<(const key& other) const { return value < other.value; }
+    };
+    mystl::pairing_heap<key> heap;
+    heap.emplace(key{1});
+    heap.emplace(key{3});
+    heap.pop();
+    heap.emplace(key{2});   // reuses the pooled node
+    EXPECT_EQ(heap.top().value, 2);
+}
+
+
+TEST(PairingHeapTest, ClearLongChain) {
+    // ascending pushes into a max heap chain every node below the next one
+    mystl::pairing_heap<int> heap;
+    for (int i = 0; i < 200'000; ++i)
+        heap.push(i);
+    heap.clear();
+    EXPECT_TRUE(heap.empty());
+    heap.push(5);
+    EXPECT_EQ(heap.top(), 5);
+}
+
+
+TEST(PairingHeapTest, MatchesMultiset) {
+    using heap_type = mystl::pairing_heap<std::pair<int, int>, std::greater<std::pair<int, int>>>;
+    heap_type heap;
+    std::vector<heap_type::handle> handles;
+    std::vector<std::pair<int, int>> values;
+    std::vector<bool> alive;
+    std::multiset<std::pair<int, int>> reference;
+
+    std::mt19937 rng(9);
+    for (int step = 0; step < 20000; ++step) {
+        int op = rng() % 5;
+        if (reference.empty() || op <= 1) {
+            int id = int(handles.size());
+            std::pair<int, int> v{int(rng() % 100000), id};
+            handles.push_back(heap.push(v));
+            values.push_back(v);
+            alive.push_back(true);
+            reference.insert(v);
+        } else if (op == 2) {
+            int id = int(heap.top().second);
+            ASSERT_EQ(heap.top(), *reference.begin());
+            heap.pop();
+            reference.erase(reference.begin());
+            alive[id] = false;
+        } else {
+            int id = int(rng() % handles.size());
+            if (!alive[id])
+                continue;
+            reference.erase(reference.find(values[id]));
+            if (op == 3) {
+                values[id].first -= int(rng() % 1000);
+                heap.decrease_key(handles[id], values[id]);
+                reference.insert(values[id]);
+            } else {
+                heap.erase(handles[id]);
+                alive[id] = false;
+            }
+        }
+        ASSERT_EQ(heap.size(), reference.size());
+        if (!reference.empty()) {
+            ASSERT_EQ(heap.top(), *reference.begin());
+        }
+    }
+}
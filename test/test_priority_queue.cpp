@@ -2,7 +2,11 @@
  * \brief test_priority_queue.cpp
  */
 
+#include <algorithm>
 #include <functional>
+#include <iterator>
+#include <string>
+#include <vector>
 #include <gtest/gtest.h>
 
 #include "vector.hpp"
@@ -402,6 +406,142 @@ TEST_F(PriorityQueueTests, MinHeapMoveAssignment) {
     }
 }
 
+// 
+TEST_F(PriorityQueueTests, PopValueMovesTopOut) {
+    // 
+    mystl::priority_queue<std::string> heap;
+    heap.push(std::string(100, 'a'));
+    heap.push(std::string(100, 'c'));
+    heap.push(std::string(100, 'b'));
+
+    // 
+    std::string top = heap.pop_value();
+    EXPECT_EQ(top, std::string(100, 'c'));
+    EXPECT_EQ(heap.size(), 2);
+    EXPECT_EQ(heap.pop_value(), std::string(100, 'b'));
+    EXPECT_EQ(heap.top(), std::string(100, 'a'));
+}
+
+
+// 
+TEST_F(PriorityQueueTests, ExtractAndReplaceContainer) {
+    // 
+    mystl::priority_queue<int, mystl::vector<int>, std::greater<int>> min_heap_by_vec(std::greater<int>(), random_vec);
+    mystl::vector<int> container = min_heap_by_vec.extract_container();
+    EXPECT_TRUE(min_heap_by_vec.empty());
+    EXPECT_EQ(container.size(), random_vec.size());
+    EXPECT_TRUE(std::is_heap(container.begin(), container.end(), std::greater<int>()));
+
+    // the extracted queue stays usable
+    min_heap_by_vec.push(3);
+    EXPECT_EQ(min_heap_by_vec.top(), 3);
+
+    // refill the extracted storage and hand it back without copying
+    const int* storage = container.data();
+    container.clear();
+    container.push_back(9);
+    container.push_back(-7);
+    container.push_back(4);
+    min_heap_by_vec.replace_container(std::move(container));
+    EXPECT_EQ(min_heap_by_vec.size(), 3);
+    EXPECT_EQ(min_heap_by_vec.top(), -7);
+    EXPECT_EQ(min_heap_by_vec.extract_container().data(), storage);
+}
+
+
+// 
+TEST_F(PriorityQueueTests, Reserve) {
+    // 
+    max_heap.reserve(1000);
+    const int* storage = nullptr;
+    for (int i = 0; i < 1000; ++i) {
+        max_heap.push(i);
+        if (i == 0)
+            storage = &max_heap.top();
+    }
+    EXPECT_EQ(&max_heap.top(), storage);
+    EXPECT_EQ(max_heap.top(), 999);
+}
+
+
+
+// 
+TEST_F(PriorityQueueTests, BHeapLayout) {
+    // 
+    using b_heap_queue = mystl::priority_queue<int, mystl::vector<int>, std::greater<int>, mystl::b_heap_layout<64>>;
+    b_heap_queue queue(std::greater<int>(), random_vec);
+    EXPECT_EQ(queue.top(), -98);
+
+    // 
+    for (int i = 0; i < 1000; ++i)
+        queue.push((i * 37) % 1001 - 500);
+    mystl::vector<int> expected = random_vec;
+    for (int i = 0; i < 1000; ++i)
+        expected.push_back((i * 37) % 1001 - 500);
+    std::sort(expected.begin(), expected.end());
+
+    // 
+    for (size_t i = 0; i < expected.size(); ++i) {
+        ASSERT_EQ(queue.top(), expected[i]);
+        queue.pop();
+    }
+    EXPECT_TRUE(queue.empty());
+}
+
+
+// 
+TEST_F(PriorityQueueTests, PopN) {
+    // 
+    for (size_t i = 0; i < random_vec.size(); ++i)
+        min_heap.push(random_vec[i]);
+    mystl::vector<int> sorted = random_vec;
+    std::sort(sorted.begin(), sorted.end());
+
+    // 
+    std::vector<int> out;
+    min_heap.pop_n(8, std::back_inserter(out));
+    ASSERT_EQ(out.size(), 8u);
+    EXPECT_TRUE(std::equal(out.begin(), out.end(), sorted.begin()));
+    EXPECT_EQ(min_heap.size(), 12);
+    EXPECT_EQ(min_heap.top(), sorted[8]);
+
+    // more than there are
+    int rest[20] = {};
+    int* end = min_heap.pop_n(100, rest);
+    EXPECT_EQ(end - rest, 12);
+    EXPECT_TRUE(std::equal(rest, end, sorted.begin() + 8));
+    EXPECT_TRUE(min_heap.empty());
+}
+
+
+// 
+TEST_F(PriorityQueueTests, PopNBHeapLayout) {
+    // 
+    mystl::priority_queue<std::string, mystl::vector<std::string>, std::less<std::string>, mystl::b_heap_layout<256>> queue;
+    for (int i = 0; i < 500; ++i)
+        queue.push(std::to_string((i * 7) % 500 + 1000));
+
+    // 
+    std::vector<std::string> out;
+    queue.pop_n(3, std::back_inserter(out));
+    EXPECT_EQ(out, (std::vector<std::string>{"1499", "1498", "1497"}));
+    EXPECT_EQ(queue.size(), 497);
+    EXPECT_EQ(queue.top(), "1496");
+}
+
+
+
+TEST_F(PriorityQueueTests, MemoryFootprint) {
+    mystl::priority_queue<int> queue;
+    queue.reserve(16);
+    for (int i = 0; i < 10; ++i)
+        queue.push(i);
+
+    //
+    EXPECT_EQ(queue.allocated_bytes(), 16 * sizeof(int));
+    EXPECT_EQ(queue.memory_footprint(), sizeof(queue) + 16 * sizeof(int));
+    EXPECT_EQ(queue.overhead_bytes(), sizeof(queue) + 6 * sizeof(int));
+}
 
 // 
 int main(int argc, char **argv) {
@@ -5,6 +5,7 @@
 #include <utility>
 
 #include "queue.hpp"
+#include "list.hpp"
 
 
 /* Constructors and Destructors */
@@ -155,6 +156,20 @@ TEST(QueueTest, Pop) {
     EXPECT_TRUE(que.empty());
 }
 
+
+TEST(QueueTest, MemoryFootprint) {
+    mystl::queue<int> que;
+    for (int i = 0; i < 10; ++i)
+        que.push(i);
+
+    // forwarded to the underlying list
+    mystl::list<int> list;
+    std::size_t node_bytes = list.allocated_bytes();
+    EXPECT_EQ(que.allocated_bytes(), 11 * node_bytes);
+    EXPECT_EQ(que.memory_footprint(), sizeof(que) + 11 * node_bytes);
+    EXPECT_EQ(que.overhead_bytes(), que.memory_footprint() - 10 * sizeof(int));
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
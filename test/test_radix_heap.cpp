@@ -0,0 +1,113 @@
+/**
+ * \file test/test_radix_heap.cpp
+ */
+
+#include <cstdint>
+#include <queue>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "radix_heap.hpp"
+
+
+/* Basics */
+TEST(RadixHeapTest, PopsInKeyOrder) {
+    mystl::radix_heap<std::uint32_t, std::string> heap;
+    EXPECT_TRUE(heap.empty());
+
+    heap.push({7, "seven"});
+    heap.push({3, "three"});
+    heap.emplace(12, 3, 'x');
+    heap.push({3, "three again"});
+    EXPECT_EQ(heap.size(), 4);
+
+    EXPECT_EQ(heap.top().first, 3);
+    heap.pop();
+    EXPECT_EQ(heap.top().first, 3);
+    heap.pop();
+    EXPECT_EQ(heap.top().second, "seven");
+    heap.pop();
+    EXPECT_EQ(heap.top().second, "xxx");
+    heap.pop();
+    EXPECT_TRUE(heap.empty());
+    EXPECT_EQ(heap.last_key(), 12);
+}
+
+
+TEST(RadixHeapTest, RejectsKeysBelowLastPopped) {
+    mystl::radix_heap<std::uint64_t, int> heap;
+    heap.push({10, 0});
+    heap.pop();
+
+    // anything not below the last popped key is fine, even on an empty heap
+    heap.push({15, 1});
+    heap.push({10, 2});
+    EXPECT_EQ(heap.top().second, 2);
+    EXPECT_THROW(heap.push({9, 3}), std::out_of_range);
+}
+
+
+TEST(RadixHeapTest, EmptyHeapThrows) {
+    mystl::radix_heap<std::uint32_t, int> heap;
+    EXPECT_THROW(heap.top(), std::out_of_range);
+    EXPECT_THROW(heap.pop(), std::length_error);
+
+    // also once drained
+    heap.push({3, 0});
+    heap.pop();
+    EXPECT_THROW(heap.top(), std::out_of_range);
+    EXPECT_THROW(heap.pop(), std::length_error);
+    EXPECT_EQ(heap.size(), 0u);
+}
+
+
+TEST(RadixHeapTest, ExtremeKeys) {
+    mystl::radix_heap<std::uint8_t, int> heap;
+    heap.push({255, 0});
+    heap.push({0, 1});
+    heap.push({128, 2});
+    EXPECT_EQ(heap.top().first, 0);
+    heap.pop();
+    EXPECT_EQ(heap.top().first, 128);
+    heap.pop();
+    EXPECT_EQ(heap.top().first, 255);
+}
+
+
+TEST(RadixHeapTest, Swap) {
+    mystl::radix_heap<std::uint32_t, int> a, b;
+    a.push({5, 1});
+    b.push({2, 2});
+    b.push({3, 3});
+    a.swap(b);
+    EXPECT_EQ(a.size(), 2);
+    EXPECT_EQ(a.top().second, 2);
+    EXPECT_EQ(b.top().second, 1);
+}
+
+
+/* Monotone workload */
+TEST(RadixHeapTest, MatchesBinaryHeap) {
+    using entry = std::pair<std::uint64_t, int>;
+    mystl::radix_heap<std::uint64_t, int> heap;
+    std::priority_queue<entry, std::vector<entry>, std::greater<entry>> reference;
+
+    std::mt19937_64 rng(5);
+    std::uint64_t last = 0;
+    for (int step = 0; step < 50000; ++step) {
+        if (reference.empty() || rng() % 3 != 0) {
+            std::uint64_t key = last + (rng() % 8 == 0 ? rng() >> 20 : rng() % 100);
+            heap.push({key, step});
+            reference.push({key, step});
+        } else {
+            ASSERT_EQ(heap.top().first, reference.top().first);
+            last = heap.top().first;
+            heap.pop();
+            reference.pop();
+        }
+        ASSERT_EQ(heap.size(), reference.size());
+    }
+}
@@ -0,0 +1,59 @@
+/**
+ * \file test/test_sharded_cache.cpp
+ */
+
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "clock_cache.hpp"
+#include "lru_cache.hpp"
+#include "sharded_cache.hpp"
+
+
+/* Basics */
+TEST(ShardedCacheTest, ForwardsToShards) {
+    mystl::sharded_cache<mystl::lru_cache<int, int>, 4> cache(64);
+    for (int i = 0; i < 32; ++i)
+        EXPECT_TRUE(cache.put(i, i * 2));
+    EXPECT_EQ(cache.size(), 32);
+    EXPECT_EQ(cache.get(5), 10);
+    EXPECT_EQ(cache.get(100), std::nullopt);
+
+    EXPECT_TRUE(cache.erase(5));
+    EXPECT_FALSE(cache.contains(5));
+
+    cache.clear();
+    EXPECT_EQ(cache.size(), 0);
+}
+
+
+TEST(ShardedCacheTest, SingleShard) {
+    mystl::sharded_cache<mystl::clock_cache<int, int>, 1> cache(2);
+    cache.put(1, 1);
+    cache.put(2, 2);
+    cache.put(3, 3);
+    EXPECT_EQ(cache.size(), 2);
+    EXPECT_EQ(cache.get(3), 3);
+}
+
+
+/* Concurrency */
+TEST(ShardedCacheTest, ConcurrentAccess) {
+    mystl::sharded_cache<mystl::lru_cache<int, int>> cache(1024);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&cache, t] {
+            for (int i = 0; i < 20000; ++i) {
+                int key = (i * 7 + t) % 2048;
+                if (auto value = cache.get(key))
+                    EXPECT_EQ(*value, key);
+                else
+                    cache.put(key, key);
+            }
+        });
+    }
+    for (std::thread& thread : threads)
+        thread.join();
+    EXPECT_LE(cache.size(), 1024 + 16);
+}
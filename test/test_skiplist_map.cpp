@@ -0,0 +1,276 @@
+/**
+ * \file test/test_skiplist_map.cpp
+ */
+
+#include <atomic>
+#include <functional>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "skiplist_map.hpp"
+
+
+namespace {
+
+// Counts live instances to check that construction and destruction are balanced.
+struct Tracked {
+    static inline int alive = 0;
+
+    Tracked(int v = 0) : value(v) { ++alive; }
+    Tracked(const Tracked& other) : value(other.value) { ++alive; }
+    ~Tracked() { --alive; }
+
+    int value;
+};
+
+}
+
+
+/* Constructors */
+TEST(SkiplistMapTest, DefaultConstructor) {
+    mystl::skiplist_map<int, int> map;
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.size(), 0);
+    EXPECT_EQ(map.begin(), map.end());
+    EXPECT_DOUBLE_EQ(map.probability(), 0.25);
+}
+
+
+TEST(SkiplistMapTest, InvalidProbabilityThrows) {
+    EXPECT_THROW((mystl::skiplist_map<int, int>(0.0)), std::invalid_argument);
+    EXPECT_THROW((mystl::skiplist_map<int, int>(1.0)), std::invalid_argument);
+    EXPECT_NO_THROW((mystl::skiplist_map<int, int>(0.5)));
+}
+
+
+TEST(SkiplistMapTest, InitializerListKeepsFirstOfDuplicates) {
+    mystl::skiplist_map<int, std::string> map = {{3, "c"}, {1, "a"}, {2, "b"}, {1, "z"}};
+    ASSERT_EQ(map.size(), 3);
+    std::vector<std::pair<int, std::string>> expected = {{1, "a"}, {2, "b"}, {3, "c"}};
+    EXPECT_EQ((std::vector<std::pair<int, std::string>>(map.begin(), map.end())), expected);
+}
+
+
+TEST(SkiplistMapTest, CopyAndMove) {
+    mystl::skiplist_map<int, std::string> map = {{1, "a"}, {2, "b"}, {3, "c"}};
+
+    mystl::skiplist_map<int, std::string> copied(map);
+    EXPECT_EQ(copied.size(), 3);
+    copied[2] = "changed";
+    EXPECT_EQ(map.at(2), "b");
+    EXPECT_EQ(copied.at(2), "changed");
+    EXPECT_TRUE(copied.contains(3));
+
+    mystl::skiplist_map<int, std::string> moved(std::move(copied));
+    EXPECT_EQ(moved.size(), 3);
+    EXPECT_TRUE(copied.empty());
+    copied[7] = "reused";
+    EXPECT_EQ(copied.size(), 1);
+
+    mystl::skiplist_map<int, std::string> assigned;
+    assigned = map;
+    EXPECT_EQ(assigned.at(1), "a");
+    assigned = std::move(moved);
+    EXPECT_EQ(assigned.at(2), "changed");
+}
+
+
+/* Element access */
+TEST(SkiplistMapTest, SubscriptAndAt) {
+    mystl::skiplist_map<std::string, int> map;
+    map["b"] = 2;
+    map["a"] += 1;
+    EXPECT_EQ(map.at("a"), 1);
+    EXPECT_EQ(map.at("b"), 2);
+    EXPECT_THROW(map.at("c"), std::out_of_range);
+
+    const auto& cmap = map;
+    EXPECT_EQ(cmap.at("b"), 2);
+}
+
+
+/* Modifiers */
+TEST(SkiplistMapTest, InsertAndEmplace) {
+    mystl::skiplist_map<int, std::string> map;
+    auto [it, inserted] = map.insert({5, "five"});
+    EXPECT_TRUE(inserted);
+    EXPECT_EQ(it->second, "five");
+
+    auto [dup, again] = map.insert({5, "FIVE"});
+    EXPECT_FALSE(again);
+    EXPECT_EQ(dup, it);
+    EXPECT_EQ(dup->second, "five");
+
+    EXPECT_TRUE(map.emplace(3, "three").second);
+    EXPECT_FALSE(map.emplace(3, "THREE").second);
+    EXPECT_TRUE(map.try_emplace(4, 3, 'x').second);
+    EXPECT_EQ(map.at(4), "xxx");
+
+    auto result = map.insert_or_assign(3, "drei");
+    EXPECT_FALSE(result.second);
+    EXPECT_EQ(map.at(3), "drei");
+    EXPECT_EQ(map.size(), 3);
+}
+
+
+TEST(SkiplistMapTest, Erase) {
+    mystl::skiplist_map<int, int> map;
+    for (int i = 0; i < 10; ++i)
+        map[i] = i * i;
+
+    EXPECT_EQ(map.erase(3), 1);
+    EXPECT_EQ(map.erase(3), 0);
+    EXPECT_FALSE(map.contains(3));
+
+    auto it = map.erase(map.find(4));
+    EXPECT_EQ(it->first, 5);
+
+    it = map.erase(map.find(6), map.find(9));
+    EXPECT_EQ(it->first, 9);
+
+    std::vector<int> keys;
+    for (const auto& kv : map)
+        keys.push_back(kv.first);
+    EXPECT_EQ(keys, (std::vector<int>{0, 1, 2, 5, 9}));
+    EXPECT_EQ(map.size(), 5);
+}
+
+
+TEST(SkiplistMapTest, MatchesStdMapUnderRandomOperations) {
+    mystl::skiplist_map<int, int> map(0.5);
+    std::map<int, int> reference;
+    std::mt19937 rng(42);
+
+    for (int i = 0; i < 20000; ++i) {
+        int key = int(rng() % 2000);
+        if (rng() % 3 == 0) {
+            EXPECT_EQ(map.erase(key), reference.erase(key));
+        } else {
+            map[key] = i;
+            reference[key] = i;
+        }
+    }
+
+    ASSERT_EQ(map.size(), reference.size());
+    auto ref = reference.begin();
+    for (const auto& kv : map) {
+        EXPECT_EQ(kv.first, ref->first);
+        EXPECT_EQ(kv.second, ref->second);
+        ++ref;
+    }
+}
+
+
+TEST(SkiplistMapTest, LifetimesAreBalanced) {
+    Tracked::alive = 0;
+    {
+        mystl::skiplist_map<int, Tracked> map;
+        for (int i = 0; i < 100; ++i)
+            map.try_emplace(i, i);
+        EXPECT_EQ(Tracked::alive, 100);
+
+        for (int i = 0; i < 100; i += 2)
+            map.erase(i);
+        EXPECT_EQ(Tracked::alive, 50);
+
+        // erased nodes are pooled without their values and reused
+        for (int i = 0; i < 100; i += 2)
+            map.try_emplace(i, i);
+        EXPECT_EQ(Tracked::alive, 100);
+
+        map.clear();
+        EXPECT_EQ(Tracked::alive, 0);
+        map.try_emplace(1, 1);
+        map.shrink_to_fit();
+        EXPECT_EQ(map.at(1).value, 1);
+    }
+    EXPECT_EQ(Tracked::alive, 0);
+}
+
+
+/* Lookup */
+TEST(SkiplistMapTest, Bounds) {
+    mystl::skiplist_map<int, int> map = {{10, 1}, {20, 2}, {30, 3}};
+
+    EXPECT_EQ(map.lower_bound(20)->first, 20);
+    EXPECT_EQ(map.upper_bound(20)->first, 30);
+    EXPECT_EQ(map.lower_bound(15)->first, 20);
+    EXPECT_EQ(map.upper_bound(15)->first, 20);
+    EXPECT_EQ(map.lower_bound(5)->first, 10);
+    EXPECT_EQ(map.lower_bound(31), map.end());
+    EXPECT_EQ(map.upper_bound(30), map.end());
+
+    auto [first, last] = map.equal_range(20);
+    EXPECT_EQ(first->first, 20);
+    EXPECT_EQ(last->first, 30);
+    auto [none_first, none_last] = map.equal_range(25);
+    EXPECT_EQ(none_first, none_last);
+
+    // range scan [12, 30)
+    std::vector<int> keys;
+    for (auto it = map.lower_bound(12); it != map.lower_bound(30); ++it)
+        keys.push_back(it->first);
+    EXPECT_EQ(keys, (std::vector<int>{20}));
+}
+
+
+TEST(SkiplistMapTest, CustomCompare) {
+    mystl::skiplist_map<int, int, std::greater<int>> map = {{1, 1}, {3, 3}, {2, 2}};
+    std::vector<int> keys;
+    for (auto it = map.cbegin(); it != map.cend(); ++it)
+        keys.push_back(it->first);
+    EXPECT_EQ(keys, (std::vector<int>{3, 2, 1}));
+    EXPECT_EQ(map.lower_bound(2)->first, 2);
+}
+
+
+/* Concurrent */
+TEST(SkiplistMapTest, ConcurrentReadersDuringWrites) {
+    mystl::skiplist_map<int, int, std::less<int>, true> map;
+    for (int i = 0; i < 1000; i += 2)
+        map[i] = i;
+
+    // even keys are never touched by the writer and must always be found
+    std::atomic<bool> done = false;
+    std::atomic<int> misses = 0;
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 3; ++t) {
+        readers.emplace_back([&] {
+            const auto& cmap = map;
+            while (!done.load()) {
+                for (int i = 0; i < 1000; i += 2) {
+                    auto it = cmap.find(i);
+                    if (it == cmap.cend() || it->second != i)
+                        ++misses;
+                }
+                int prev = -1;
+                for (auto it = cmap.cbegin(); it != cmap.cend(); ++it) {
+                    if (it->first <= prev)
+                        ++misses;
+                    prev = it->first;
+                }
+            }
+        });
+    }
+
+    // odd keys come and go
+    for (int round = 0; round < 50; ++round) {
+        for (int i = 1; i < 1000; i += 2)
+            map.try_emplace(i, i);
+        for (int i = 1; i < 1000; i += 2)
+            map.erase(i);
+    }
+    done = true;
+    for (auto& reader : readers)
+        reader.join();
+
+    map.reclaim();
+    EXPECT_EQ(misses.load(), 0);
+    EXPECT_EQ(map.size(), 500);
+}
@@ -0,0 +1,134 @@
+/**
+ * \file test/test_stable_sort.cpp
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "vector.hpp"
+#include "algorithm/stable_sort.hpp"
+
+
+namespace {
+
+using keyed = std::pair<int, int>;   // key, original position
+
+// Orders by key only, so that stability is observable.
+struct by_key {
+    bool operator()(const keyed& a, const keyed& b) const { return a.first < b.first; }
+};
+
+// Sorts `keys` tagged with their positions and checks against std::stable_sort.
+void expect_matches_std(const std::vector<int>& keys) {
+    mystl::vector<keyed> actual;
+    std::vector<keyed> expected;
+    for (size_t i = 0; i < keys.size(); ++i) {
+        actual.push_back({keys[i], int(i)});
+        expected.push_back({keys[i], int(i)});
+    }
+    mystl::stable_sort(actual.begin(), actual.end(), by_key());
+    std::stable_sort(expected.begin(), expected.end(), by_key());
+
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        ASSERT_EQ(actual[i], expected[i]) << "at " << i << " of " << keys.size();
+    }
+}
+
+}
+
+
+// 
+TEST(StableSortTests, EmptyAndShort) {
+    expect_matches_std({});
+    expect_matches_std({1});
+    expect_matches_std({2, 1});
+    expect_matches_std({3, 1, 2, 1, 3, 2, 1});
+}
+
+
+// Random keys with many duplicates, at sizes around the run and merge thresholds
+TEST(StableSortTests, RandomWithDuplicates) {
+    std::mt19937 rng(1);
+    for (size_t n : {31, 32, 33, 63, 64, 65, 100, 1000, 4097, 50000}) {
+        std::vector<int> keys(n);
+        for (auto& k : keys)
+            k = int(rng() % 50);
+        expect_matches_std(keys);
+    }
+}
+
+
+// Sorted, reversed, and nearly sorted input, where runs and galloping kick in
+TEST(StableSortTests, Patterns) {
+    std::mt19937 rng(2);
+    const size_t n = 20000;
+
+    // 
+    std::vector<int> ascending(n), descending(n), nearly(n), sawtooth(n), organ(n);
+    for (size_t i = 0; i < n; ++i) {
+        ascending[i] = int(i / 3);
+        descending[i] = int((n - i) / 3);
+        nearly[i] = int(i);
+        sawtooth[i] = int(i % 700);
+        organ[i] = int(i < n / 2 ? i : n - i);
+    }
+    for (size_t i = 0; i < n / 100; ++i)
+        std::swap(nearly[rng() % n], nearly[rng() % n]);
+
+    // 
+    expect_matches_std(ascending);
+    expect_matches_std(descending);
+    expect_matches_std(nearly);
+    expect_matches_std(sawtooth);
+    expect_matches_std(organ);
+}
+
+
+// Long runs of one side force the merges into galloping mode
+TEST(StableSortTests, Gallops) {
+    std::vector<int> keys;
+    for (int block = 0; block < 40; ++block) {
+        for (int i = 0; i < 500; ++i)
+            keys.push_back((block % 2 == 0 ? 0 : 100000) + block * 1000 + i);
+    }
+    std::mt19937 rng(3);
+    std::shuffle(keys.begin() + 5000, keys.begin() + 5200, rng);
+    expect_matches_std(keys);
+}
+
+
+// 
+TEST(StableSortTests, ComparatorAndBufferReuse) {
+    // 
+    mystl::vector<std::string> buffer;
+    std::mt19937 rng(4);
+    for (int round = 0; round < 3; ++round) {
+        std::vector<std::string> words;
+        for (int i = 0; i < 3000; ++i)
+            words.push_back(std::to_string(rng() % 1000));
+        std::vector<std::string> expected = words;
+
+        mystl::stable_sort(words.begin(), words.end(), std::greater<std::string>(), buffer);
+        std::stable_sort(expected.begin(), expected.end(), std::greater<std::string>());
+        EXPECT_EQ(words, expected);
+    }
+
+    // 
+    int raw[] = {5, 3, 9, 1, 7};
+    mystl::stable_sort(raw, raw + 5);
+    EXPECT_TRUE(std::is_sorted(raw, raw + 5));
+}
+
+
+// 
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
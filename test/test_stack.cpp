@@ -7,6 +7,7 @@
 
 #include "stack.hpp"
 #include "list.hpp"
+#include "vector.hpp"
 
 
 /* Constructors and Destructors */
@@ -187,6 +188,21 @@ TEST(StackTest, UseListAsContainerType) {
 }
 
 
+
+TEST(StackTest, MemoryFootprint) {
+    mystl::stack<int> stk;
+    for (int i = 0; i < 20; ++i)
+        stk.push(i);
+
+    // forwarded to the underlying vector
+    mystl::vector<int> vec;
+    for (int i = 0; i < 20; ++i)
+        vec.push_back(i);
+    EXPECT_EQ(stk.allocated_bytes(), vec.allocated_bytes());
+    EXPECT_EQ(stk.memory_footprint(), sizeof(stk) + vec.allocated_bytes());
+    EXPECT_EQ(stk.overhead_bytes(), stk.memory_footprint() - 20 * sizeof(int));
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -0,0 +1,107 @@
+/**
+ * \file test/test_static_priority_queue.cpp
+ */
+
+#include <algorithm>
+#include <functional>
+#include <new>
+#include <string>
+#include <gtest/gtest.h>
+
+#include "vector.hpp"
+#include "static_priority_queue.hpp"
+
+
+namespace {
+
+// Pushes a few values and pops them in order, at compile time.
+constexpr int constexpr_drain() {
+    mystl::static_priority_queue<int, 8, std::greater<int>> queue;
+    for (int v : {5, 1, 4, 2, 3})
+        queue.push(v);
+    int digits = 0;
+    while (!queue.empty())
+        digits = digits * 10 + queue.pop_value();
+    return digits;
+}
+
+}
+
+
+//
+TEST(StaticPriorityQueueTests, Constexpr) {
+    static_assert(constexpr_drain() == 12345);
+    static_assert(mystl::static_priority_queue<int, 8>::capacity() == 8);
+    EXPECT_EQ(constexpr_drain(), 12345);
+}
+
+
+//
+TEST(StaticPriorityQueueTests, PushPopInOrder) {
+    //
+    mystl::vector<int> values = {74, -42, 48, -44, 14, 5, 96, -98, -80, 18, 64, -38, -31, -36, 73, 25, -18, -45, -42, 30};
+    mystl::static_priority_queue<int, 20> queue;
+    for (size_t i = 0; i < values.size(); ++i)
+        queue.push(values[i]);
+    EXPECT_TRUE(queue.full());
+    EXPECT_EQ(queue.size(), 20);
+
+    //
+    std::sort(values.begin(), values.end(), std::greater<>());
+    for (size_t i = 0; i < values.size(); ++i) {
+        EXPECT_EQ(queue.top(), values[i]);
+        queue.pop();
+    }
+    EXPECT_TRUE(queue.empty());
+}
+
+
+//
+TEST(StaticPriorityQueueTests, TryPushWhenFull) {
+    //
+    mystl::static_priority_queue<std::string, 2> queue;
+    EXPECT_TRUE(queue.try_push("b"));
+    EXPECT_TRUE(queue.try_emplace(3, 'a'));
+
+    //
+    std::string rejected = "zzz";
+    EXPECT_FALSE(queue.try_push(std::move(rejected)));
+    EXPECT_EQ(rejected, "zzz");
+    EXPECT_THROW(queue.push("c"), std::bad_alloc);
+    EXPECT_EQ(queue.size(), 2);
+    EXPECT_EQ(queue.top(), "b");
+
+    //
+    EXPECT_EQ(queue.pop_value(), "b");
+    EXPECT_TRUE(queue.try_push("c"));
+    EXPECT_EQ(queue.top(), "c");
+}
+
+
+//
+TEST(StaticPriorityQueueTests, RangeConstructAndSwap) {
+    //
+    int values[] = {3, 9, 1, 7};
+    mystl::static_priority_queue<int, 8> lhs(values, values + 4);
+    mystl::static_priority_queue<int, 8> rhs;
+    rhs.push(42);
+    EXPECT_EQ(lhs.top(), 9);
+
+    //
+    lhs.swap(rhs);
+    EXPECT_EQ(lhs.size(), 1);
+    EXPECT_EQ(lhs.top(), 42);
+    EXPECT_EQ(rhs.size(), 4);
+    EXPECT_EQ(rhs.top(), 9);
+
+    //
+    rhs.clear();
+    EXPECT_TRUE(rhs.empty());
+}
+
+
+//
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,209 @@
+/**
+ * \file test/test_timer_wheel.cpp
+ */
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "timer_wheel.hpp"
+
+
+/* Schedule and expiry */
+TEST(TimerWheelTest, FiresInExpiryOrder) {
+    mystl::timer_wheel<int> wheel;
+    wheel.schedule(300, 300);
+    wheel.schedule(5, 5);
+    wheel.schedule(70, 70);
+    wheel.schedule(5, 6);
+    EXPECT_EQ(wheel.size(), 4);
+
+    std::vector<int> fired;
+    EXPECT_EQ(wheel.advance(4, [&](int v) { fired.push_back(v); }), 0);
+    EXPECT_EQ(wheel.advance(100, [&](int v) { fired.push_back(v); }), 3);
+    EXPECT_EQ(fired, (std::vector<int>{5, 6, 70}));
+    EXPECT_EQ(wheel.now(), 100);
+
+    wheel.advance(1000, [&](int v) { fired.push_back(v); });
+    EXPECT_EQ(fired.back(), 300);
+    EXPECT_TRUE(wheel.empty());
+}
+
+
+TEST(TimerWheelTest, PastExpiryFiresNextTick) {
+    mystl::timer_wheel<int> wheel(50);
+    wheel.schedule(10, 1);
+    wheel.schedule_after(0, 2);
+
+    int count = 0;
+    EXPECT_EQ(wheel.advance(50, [&](int) { ++count; }), 0);
+    EXPECT_EQ(wheel.advance(51, [&](int) { ++count; }), 2);
+}
+
+
+TEST(TimerWheelTest, FarTimersUseOverflow) {
+    mystl::timer_wheel<std::uint64_t, 2> wheel;
+    const std::uint64_t far = (std::uint64_t(1) << 20) + 12345;
+    wheel.schedule(far, far);
+    wheel.schedule(4096 + 7, 4096 + 7);
+
+    std::vector<std::uint64_t> fired;
+    wheel.advance(far - 1, [&](std::uint64_t v) { fired.push_back(v); });
+    EXPECT_EQ(fired, (std::vector<std::uint64_t>{4096 + 7}));
+    wheel.advance(far, [&](std::uint64_t v) { fired.push_back(v); });
+    EXPECT_EQ(fired.back(), far);
+}
+
+
+TEST(TimerWheelTest, FarTimersFireAtTheirTick) {
+    // with only far timers pending, `advance` jumps between cascades instead
+    // of stepping through every level-0 wrap; reaching 2^40 one wrap at a
+    // time would not finish
+    mystl::timer_wheel<std::uint64_t> wheel;
+    const std::vector<std::uint64_t> expiries = {
+        (std::uint64_t(1) << 24) + 5, (std::uint64_t(1) << 30) + 4096 * 3 + 64 * 7 + 1, std::uint64_t(1) << 38,
+    };
+    for (std::uint64_t expiry : expiries)
+        wheel.schedule(expiry, expiry);
+
+    std::vector<std::uint64_t> fired;
+    wheel.advance(std::uint64_t(1) << 40, [&](std::uint64_t v) {
+        EXPECT_EQ(wheel.now(), v);
+        fired.push_back(v);
+    });
+    EXPECT_EQ(fired, expiries);
+    EXPECT_EQ(wheel.now(), std::uint64_t(1) << 40);
+}
+
+
+/* Cancel */
+TEST(TimerWheelTest, Cancel) {
+    mystl::timer_wheel<int> wheel;
+    auto a = wheel.schedule(10, 1);
+    auto b = wheel.schedule(5000, 2);
+    wheel.schedule(10, 3);
+
+    EXPECT_TRUE(wheel.cancel(a));
+    EXPECT_FALSE(wheel.cancel(a));
+    EXPECT_TRUE(wheel.cancel(b));
+    EXPECT_FALSE(wheel.cancel({}));
+    EXPECT_EQ(wheel.size(), 1);
+
+    // the node of `a` is reused; the stale handle must not cancel the new timer
+    auto c = wheel.schedule(20, 4);
+    EXPECT_FALSE(wheel.cancel(a));
+
+    std::vector<int> fired;
+    wheel.advance(100, [&](int v) { fired.push_back(v); });
+    EXPECT_EQ(fired, (std::vector<int>{3, 4}));
+    EXPECT_FALSE(wheel.cancel(c));
+}
+
+
+TEST(TimerWheelTest, CallbackReschedulesAndCancels) {
+    mystl::timer_wheel<int> wheel;
+    mystl::timer_wheel<int>::handle victim;
+    wheel.schedule(8, 0);
+    victim = wheel.schedule(8, 1);
+
+    std::vector<int> fired;
+    wheel.advance(100, [&](int v) {
+        fired.push_back(v);
+        if (v == 0) {
+            EXPECT_TRUE(wheel.cancel(victim));
+            wheel.schedule_after(10, 2);
+        }
+    });
+    EXPECT_EQ(fired, (std::vector<int>{0, 2}));
+    EXPECT_TRUE(wheel.empty());
+}
+
+
+TEST(TimerWheelTest, ThrowingCallbackKeepsTheRestOfTheBatch) {
+    mystl::timer_wheel<int> wheel;
+    for (int v = 0; v < 4; ++v)
+        wheel.schedule(8, v);
+    wheel.schedule(9, 4);
+
+    std::vector<int> fired;
+    auto fn = [&](int v) {
+        fired.push_back(v);
+        if (v == 1)
+            throw std::runtime_error("timer");
+    };
+    EXPECT_THROW(wheel.advance(100, fn), std::runtime_error);
+    EXPECT_EQ(wheel.now(), 8);
+    EXPECT_EQ(wheel.size(), 3);
+
+    // the timers left at tick 8 fire first
+    EXPECT_EQ(wheel.advance(100, fn), 3);
+    EXPECT_EQ(fired, (std::vector<int>{0, 1, 2, 3, 4}));
+    EXPECT_TRUE(wheel.empty());
+}
+
+
+TEST(TimerWheelTest, ReleasesPayloads) {
+    auto payload = std::make_shared<int>(0);
+    mystl::timer_wheel<std::shared_ptr<int>> wheel;
+    auto h = wheel.schedule(10, payload);
+    wheel.schedule(20, payload);
+    wheel.schedule(30, payload);
+    EXPECT_EQ(payload.use_count(), 4);
+
+    // cancelled, fired and cleared timers do not keep their payload in the pool
+    wheel.cancel(h);
+    EXPECT_EQ(payload.use_count(), 3);
+    wheel.advance(25, [](std::shared_ptr<int>&) {});
+    EXPECT_EQ(payload.use_count(), 2);
+    wheel.clear();
+    EXPECT_EQ(payload.use_count(), 1);
+
+    // pooled nodes are reused
+    wheel.schedule(40, payload);
+    EXPECT_EQ(payload.use_count(), 2);
+}
+
+
+TEST(TimerWheelTest, MatchesReferenceModel) {
+    using wheel_type = mystl::timer_wheel<std::uint64_t, 3>;
+    wheel_type wheel;
+    std::map<std::uint64_t, std::pair<std::uint64_t, wheel_type::handle>> model;   // id -> expiry, handle
+
+    std::mt19937_64 rng(3);
+    std::uint64_t next_id = 0;
+    for (int step = 0; step < 3000; ++step) {
+        for (int i = 0; i < 8; ++i) {
+            std::uint64_t delay = rng() % 4 == 0 ? rng() % 600000 : rng() % 300;
+            std::uint64_t expiry = wheel.now() + 1 + delay;
+            model[next_id] = {expiry, wheel.schedule(expiry, next_id)};
+            ++next_id;
+        }
+        for (int i = 0; i < 3 && !model.empty(); ++i) {
+            auto it = model.lower_bound(rng() % next_id);
+            if (it == model.end())
+                continue;
+            ASSERT_TRUE(wheel.cancel(it->second.second));
+            model.erase(it);
+        }
+
+        //
+        std::uint64_t target = wheel.now() + rng() % 200;
+        std::uint64_t last = 0;
+        wheel.advance(target, [&](std::uint64_t id) {
+            auto it = model.find(id);
+            ASSERT_NE(it, model.end());
+            EXPECT_EQ(it->second.first, wheel.now());
+            EXPECT_LE(it->second.first, target);
+            EXPECT_GE(it->second.first, last);
+            last = it->second.first;
+            model.erase(it);
+        });
+        for (const auto& [id, timer] : model)
+            ASSERT_GT(timer.first, target);
+        ASSERT_EQ(wheel.size(), model.size());
+    }
+}
@@ -0,0 +1,138 @@
+/**
+ * \file test/test_trace.cpp
+ */
+
+#define MYSTL_TRACE 1
+
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <gtest/gtest.h>
+
+#include "trace.hpp"
+#include "vector.hpp"
+#include "list.hpp"
+#include "forward_list.hpp"
+#include "inplace_vector.hpp"
+#include "algorithm/make_heap.hpp"
+
+
+namespace {
+
+std::size_t count(const std::string& text, const std::string& pattern) {
+    std::size_t n = 0;
+    for (std::size_t pos = text.find(pattern); pos != std::string::npos; pos = text.find(pattern, pos + 1))
+        ++n;
+    return n;
+}
+
+// Tracing is skipped in constant expressions.
+constexpr int constexpr_make_heap() {
+    mystl::inplace_vector<int, 4> heap = {1, 2, 3};
+    mystl::make_heap(heap.begin(), heap.end());
+    return heap[0];
+}
+
+}
+
+static_assert(mystl::trace::enabled);
+static_assert(constexpr_make_heap() == 3);
+
+
+TEST(TraceTest, RecordsBeginAndEnd) {
+    mystl::trace::start();
+    mystl::trace::clear();
+
+    //
+    mystl::vector<int> vec;
+    for (int i = 0; i < 11; ++i)
+        vec.push_back(i);
+    mystl::make_heap(vec.begin(), vec.end());
+    mystl::list<int> list = {3, 1, 2};
+    list.sort();
+    mystl::forward_list<int> flist = {3, 1, 2};
+    flist.sort();
+
+    //
+    std::string json = mystl::trace::to_chrome_json();
+    EXPECT_EQ(json.rfind("{\"traceEvents\":[", 0), 0u);
+    EXPECT_EQ(count(json, "\"name\":\"vector::realloc\""), 4u);   // the default capacity and one growth
+    EXPECT_NE(json.find("\"name\":\"make_heap\",\"cat\":\"mystl\",\"ph\":\"B\""), std::string::npos);
+    EXPECT_NE(json.find("\"args\":{\"size\":11}"), std::string::npos);
+    EXPECT_EQ(count(json, "\"name\":\"list::sort\""), 2u);
+    EXPECT_EQ(count(json, "\"name\":\"forward_list::sort\""), 2u);
+    EXPECT_EQ(count(json, "\"ph\":\"B\""), count(json, "\"ph\":\"E\""));
+}
+
+
+TEST(TraceTest, Clear) {
+    mystl::trace::start();
+    mystl::vector<int> vec;
+    mystl::trace::clear();
+    EXPECT_EQ(count(mystl::trace::to_chrome_json(), "\"ph\""), 0u);
+}
+
+
+TEST(TraceTest, PerThreadBuffers) {
+    mystl::trace::clear();
+    std::thread([] {
+        mystl::trace::start();
+        mystl::trace::scope span("worker", 1);
+    }).join();
+    std::thread([] {
+        mystl::trace::scope span("unstarted", 1);
+    }).join();
+    mystl::trace::start();
+    mystl::trace::scope span("main", 2);
+
+    // the finished thread's events are kept, a thread without `start()` records nothing
+    std::string json = mystl::trace::to_chrome_json();
+    EXPECT_EQ(count(json, "\"name\":\"worker\""), 2u);
+    EXPECT_EQ(count(json, "\"name\":\"unstarted\""), 0u);
+    EXPECT_EQ(count(json, "\"name\":\"main\""), 1u);
+}
+
+
+TEST(TraceTest, FullBufferDropsWholeScopes) {
+    mystl::trace::start();
+    mystl::trace::clear();
+    {
+        mystl::trace::scope outer("outer", 0);
+        for (std::size_t i = 0; i < mystl::trace::buffer_events; ++i)
+            mystl::trace::scope inner("inner", i);
+    }
+
+    //
+    std::string json = mystl::trace::to_chrome_json();
+    EXPECT_EQ(count(json, "\"ph\":\"B\""), count(json, "\"ph\":\"E\""));
+    EXPECT_EQ(count(json, "\"name\":\"outer\""), 2u);
+    EXPECT_GT(mystl::trace::dropped(), 0u);
+    mystl::trace::clear();
+    EXPECT_EQ(mystl::trace::dropped(), 0u);
+}
+
+
+TEST(TraceTest, WriteFile) {
+    mystl::trace::start();
+    mystl::trace::clear();
+    { mystl::trace::scope span("file", 3); }
+
+    //
+    const char* path = "test_trace_output.json";
+    ASSERT_TRUE(mystl::trace::write_chrome_json(path));
+    std::FILE* file = std::fopen(path, "r");
+    ASSERT_NE(file, nullptr);
+    std::string text;
+    char chunk[256];
+    for (std::size_t n; (n = std::fread(chunk, 1, sizeof(chunk), file)) > 0; )
+        text.append(chunk, n);
+    std::fclose(file);
+    std::remove(path);
+    EXPECT_EQ(text, mystl::trace::to_chrome_json());
+}
+
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
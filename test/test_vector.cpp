@@ -7,6 +7,7 @@
 #include <stdexcept>
 #include <forward_list>
 #include <list>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -97,6 +98,151 @@ TEST(vectorTest, CopyConstructor) {
 }
 
 
+/**
+ * Test Case: CopyConstructorAllocatesOnlySize
+ *
+ * The copy must not inherit the spare capacity of the source.
+ */
+TEST(vectorTest, CopyConstructorAllocatesOnlySize) {
+    mystl::vector<int> original;
+    original.reserve(1000);
+    original.push_back(1);
+    original.push_back(2);
+
+    mystl::vector<int> copy(original);
+    ASSERT_EQ(copy.size(), 2);
+    EXPECT_EQ(copy.capacity(), 2);
+    EXPECT_EQ(copy[1], 2);
+
+    // an empty source allocates nothing
+    mystl::vector<int> empty;
+    empty.reserve(1000);
+    mystl::vector<int> emptyCopy(empty);
+    EXPECT_EQ(emptyCopy.capacity(), 0);
+    emptyCopy.push_back(7);
+    EXPECT_EQ(emptyCopy[0], 7);
+
+    // non trivially copyable elements
+    mystl::vector<std::string> strs;
+    strs.reserve(100);
+    strs.push_back("copied");
+    mystl::vector<std::string> strsCopy(strs);
+    EXPECT_EQ(strsCopy.capacity(), 1);
+    EXPECT_EQ(strsCopy[0], "copied");
+}
+
+
+namespace {
+
+// Allocator recording how many bytes are currently allocated.
+template <typename T>
+struct CountingAllocator {
+    using value_type = T;
+
+    static inline std::size_t bytes = 0;
+
+    CountingAllocator() = default;
+    template <typename U> CountingAllocator(const CountingAllocator<U>&) {}
+
+    T* allocate(std::size_t n) {
+        bytes += n * sizeof(T);
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* p, std::size_t n) {
+        bytes -= n * sizeof(T);
+        std::allocator<T>().deallocate(p, n);
+    }
+
+    bool operator==(const CountingAllocator&) const { return true; }
+};
+
+// Element whose copy constructor throws once `copies_left` copies were made,
+// and whose default constructor throws once `defaults_left` (when not
+// negative) objects were default-constructed.
+struct Throwing {
+    static inline int alive = 0;
+    static inline int copies_left = 0;
+    static inline int defaults_left = -1;
+
+    Throwing() {
+        if (defaults_left >= 0 && defaults_left-- == 0)
+            throw std::runtime_error("construction failed");
+        ++alive;
+    }
+    Throwing(const Throwing&) {
+        if (copies_left-- == 0)
+            throw std::runtime_error("copy failed");
+        ++alive;
+    }
+    Throwing& operator=(const Throwing&) = default;
+    ~Throwing() { --alive; }
+};
+
+// Element that records the value of every object destroyed, -1 for moved-from ones.
+struct Recorded {
+    static inline std::vector<int> destroyed;
+
+    Recorded(int v) : value(v) {}
+    Recorded(const Recorded&) = default;
+    Recorded(Recorded&& other) noexcept : value(other.value) { other.value = -1; }
+    Recorded& operator=(const Recorded&) = default;
+    Recorded& operator=(Recorded&& other) noexcept { value = other.value; other.value = -1; return *this; }
+    ~Recorded() { destroyed.push_back(value); }
+
+    int value;
+};
+
+}
+
+
+/**
+ * Test Case: CopyMemoryFootprint
+ */
+TEST(vectorTest, CopyMemoryFootprint) {
+    using Vec = mystl::vector<int, CountingAllocator<int>>;
+    CountingAllocator<int>::bytes = 0;
+    {
+        Vec original;
+        original.reserve(4096);
+        for (int i = 0; i < 16; ++i)
+            original.push_back(i);
+        std::size_t before = CountingAllocator<int>::bytes;
+
+        Vec copy(original);
+        EXPECT_EQ(CountingAllocator<int>::bytes - before, 16 * sizeof(int));
+
+        Vec assigned;
+        assigned = original;
+        EXPECT_GE(assigned.capacity(), 16);
+        EXPECT_LT(assigned.capacity(), 4096);
+        for (int i = 0; i < 16; ++i)
+            EXPECT_EQ(assigned[i], i);
+    }
+    EXPECT_EQ(CountingAllocator<int>::bytes, 0) << "Memory leaked after copies were destroyed";
+}
+
+
+/**
+ * Test Case: CopyConstructorThrowingElement
+ *
+ * A throwing element copy must not leak the already copied elements.
+ */
+TEST(vectorTest, CopyConstructorThrowingElement) {
+    {
+        mystl::vector<Throwing> original;
+        for (int i = 0; i < 5; ++i)
+            original.emplace_back();
+        EXPECT_EQ(Throwing::alive, 5);
+
+        Throwing::copies_left = 3;
+        EXPECT_THROW(mystl::vector<Throwing> copy(original), std::runtime_error);
+        EXPECT_EQ(Throwing::alive, 5);
+    }
+    EXPECT_EQ(Throwing::alive, 0);
+}
+
+
 /**
  * Test Case: Move constructor
  */
@@ -242,6 +388,28 @@ TEST(vectorTest, Erase) {
 }
 
 
+/**
+ * Test Case: EraseAnyPosition
+ *
+ * The range check of erase(pos) used to reject every position but begin().
+ */
+TEST(vectorTest, EraseAnyPosition) {
+    mystl::vector<int> vec = {0, 1, 2, 3, 4};
+
+    auto it = vec.erase(vec.cbegin());
+    EXPECT_EQ(*it, 1);
+    it = vec.erase(vec.cbegin() + 1);
+    EXPECT_EQ(*it, 3);
+    it = vec.erase(vec.cend() - 1);
+    EXPECT_EQ(it, vec.end());
+    EXPECT_EQ(std::vector<int>(vec.begin(), vec.end()), (std::vector<int>{1, 3}));
+
+    // end() is not an element
+    EXPECT_THROW(vec.erase(vec.cend()), std::out_of_range);
+    EXPECT_EQ(vec.size(), 2);
+}
+
+
 TEST(vectorTest, Emplace) {
     mystl::vector<int> vec = {1, 2, 4, 5};
 
@@ -335,6 +503,48 @@ TEST(vectorTest, pop_back) {
 }
 
 
+/**
+ * Test Case: ReallocDestroysOldElementsOnce
+ *
+ * Growing used to destroy each moved-from element twice.
+ */
+TEST(vectorTest, ReallocDestroysOldElementsOnce) {
+    {
+        mystl::vector<Recorded> vec;
+        for (int i = 0; i < 3; ++i)
+            vec.emplace_back(i);
+
+        //
+        Recorded::destroyed.clear();
+        vec.reserve(vec.capacity() * 2);
+        EXPECT_EQ(Recorded::destroyed, (std::vector<int>{-1, -1, -1}));
+        EXPECT_EQ(vec[2].value, 2);
+        Recorded::destroyed.clear();
+    }
+    EXPECT_EQ(Recorded::destroyed, (std::vector<int>{0, 1, 2}));
+}
+
+
+/**
+ * Test Case: PopBackDestroysLastElement
+ *
+ * pop_back used to destroy the unconstructed slot past the last element.
+ */
+TEST(vectorTest, PopBackDestroysLastElement) {
+    mystl::vector<Recorded> vec;
+    vec.reserve(8);
+    vec.emplace_back(1);
+    vec.emplace_back(2);
+
+    //
+    Recorded::destroyed.clear();
+    vec.pop_back();
+    EXPECT_EQ(Recorded::destroyed, (std::vector<int>{2}));
+    vec.pop_back();
+    EXPECT_EQ(Recorded::destroyed, (std::vector<int>{2, 1}));
+}
+
+
 /**
  */
 TEST(vectorTest, Resize) {
@@ -355,6 +565,78 @@ TEST(vectorTest, Resize) {
 }
 
 
+/**
+ */
+TEST(vectorTest, ResizeForOverwrite) {
+    mystl::vector<char> buf;
+    buf.resize_for_overwrite(100);
+    ASSERT_EQ(buf.size(), 100);
+    EXPECT_GE(buf.capacity(), 100);
+
+    // the new elements are writable storage, there is no value to check
+    for (std::size_t i = 0; i < buf.size(); ++i)
+        buf[i] = 'a';
+    EXPECT_EQ(buf[99], 'a');
+
+    // class types are still default-constructed
+    mystl::vector<std::string> strs = {"kept"};
+    strs.resize_for_overwrite(3);
+    ASSERT_EQ(strs.size(), 3);
+    EXPECT_EQ(strs[0], "kept");
+    EXPECT_TRUE(strs[2].empty());
+
+    strs.resize_for_overwrite(1);
+    ASSERT_EQ(strs.size(), 1);
+    EXPECT_EQ(strs[0], "kept");
+}
+
+
+/**
+ * Test Case: ResizeForOverwriteThrowingElement
+ *
+ * A throwing default constructor must not leak the already constructed elements.
+ */
+TEST(vectorTest, ResizeForOverwriteThrowingElement) {
+    {
+        mystl::vector<Throwing> vec;
+        vec.emplace_back();
+        vec.emplace_back();
+
+        Throwing::defaults_left = 3;
+        EXPECT_THROW(vec.resize_for_overwrite(8), std::runtime_error);
+        Throwing::defaults_left = -1;
+        EXPECT_EQ(vec.size(), 2);
+        EXPECT_EQ(Throwing::alive, 2);
+    }
+    EXPECT_EQ(Throwing::alive, 0);
+}
+
+
+/**
+ */
+TEST(vectorTest, ResizeAndOverwrite) {
+    const std::string src = "hello world";
+
+    mystl::vector<char> buf = {'>', ' '};
+    buf.resize_and_overwrite(64, [&](char* p, std::size_t n) {
+        EXPECT_EQ(n, 64);
+        EXPECT_EQ(p[0], '>') << "Existing elements must be preserved";
+        std::size_t len = src.copy(p + 2, n - 2);
+        return 2 + len;
+    });
+    ASSERT_EQ(buf.size(), 2 + src.size());
+    EXPECT_EQ(std::string(buf.data(), buf.size()), "> hello world");
+
+    // shrink through the operation
+    buf.resize_and_overwrite(5, [](char*, std::size_t) { return std::size_t(1); });
+    ASSERT_EQ(buf.size(), 1);
+    EXPECT_EQ(buf[0], '>');
+
+    // returning more than count is an error
+    EXPECT_THROW(buf.resize_and_overwrite(4, [](char*, std::size_t n) { return n + 1; }), std::length_error);
+}
+
+
 /**
  */
 TEST(vectorTest, SwapVectors) {
@@ -568,6 +850,21 @@ TEST(vectorIteratorTest, RandomAccessIteratorCategoryTest) {
 }
 
 
+
+TEST(VectorTest, MemoryFootprint) {
+    mystl::vector<int> vec;
+    vec.reserve(32);
+    for (int i = 0; i < 20; ++i)
+        vec.push_back(i);
+
+    // the unused capacity is overhead
+    EXPECT_EQ(vec.allocated_bytes(), 32 * sizeof(int));
+    EXPECT_EQ(vec.memory_footprint(), sizeof(vec) + 32 * sizeof(int));
+    EXPECT_EQ(vec.overhead_bytes(), sizeof(vec) + 12 * sizeof(int));
+    vec.shrink_to_fit();
+    EXPECT_EQ(vec.overhead_bytes(), sizeof(vec));
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
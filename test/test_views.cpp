@@ -0,0 +1,203 @@
+/**
+ * \file test/test_views.cpp
+ */
+
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "views.hpp"
+#include "vector.hpp"
+#include "list.hpp"
+#include "forward_list.hpp"
+#include "array.hpp"
+
+
+namespace {
+
+// Collects the elements of any view into a std::vector for comparison.
+template <typename _Range>
+auto collect(const _Range& r) {
+    std::vector<std::remove_cvref_t<decltype(*r.begin())>> out;
+    for (auto&& elem : r)
+        out.push_back(elem);
+    return out;
+}
+
+bool is_even(int x) { return x % 2 == 0; }
+
+}
+
+
+/* filter */
+TEST(ViewsTest, FilterVector) {
+    mystl::vector<int> vec = {1, 2, 3, 4, 5, 6};
+    auto even = mystl::views::filter(vec, is_even);
+    EXPECT_EQ(collect(even), (std::vector<int>{2, 4, 6}));
+}
+
+
+TEST(ViewsTest, FilterNoMatch) {
+    mystl::vector<int> vec = {1, 3, 5};
+    auto even = vec | mystl::views::filter(is_even);
+    EXPECT_TRUE(even.begin() == even.end());
+}
+
+
+TEST(ViewsTest, FilterReferencesElements) {
+    mystl::vector<int> vec = {1, 2, 3, 4};
+    for (int& x : vec | mystl::views::filter(is_even))
+        x = 0;
+    EXPECT_EQ(vec[0], 1);
+    EXPECT_EQ(vec[1], 0);
+    EXPECT_EQ(vec[2], 3);
+    EXPECT_EQ(vec[3], 0);
+}
+
+
+/* transform */
+TEST(ViewsTest, TransformList) {
+    mystl::list<int> lst = {1, 2, 3};
+    auto squared = lst | mystl::views::transform([](int x) { return x * x; });
+    EXPECT_EQ(collect(squared), (std::vector<int>{1, 4, 9}));
+}
+
+
+TEST(ViewsTest, TransformChangesType) {
+    mystl::vector<int> vec = {1, 22, 333};
+    auto strs = mystl::views::transform(vec, [](int x) { return std::to_string(x); });
+    EXPECT_EQ(collect(strs), (std::vector<std::string>{"1", "22", "333"}));
+}
+
+
+/* take and drop */
+TEST(ViewsTest, Take) {
+    mystl::forward_list<int> flist = {1, 2, 3, 4, 5};
+    EXPECT_EQ(collect(flist | mystl::views::take(3)), (std::vector<int>{1, 2, 3}));
+    EXPECT_EQ(collect(flist | mystl::views::take(10)), (std::vector<int>{1, 2, 3, 4, 5}));
+    EXPECT_TRUE(collect(flist | mystl::views::take(0)).empty());
+}
+
+
+TEST(ViewsTest, Drop) {
+    mystl::vector<int> vec = {1, 2, 3, 4, 5};
+    EXPECT_EQ(collect(vec | mystl::views::drop(2)), (std::vector<int>{3, 4, 5}));
+    EXPECT_TRUE(collect(vec | mystl::views::drop(10)).empty());
+
+    // non random access
+    mystl::list<int> lst = {1, 2, 3, 4, 5};
+    EXPECT_EQ(collect(lst | mystl::views::drop(4)), (std::vector<int>{5}));
+    EXPECT_TRUE(collect(lst | mystl::views::drop(10)).empty());
+}
+
+
+/* chunk */
+TEST(ViewsTest, Chunk) {
+    mystl::vector<int> vec = {1, 2, 3, 4, 5, 6, 7};
+    std::vector<std::vector<int>> chunks;
+    for (auto chunk : vec | mystl::views::chunk(3))
+        chunks.push_back(collect(chunk));
+
+    ASSERT_EQ(chunks.size(), 3);
+    EXPECT_EQ(chunks[0], (std::vector<int>{1, 2, 3}));
+    EXPECT_EQ(chunks[1], (std::vector<int>{4, 5, 6}));
+    EXPECT_EQ(chunks[2], (std::vector<int>{7}));
+}
+
+
+TEST(ViewsTest, ChunkRejectsNonPositiveSize) {
+    mystl::vector<int> vec = {1, 2, 3};
+    EXPECT_THROW(mystl::views::chunk(0), std::invalid_argument);
+    EXPECT_THROW(mystl::views::chunk(-1), std::invalid_argument);
+    EXPECT_THROW(mystl::views::chunk(vec, 0), std::invalid_argument);
+    EXPECT_NO_THROW(mystl::views::chunk(vec, 1));
+}
+
+
+/* zip */
+TEST(ViewsTest, ZipStopsAtShortest) {
+    mystl::vector<int> nums = {1, 2, 3, 4};
+    mystl::list<std::string> strs = {"a", "b", "c"};
+
+    std::vector<std::string> out;
+    for (auto [n, s] : mystl::views::zip(nums, strs))
+        out.push_back(s + std::to_string(n));
+    EXPECT_EQ(out, (std::vector<std::string>{"a1", "b2", "c3"}));
+}
+
+
+TEST(ViewsTest, ZipWritesThrough) {
+    mystl::vector<int> a = {1, 2, 3};
+    mystl::vector<int> b = {10, 20, 30};
+    for (auto [x, y] : mystl::views::zip(a, b))
+        x += y;
+    EXPECT_EQ(a[0], 11);
+    EXPECT_EQ(a[1], 22);
+    EXPECT_EQ(a[2], 33);
+}
+
+
+/* enumerate */
+TEST(ViewsTest, Enumerate) {
+    mystl::array<char, 3> arr = {'x', 'y', 'z'};
+    std::size_t expected = 0;
+    for (auto [idx, c] : arr | mystl::views::enumerate) {
+        EXPECT_EQ(idx, expected);
+        EXPECT_EQ(c, arr[expected]);
+        ++expected;
+    }
+    EXPECT_EQ(expected, 3);
+}
+
+
+/* sources */
+TEST(ViewsTest, IteratorPair) {
+    int raw[] = {5, 6, 7, 8};
+    auto view = mystl::views::all(raw + 1, raw + 4) | mystl::views::take(2);
+    EXPECT_EQ(collect(view), (std::vector<int>{6, 7}));
+}
+
+
+TEST(ViewsTest, ConstContainer) {
+    const mystl::list<int> lst = {1, 2, 3, 4};
+    auto view = lst | mystl::views::filter(is_even);
+    EXPECT_EQ(collect(view), (std::vector<int>{2, 4}));
+}
+
+
+/* composition */
+TEST(ViewsTest, Pipeline) {
+    mystl::vector<int> vec;
+    for (int i = 0; i < 20; ++i)
+        vec.push_back(i);
+
+    auto view = vec
+              | mystl::views::filter(is_even)
+              | mystl::views::transform([](int x) { return x * 10; })
+              | mystl::views::drop(1)
+              | mystl::views::take(3);
+    EXPECT_EQ(collect(view), (std::vector<int>{20, 40, 60}));
+}
+
+
+TEST(ViewsTest, PipelineIsLazy) {
+    mystl::vector<int> vec = {1, 2, 3, 4, 5, 6, 7, 8};
+    int calls = 0;
+    auto view = vec
+              | mystl::views::transform([&calls](int x) { ++calls; return x; })
+              | mystl::views::take(2);
+
+    EXPECT_EQ(calls, 0) << "Building a view must not touch the elements";
+    EXPECT_EQ(collect(view), (std::vector<int>{1, 2}));
+    EXPECT_EQ(calls, 2) << "Only the taken elements should be transformed";
+}
+
+
+TEST(ViewsTest, ViewSeesContainerUpdates) {
+    mystl::vector<int> vec = {1, 2};
+    auto view = vec | mystl::views::filter(is_even);
+    vec.push_back(4);
+    EXPECT_EQ(collect(view), (std::vector<int>{2, 4}));
+}